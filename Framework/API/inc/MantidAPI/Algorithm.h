@@ -232,6 +232,14 @@ public:
   void setAlwaysStoreInADS(const bool doStore) override;
   bool getAlwaysStoreInADS() const override;
   void setRethrows(const bool rethrow) override;
+  void setMaxThreads(const size_t maxThreads);
+  size_t getMaxThreads() const;
+  void setLightweightExecution(const bool lightweight);
+  bool isLightweightExecution() const;
+  void initializeFromPrototype(const Algorithm &prototype);
+  /// Whether copying the properties of an initialized instance is equivalent
+  /// to init(), see initializeFromPrototype. False unless overridden.
+  virtual bool supportsInitializationFromPrototype() const { return false; }
 
   /** @name Asynchronous Execution */
   Poco::ActiveResult<bool> executeAsync() override;
@@ -285,6 +293,9 @@ public:
                              const double startProgress = -1.,
                              const double endProgress = -1.,
                              const bool enableLogging = true);
+  boost::shared_ptr<Algorithm>
+  createLightweightChildAlgorithm(const std::string &name,
+                                  const int &version = -1);
 
   /// set whether we wish to track the child algorithm's history and pass it the
   /// parent object to fill.
@@ -415,6 +426,8 @@ private:
 
   void logAlgorithmInfo() const;
 
+  void postNotification(Poco::Notification *notification) const;
+
   bool executeAsyncImpl(const Poco::Void &i);
 
   bool doCallProcessGroups(Mantid::Types::Core::DateAndTime &start_time);
@@ -493,6 +506,11 @@ private:
 
   std::vector<std::string> m_reservedList;
 
+  /// Maximum number of threads used by parallel regions; 0 for no limit
+  size_t m_maxThreads;
+  /// Skip notifications, history and usage reporting in execute()
+  bool m_lightweightExecution;
+
   /// (MPI) communicator used when executing the algorithm.
   std::unique_ptr<Parallel::Communicator> m_communicator;
 };
@@ -0,0 +1,96 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_ALGORITHMGRAPH_H_
+#define MANTID_API_ALGORITHMGRAPH_H_
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidAPI/IAlgorithm_fwd.h"
+#include "MantidAPI/Workspace_fwd.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+
+/** AlgorithmGraph : runs a set of algorithms whose inputs depend on the
+  outputs of others, executing independent branches concurrently.
+
+  Each step is an initialized algorithm. connect() feeds an output workspace
+  of one step straight into an input workspace property of another, so when
+  the steps are child algorithms (e.g. made with
+  Algorithm::createChildAlgorithm) intermediate workspaces never go through
+  the AnalysisDataService. addDependency() only orders two steps, for steps
+  that exchange workspaces by name.
+
+  execute() runs every step once its dependencies have finished, as tasks of
+  a ThreadPool. The threads come from the ThreadBudget, so parallel loops
+  inside the steps share the cores with the branches running alongside them.
+  If a step fails, no further steps are started and execute() throws once the
+  running ones have finished.
+
+  @code
+  AlgorithmGraph graph;
+  const auto sample = graph.addStep(loadSample);
+  const auto can = graph.addStep(loadCan);
+  const auto subtract = graph.addStep(minus);
+  graph.connect(sample, "OutputWorkspace", subtract, "LHSWorkspace");
+  graph.connect(can, "OutputWorkspace", subtract, "RHSWorkspace");
+  graph.execute();
+  MatrixWorkspace_sptr result = graph.algorithm(subtract)->getProperty(
+      "OutputWorkspace");
+  @endcode
+*/
+class MANTID_API_DLL AlgorithmGraph {
+public:
+  /// Called on the algorithm of a step just before it is executed
+  using Prepare = std::function<void(IAlgorithm &)>;
+
+  size_t addStep(IAlgorithm_sptr algorithm, Prepare prepare = Prepare());
+  void connect(size_t source, const std::string &outputProperty,
+               size_t target, const std::string &inputProperty);
+  void addDependency(size_t before, size_t after);
+
+  /// @return the number of steps
+  size_t size() const { return m_steps.size(); }
+  IAlgorithm_sptr algorithm(size_t step) const;
+
+  void execute(size_t numThreads = 0);
+
+private:
+  /// An input workspace of a step taken from the output of another
+  struct Link {
+    size_t source;
+    std::string outputProperty;
+    std::string inputProperty;
+  };
+
+  struct Step {
+    IAlgorithm_sptr algorithm;
+    Prepare prepare;
+    std::vector<Link> inputs;
+    /// Steps that have to wait for this one
+    std::vector<size_t> dependents;
+    /// Number of steps this one has to wait for
+    size_t numDependencies;
+  };
+
+  class StepTask;
+
+  void checkStep(size_t step) const;
+  void checkAcyclic() const;
+  void runStep(size_t step) const;
+  Workspace_sptr output(const Link &link) const;
+
+  std::vector<Step> m_steps;
+};
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_ALGORITHMGRAPH_H_ */
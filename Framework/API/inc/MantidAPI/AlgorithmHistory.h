@@ -141,6 +141,8 @@ private:
   AlgorithmHistory() = default;
   // Set properties of algorithm
   void setProperties(const Algorithm *const alg);
+  // Change the recorded value of a property
+  void setPropertyValue(const std::string &name, const std::string &value);
   /// The name of the Algorithm
   std::string m_name;
   /// The version of the algorithm
@@ -149,7 +151,8 @@ private:
   Mantid::Types::Core::DateAndTime m_executionDate;
   /// The execution duration of the algorithm
   double m_executionDuration{-1.0};
-  /// The PropertyHistory's defined for the algorithm
+  /// The PropertyHistory's defined for the algorithm. They are shared with
+  /// other histories with the same property values so must not be modified.
   Mantid::Kernel::PropertyHistories m_properties;
   /// count keeps track of execution order of an algorithm
   std::size_t m_execCount{0};
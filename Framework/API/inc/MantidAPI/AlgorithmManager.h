@@ -16,8 +16,10 @@
 #include <Poco/NotificationCenter.h>
 
 #include <deque>
+#include <map>
 #include <mutex>
 #include <string>
+#include <utility>
 
 namespace Mantid {
 namespace API {
@@ -47,6 +49,10 @@ public:
   /// Creates an unmanaged algorithm with the option of choosing a version
   boost::shared_ptr<Algorithm> createUnmanaged(const std::string &algName,
                                                const int &version = -1) const;
+  /// Creates an unmanaged algorithm initialized from a cached prototype
+  boost::shared_ptr<Algorithm>
+  createFromPrototype(const std::string &algName, const int &version = -1,
+                      bool lightweight = false);
 
   std::size_t size() const;
   void setMaxAlgorithms(int n);
@@ -85,6 +91,11 @@ private:
       m_managed_algs; ///<  pointers to managed algorithms [policy???]
   /// Mutex for modifying/accessing the m_managed_algs member.
   mutable std::mutex m_managedMutex;
+  /// Initialized algorithms used by createFromPrototype, by name and version
+  std::map<std::pair<std::string, int>, boost::shared_ptr<const Algorithm>>
+      m_prototypes;
+  /// Mutex for modifying/accessing the m_prototypes member.
+  std::mutex m_prototypesMutex;
 };
 
 using AlgorithmManager = Mantid::Kernel::SingletonHolder<AlgorithmManagerImpl>;
@@ -0,0 +1,121 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_ALGORITHMRESULTCACHE_H_
+#define MANTID_API_ALGORITHMRESULTCACHE_H_
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidAPI/Workspace_fwd.h"
+#include "MantidKernel/SingletonHolder.h"
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class Algorithm;
+
+/** AlgorithmResultCache : remembers the outputs of deterministic algorithms
+  so that running one again with the same inputs restores them instead of
+  recomputing them.
+
+  Caching is opt-in per algorithm name, set with the
+  algorithms.resultcache.names key (e.g.
+  "LoadEventNexus,AlignDetectors,DiffractionFocussing") or
+  setCachedAlgorithms(). The key of a run is a SHA-1 hash of:
+  - the algorithm name and version;
+  - the values of all input properties other than workspaces, plus the size
+    and modification time of input files;
+  - the content of the input workspaces: data, events, bin masks, the
+    vertical axis, spectrum-detector mapping, instrument name, source,
+    sample and detector positions, detector masks, instrument parameters,
+    sample shape, material and oriented lattice, goniometer and logs.
+    Workspace names do not matter.
+
+  Only algorithms whose input workspaces are all MatrixWorkspaces and that
+  have no InOut workspace properties are cached. Workspaces with scanning
+  detectors or a sample shape other than a CSGObject are not cached either.
+  Outputs are copied when stored and again when restored, so later changes
+  to either side cannot leak into the cache. Restored copies lose the
+  history they were stored with; Algorithm::execute restores the outputs in
+  place of calling exec(), then records history as usual, so the history of
+  a restored workspace is the same as if the algorithm had run.
+
+  Entries are kept in memory up to algorithms.resultcache.memorymb, dropping
+  the least recently used ones. If algorithms.resultcache.directory is set,
+  entries are also written there as NeXus processed files and loaded back
+  when they are not in memory, e.g. in a later session.
+*/
+class MANTID_API_DLL AlgorithmResultCacheImpl {
+public:
+  AlgorithmResultCacheImpl(const AlgorithmResultCacheImpl &) = delete;
+  AlgorithmResultCacheImpl &
+  operator=(const AlgorithmResultCacheImpl &) = delete;
+
+  void setCachedAlgorithms(const std::vector<std::string> &names);
+  bool isCached(const std::string &algorithmName) const;
+  void setMemoryLimit(size_t bytes);
+  void setDirectory(const std::string &directory);
+
+  std::string key(const Algorithm &alg) const;
+  bool restore(Algorithm &alg, const std::string &key);
+  void store(const Algorithm &alg, const std::string &key);
+
+  void clear();
+  size_t size() const;
+  size_t memoryUsed() const;
+
+private:
+  friend struct Mantid::Kernel::CreateUsingNew<AlgorithmResultCacheImpl>;
+  AlgorithmResultCacheImpl();
+  ~AlgorithmResultCacheImpl() = default;
+
+  /// The outputs of one run
+  struct Entry {
+    /// Output workspace properties
+    std::vector<std::pair<std::string, Workspace_sptr>> workspaces;
+    /// Other output properties, as strings
+    std::vector<std::pair<std::string, std::string>> values;
+    /// Memory used by the workspaces
+    size_t bytes;
+    /// Position in m_recent
+    std::list<std::string>::iterator recent;
+  };
+
+  void insert(const std::string &key, Entry entry);
+  bool load(const std::string &key, Entry &entry) const;
+  void save(const std::string &key, const Entry &entry) const;
+
+  /// Guards all members
+  mutable std::mutex m_mutex;
+  std::unordered_set<std::string> m_names;
+  size_t m_memoryLimit;
+  std::string m_directory;
+  std::unordered_map<std::string, Entry> m_entries;
+  /// Keys of m_entries, most recently used first
+  std::list<std::string> m_recent;
+  size_t m_memoryUsed;
+};
+
+using AlgorithmResultCache =
+    Mantid::Kernel::SingletonHolder<AlgorithmResultCacheImpl>;
+
+} // namespace API
+} // namespace Mantid
+
+namespace Mantid {
+namespace Kernel {
+EXTERN_MANTID_API template class MANTID_API_DLL
+    Mantid::Kernel::SingletonHolder<Mantid::API::AlgorithmResultCacheImpl>;
+}
+} // namespace Mantid
+
+#endif /* MANTID_API_ALGORITHMRESULTCACHE_H_ */
@@ -40,6 +40,7 @@ class XMLInstrumentParameter;
 namespace API {
 class ChopperModel;
 class ModeratorModel;
+class NearestNeighbourCache;
 class Run;
 class Sample;
 class SpectrumInfo;
@@ -174,6 +175,8 @@ public:
   const SpectrumInfo &spectrumInfo() const;
   SpectrumInfo &mutableSpectrumInfo();
 
+  NearestNeighbourCache &nearestNeighbourCache() const;
+
   const Geometry::ComponentInfo &componentInfo() const;
   Geometry::ComponentInfo &mutableComponentInfo();
 
@@ -237,6 +240,8 @@ private:
   mutable std::unique_ptr<Beamline::SpectrumInfo> m_spectrumInfo;
   mutable std::unique_ptr<SpectrumInfo> m_spectrumInfoWrapper;
   mutable std::mutex m_spectrumInfoMutex;
+  /// Nearest-neighbour tables, shared between copies
+  boost::shared_ptr<NearestNeighbourCache> m_nearestNeighbourCache;
   // This vector stores boolean flags but uses char to do so since
   // std::vector<bool> is not thread-safe.
   mutable std::vector<char> m_spectrumDefinitionNeedsUpdate;
@@ -102,6 +102,8 @@ private:
   void asynchronousStartupTasks();
   /// Setup Usage Reporting if enabled
   void setupUsageReporting();
+  /// Start the execution profiler if a trace file is configured
+  void setupProfiling();
   /// Update instrument definitions from github
   void updateInstrumentDefinitions();
   /// check if a newer version of Mantid is available
@@ -33,6 +33,10 @@ namespace Geometry {
 class ParameterMap;
 }
 
+namespace HistogramData {
+class RebinOperator;
+}
+
 namespace API {
 class Axis;
 class SpectrumDetectorMapping;
@@ -164,6 +168,7 @@ public:
   template <typename... T>
   void setHistogram(const size_t index, T &&... data) & {
     getSpectrum(index).setHistogram(std::forward<T>(data)...);
+    invalidateCommonBinsFlag();
   }
   void convertToCounts(const size_t index) {
     getSpectrum(index).convertToCounts();
@@ -184,9 +189,11 @@ public:
   template <typename... T>
   void setBinEdges(const size_t index, T &&... data) & {
     getSpectrum(index).setBinEdges(std::forward<T>(data)...);
+    invalidateCommonBinsFlag();
   }
   template <typename... T> void setPoints(const size_t index, T &&... data) & {
     getSpectrum(index).setPoints(std::forward<T>(data)...);
+    invalidateCommonBinsFlag();
   }
   template <typename... T>
   void setPointVariances(const size_t index, T &&... data) & {
@@ -253,6 +260,7 @@ public:
     return getSpectrum(index).dx();
   }
   HistogramData::HistogramX &mutableX(const size_t index) & {
+    invalidateCommonBinsFlag();
     return getSpectrum(index).mutableX();
   }
   HistogramData::HistogramDx &mutableDx(const size_t index) & {
@@ -280,6 +288,7 @@ public:
   void setSharedX(const size_t index,
                   const Kernel::cow_ptr<HistogramData::HistogramX> &x) & {
     getSpectrum(index).setSharedX(x);
+    invalidateCommonBinsFlag();
   }
   void setSharedDx(const size_t index,
                    const Kernel::cow_ptr<HistogramData::HistogramDx> &dx) & {
@@ -416,6 +425,12 @@ public:
 
   /// Returns true if the workspace contains has common X bins
   virtual bool isCommonBins() const;
+  /// Returns the X data if it is identical for all spectra, else null
+  Kernel::cow_ptr<HistogramData::HistogramX> commonX() const;
+  /// Returns an operator rebinning all spectra to binEdges, if they have
+  /// common bin edges, else null
+  boost::shared_ptr<const HistogramData::RebinOperator>
+  rebinOperator(const HistogramData::BinEdges &binEdges) const;
 
   std::string YUnit() const;
   void setYUnit(const std::string &newUnit);
@@ -551,7 +566,12 @@ protected:
 
   /// Invalidates the commons bins flag.  This is generally called when a method
   /// could allow the X values to be changed.
-  void invalidateCommonBinsFlag() { m_isCommonBinsFlagSet = false; }
+  void invalidateCommonBinsFlag() {
+    m_isCommonBinsFlagSet = false;
+    // Read first, such that parallel loops over spectra do not all write it
+    if (m_isCommonXSet.load(std::memory_order_relaxed))
+      m_isCommonXSet = false;
+  }
 
   void updateCachedDetectorGrouping(const size_t index) const override;
 
@@ -590,6 +610,15 @@ private:
   mutable bool m_isCommonBinsFlagSet{false};
   /// Flag indicating whether the data has common bins. False by default
   mutable bool m_isCommonBinsFlag{false};
+  /// Whether m_isCommonX is up to date
+  mutable std::atomic<bool> m_isCommonXSet{false};
+  /// Whether all spectra have identical X data, see commonX()
+  mutable std::atomic<bool> m_isCommonX{false};
+  mutable std::mutex m_commonXMutex;
+  /// The last operator returned by rebinOperator(), cached for reuse
+  mutable boost::shared_ptr<const HistogramData::RebinOperator>
+      m_rebinOperator;
+  mutable std::mutex m_rebinOperatorMutex;
 
   /// The set of masked bins in a map keyed on workspace index
   std::map<int64_t, MaskList> m_masks;
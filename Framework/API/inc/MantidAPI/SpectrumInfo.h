@@ -13,6 +13,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Mantid {
@@ -45,6 +47,12 @@ class ExperimentInfo;
   are no thread-safety guarantees for write operations (non-const access). Reads
   concurrent with writes or concurrent writes are not allowed.
 
+  For algorithms that need L2 and angles of all spectra, the bulk accessors such
+  as l2s() and twoThetas() return contiguous vectors with one entry per spectrum.
+  They are computed in a single (parallel) pass on first use and cached until
+  detector positions, source or sample position, or the detector grouping
+  change. Obtain the reference once outside of loops over spectra.
+
 
   @author Simon Heybrock
   @date 2016
@@ -71,6 +79,13 @@ public:
   bool hasDetectors(const size_t index) const;
   bool hasUniqueDetector(const size_t index) const;
 
+  const std::vector<double> &l2s() const;
+  const std::vector<double> &twoThetas() const;
+  const std::vector<double> &signedTwoThetas() const;
+  const std::vector<double> &azimuthals() const;
+  const std::vector<double> &difcs() const;
+  const std::vector<Kernel::V3D> &positions() const;
+
   void setMasked(const size_t index, bool masked);
 
   // This is likely to be deprecated/removed with the introduction of
@@ -90,9 +105,14 @@ public:
   friend class ExperimentInfo;
 
 private:
+  struct GeometryCache;
+
   const Geometry::IDetector &getDetector(const size_t index) const;
   const SpectrumDefinition &
   checkAndGetSpectrumDefinition(const size_t index) const;
+  const GeometryCache &geometryCache() const;
+  const GeometryCache &angularGeometryCache() const;
+  std::unique_ptr<GeometryCache> buildGeometryCache() const;
 
   const ExperimentInfo &m_experimentInfo;
   Geometry::DetectorInfo &m_detectorInfo;
@@ -100,6 +120,8 @@ private:
   mutable std::vector<boost::shared_ptr<const Geometry::IDetector>>
       m_lastDetector;
   mutable std::vector<size_t> m_lastIndex;
+  mutable std::unique_ptr<GeometryCache> m_geometryCache;
+  mutable std::mutex m_geometryCacheMutex;
 };
 
 } // namespace API
@@ -0,0 +1,80 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_WORKSPACEEXPRESSION_H_
+#define MANTID_API_WORKSPACEEXPRESSION_H_
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+
+#include <boost/shared_ptr.hpp>
+
+namespace Mantid {
+namespace API {
+
+/** WorkspaceExpression : lazy arithmetic on MatrixWorkspaces.
+
+  Combining expressions with +, -, * and / only records the operations. At
+  least one operand of each operation must be an expression, otherwise the
+  operator overloads of WorkspaceOpOverloads.h run the algorithm right away.
+  An expression such as
+
+    using Expr = WorkspaceExpression;
+    (Expr(sample) - 0.9 * Expr(can)) / vanadium * scale
+
+  is computed by evaluate() in a single pass over the spectra, without the
+  intermediate workspaces the Minus, Multiply and Divide algorithms would
+  create. Errors are propagated as by those algorithms, assuming that the
+  operands are uncorrelated; a workspace that occurs more than once in an
+  expression is treated as independent copies, as with chained algorithms.
+
+  All workspace operands must have the same number of spectra and bins, except
+  for single-spectrum workspaces, which are applied to every spectrum,
+  workspaces with one bin per spectrum, e.g. integrated vanadium, whose value
+  is applied to every bin of its spectrum, and single-value workspaces, which
+  act like numbers with an error. The result is
+  always a histogram workspace with the X values, instrument and logs of the
+  first workspace operand of full size. Spectra masked in any operand are
+  zeroed and masked in the result, and masked bins are carried over.
+*/
+class MANTID_API_DLL WorkspaceExpression {
+public:
+  WorkspaceExpression(const MatrixWorkspace_const_sptr &workspace);
+  WorkspaceExpression(const MatrixWorkspace_sptr &workspace);
+  WorkspaceExpression(const double value);
+
+  MatrixWorkspace_sptr evaluate() const;
+
+  class Node;
+
+private:
+  explicit WorkspaceExpression(boost::shared_ptr<const Node> node);
+
+  boost::shared_ptr<const Node> m_node;
+
+  friend MANTID_API_DLL WorkspaceExpression
+  operator+(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+  friend MANTID_API_DLL WorkspaceExpression
+  operator-(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+  friend MANTID_API_DLL WorkspaceExpression
+  operator*(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+  friend MANTID_API_DLL WorkspaceExpression
+  operator/(const WorkspaceExpression &lhs, const WorkspaceExpression &rhs);
+};
+
+MANTID_API_DLL WorkspaceExpression operator+(const WorkspaceExpression &lhs,
+                                             const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator-(const WorkspaceExpression &lhs,
+                                             const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator*(const WorkspaceExpression &lhs,
+                                             const WorkspaceExpression &rhs);
+MANTID_API_DLL WorkspaceExpression operator/(const WorkspaceExpression &lhs,
+                                             const WorkspaceExpression &rhs);
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_WORKSPACEEXPRESSION_H_ */
@@ -12,6 +12,7 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidKernel/EnvironmentHistory.h"
+#include "MantidKernel/cow_ptr.h"
 #include <ctime>
 #include <set>
 
@@ -30,6 +31,13 @@ class HistoryView;
 /** This class stores information about the Workspace History used by algorithms
   on a workspace and the environment history.
 
+  The algorithm histories are immutable once recorded and are shared rather
+  than copied: copies of a workspace share the whole list until one of them
+  records a new algorithm. If the history.maxentries key is set, the history
+  is bounded: an algorithm run again with the same properties replaces its
+  previous entry and only the most recent history.maxentries entries are
+  kept.
+
   @author Dickon Champion, ISIS, RAL
   @date 21/01/2008
 */
@@ -88,7 +96,7 @@ private:
   /// The environment of the workspace
   const Kernel::EnvironmentHistory m_environment;
   /// The algorithms which have been called on the workspace
-  Mantid::API::AlgorithmHistories m_algorithms;
+  Kernel::cow_ptr<Mantid::API::AlgorithmHistories> m_algorithms;
 };
 
 MANTID_API_DLL std::ostream &operator<<(std::ostream &,
@@ -10,12 +10,10 @@
 #include "MantidAPI/DllConfig.h"
 #include "MantidGeometry/IDTypes.h"
 #include "MantidKernel/V3D.h"
-// Boost graphing
-#ifndef Q_MOC_RUN
-#include <boost/graph/adjacency_list.hpp>
 #include <boost/shared_ptr.hpp>
-#include <unordered_map>
-#endif
+#include <map>
+#include <mutex>
+#include <vector>
 
 namespace Mantid {
 namespace Geometry {
@@ -24,6 +22,28 @@ class IDetector;
 } // namespace Geometry
 namespace API {
 class SpectrumInfo;
+struct NearestNeighbourTable;
+
+/**
+ * Cache of nearest-neighbour tables held by an ExperimentInfo, such that
+ * repeated searches on workspaces with identical detector positions and
+ * spectrum numbers do not need to redo the search. Tables are identified by
+ * their content, so a cache may safely be shared between copies of a
+ * workspace. Thread-safe.
+ */
+class MANTID_API_DLL NearestNeighbourCache {
+public:
+  boost::shared_ptr<const NearestNeighbourTable>
+  find(const NearestNeighbourTable &key) const;
+  void insert(boost::shared_ptr<const NearestNeighbourTable> table);
+
+private:
+  /// Maximum number of tables kept in the cache
+  static constexpr size_t maxTables = 4;
+  mutable std::mutex m_mutex;
+  std::vector<boost::shared_ptr<const NearestNeighbourTable>> m_tables;
+};
+
 /**
  * This class is not intended for direct use. Use WorkspaceNearestNeighbourInfo
  * instead!
@@ -38,19 +58,17 @@ class SpectrumInfo;
  * ANN is available from <http://www.cs.umd.edu/~mount/ANN/> and is released
  * under the GNU LGPL.
  *
- * Known potential issue: boost's graph has an issue that may cause compilation
- * errors in some circumstances in the current version of boost used by
- * Mantid (1.43) based on tr1::tie. This issue is fixed in later versions
- * of boost, but should in theory be guarded against by this file only being
- * included in ParameterMap.
- *
- *
+ * The neighbours of all spectra are searched for in parallel when the object
+ * is built and are stored in a flat table. If a NearestNeighbourCache is given
+ * the table is shared with other objects built for the same spectra and
+ * detector positions.
  */
 class MANTID_API_DLL WorkspaceNearestNeighbours {
 public:
   WorkspaceNearestNeighbours(int nNeighbours, const SpectrumInfo &spectrumInfo,
                              std::vector<specnum_t> spectrumNumbers,
-                             bool ignoreMaskedDetectors = false);
+                             bool ignoreMaskedDetectors = false,
+                             NearestNeighbourCache *cache = nullptr);
 
   // Neighbouring spectra by radius
   std::map<specnum_t, Mantid::Kernel::V3D>
@@ -68,20 +86,10 @@ private:
   /// Vector of spectrum numbers
   const std::vector<specnum_t> m_spectrumNumbers;
 
-  /// typedef for Graph object used to hold the calculated information
-  using Graph = boost::adjacency_list<
-      boost::vecS, boost::vecS, boost::directedS,
-      boost::property<boost::vertex_name_t, int64_t>,
-      boost::property<boost::edge_name_t, Mantid::Kernel::V3D>>;
-  /// Vertex descriptor object for Graph
-  using Vertex = boost::graph_traits<Graph>::vertex_descriptor;
-  /// map object of int to Graph Vertex descriptor
-  using MapIV = std::unordered_map<specnum_t, Vertex>;
-
-  /// Construct the graph based on the given number of neighbours and the
-  /// current instument and spectra-detector mapping
+  /// Construct the neighbour table based on the given number of neighbours and
+  /// the current instument and spectra-detector mapping
   void build(const int noNeighbours);
-  /// Query the graph for the default number of nearest neighbours to specified
+  /// Query the table for the default number of nearest neighbours to specified
   /// detector
   std::map<specnum_t, Mantid::Kernel::V3D>
   defaultNeighbours(const specnum_t spectrum) const;
@@ -89,16 +97,10 @@ private:
   int m_noNeighbours;
   /// The largest value of the distance to a nearest neighbour
   double m_cutoff;
-  /// map between the DetectorID and the Graph node descriptor
-  MapIV m_specToVertex;
-  /// boost::graph object
-  Graph m_graph;
-  /// property map holding the node's related DetectorID's
-  boost::property_map<Graph, boost::vertex_name_t>::type m_vertexID;
-  /// property map holding the edge's related Distance value.
-  boost::property_map<Graph, boost::edge_name_t>::type m_edgeLength;
-  /// V3D for scaling
-  Kernel::V3D m_scale;
+  /// The nearest neighbours of all spectra
+  boost::shared_ptr<const NearestNeighbourTable> m_table;
+  /// Optional cache for neighbour tables
+  NearestNeighbourCache *m_cache;
   /// Cached radius value. used to avoid uncessary recalculations.
   mutable double m_radius;
   /// Flag indicating that masked detectors should be ignored
@@ -9,6 +9,7 @@
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AlgorithmProxy.h"
+#include "MantidAPI/AlgorithmResultCache.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/DeprecatedAlgorithm.h"
 #include "MantidAPI/IWorkspaceProperty.h"
@@ -19,9 +20,12 @@
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/DateAndTime.h"
 #include "MantidKernel/EmptyValues.h"
+#include "MantidKernel/ExecutionProfiler.h"
+#include "MantidKernel/Memory.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/Strings.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/UsageService.h"
 
@@ -38,7 +42,9 @@
 
 #include <json/json.h>
 
+#include <algorithm>
 #include <map>
+#include <typeinfo>
 
 // Index property handling template definitions
 #include "MantidAPI/Algorithm.tcc"
@@ -65,6 +71,54 @@ public:
 private:
   const std::string &m_value;
 };
+
+/// Records one execution of an algorithm with the ExecutionProfiler, if it is
+/// enabled, with the resources it used.
+class AlgorithmProfile {
+public:
+  AlgorithmProfile(const Algorithm &alg,
+                   const std::vector<IWorkspaceProperty *> &outputs)
+      : m_span("algorithm",
+               alg.name() + " v" + std::to_string(alg.version())),
+        m_outputs(outputs), m_cpuStart(0.), m_peakRSSStart(0) {
+    if (m_span.active()) {
+      m_cpuStart = ExecutionProfilerImpl::processCPUTime();
+      m_peakRSSStart = peakRSS();
+    }
+  }
+  AlgorithmProfile(const AlgorithmProfile &) = delete;
+  AlgorithmProfile &operator=(const AlgorithmProfile &) = delete;
+
+  ~AlgorithmProfile() {
+    if (!m_span.active())
+      return;
+    try {
+      m_span.addArg("cpu_seconds",
+                    ExecutionProfilerImpl::processCPUTime() - m_cpuStart);
+      m_span.addArg("peak_rss_growth_bytes",
+                    static_cast<double>(peakRSS() - m_peakRSSStart));
+      size_t outputBytes(0);
+      for (const auto output : m_outputs) {
+        if (const auto ws = output->getWorkspace())
+          outputBytes += ws->getMemorySize();
+      }
+      m_span.addArg("output_workspace_bytes", static_cast<double>(outputBytes));
+    } catch (...) {
+      // Profiling must not change how the algorithm finishes
+    }
+  }
+
+private:
+  static size_t peakRSS() {
+    static const MemoryStats stats(MEMORY_STATS_IGNORE_SYSTEM);
+    return stats.getPeakRSS();
+  }
+
+  ExecutionProfilerImpl::Span m_span;
+  const std::vector<IWorkspaceProperty *> &m_outputs;
+  double m_cpuStart;
+  size_t m_peakRSSStart;
+};
 } // namespace
 
 // Doxygen can't handle member specialization at the moment:
@@ -103,7 +157,8 @@ Algorithm::Algorithm()
       m_runningAsync(false), m_running(false), m_rethrow(false),
       m_isAlgStartupLoggingEnabled(true), m_startChildProgress(0.),
       m_endChildProgress(0.), m_algorithmID(this), m_singleGroup(-1),
-      m_groupsHaveSimilarNames(false),
+      m_groupsHaveSimilarNames(false), m_maxThreads(0),
+      m_lightweightExecution(false),
       m_communicator(Kernel::make_unique<Parallel::Communicator>()) {}
 
 /// Virtual destructor
@@ -181,6 +236,34 @@ bool Algorithm::getAlwaysStoreInADS() const { return m_alwaysStoreInADS; }
  */
 void Algorithm::setRethrows(const bool rethrow) { this->m_rethrow = rethrow; }
 
+/** Limit the number of threads used by the parallel regions and thread pools
+ * of this algorithm and of its child algorithms. The threads are taken from
+ * the framework-wide Kernel::ThreadBudget in either case.
+ * @param maxThreads :: maximum number of threads; 0 for no limit
+ */
+void Algorithm::setMaxThreads(const size_t maxThreads) {
+  m_maxThreads = maxThreads;
+}
+
+/// @return the maximum number of threads of this algorithm; 0 for no limit
+size_t Algorithm::getMaxThreads() const { return m_maxThreads; }
+
+/** In lightweight mode execute() leaves out what is only worth doing when an
+ * algorithm runs once on behalf of a user: it does not tell the
+ * AlgorithmManager that it is starting, records no history, does not look in
+ * the AlgorithmResultCache, does not register its usage and does not log its
+ * timings. Meant for child algorithms run many times in a loop.
+ * @param lightweight :: true to execute in lightweight mode
+ */
+void Algorithm::setLightweightExecution(const bool lightweight) {
+  m_lightweightExecution = lightweight;
+}
+
+/// @return true if execute() runs in lightweight mode
+bool Algorithm::isLightweightExecution() const {
+  return m_lightweightExecution;
+}
+
 /// True if the algorithm is running.
 bool Algorithm::isRunning() const { return m_running; }
 
@@ -210,7 +293,7 @@ void Algorithm::removeObserver(const Poco::AbstractObserver &observer) const {
  */
 void Algorithm::progress(double p, const std::string &msg, double estimatedTime,
                          int progressPrecision) {
-  notificationCenter().postNotification(
+  postNotification(
       new ProgressNotification(this, p, msg, estimatedTime, progressPrecision));
 }
 
@@ -302,6 +385,39 @@ void Algorithm::initialize() {
   }
 }
 
+/** Initialize the algorithm by copying the properties of an initialized
+ * algorithm of the same type instead of calling init(). This is only correct
+ * for algorithms whose init() does nothing but declare properties, which
+ * declare this by overriding supportsInitializationFromPrototype. Other
+ * algorithms, and those declaring index properties, which refer to the
+ * workspace property of their own algorithm, are initialized by initialize().
+ * If logging is disabled the logger keeps its generic name, which saves
+ * setting it up.
+ * @param prototype :: an initialized algorithm of the same type
+ * @throw std::invalid_argument if the prototype is not initialized or of
+ * another type
+ */
+void Algorithm::initializeFromPrototype(const Algorithm &prototype) {
+  if (m_isInitialized)
+    return;
+  if (!prototype.isInitialized() || typeid(prototype) != typeid(*this)) {
+    throw std::invalid_argument("Cannot initialize " + this->name() +
+                                " from an uninitialized algorithm or one of " +
+                                "a different type");
+  }
+  if (!supportsInitializationFromPrototype() ||
+      !prototype.m_reservedList.empty()) {
+    initialize();
+    return;
+  }
+  if (isLogging())
+    g_log.setName(this->name());
+  setLoggingOffset(0);
+  clonePropertiesFrom(prototype);
+  setupSkipValidationMasterOnly();
+  setInitialized();
+}
+
 //---------------------------------------------------------------------------------------------
 /** Perform validation of ALL the input properties of the algorithm.
  * This is to be overridden by specific algorithms.
@@ -446,14 +562,18 @@ void Algorithm::unlockWorkspaces() {
  */
 bool Algorithm::execute() {
   Timer timer;
-  AlgorithmManager::Instance().notifyAlgorithmStarting(this->getAlgorithmID());
+  // Child algorithms run in this thread, so they inherit the limit
+  Kernel::ThreadBudget::Limit threadLimit(m_maxThreads);
+  if (!m_lightweightExecution)
+    AlgorithmManager::Instance().notifyAlgorithmStarting(
+        this->getAlgorithmID());
   {
     DeprecatedAlgorithm *depo = dynamic_cast<DeprecatedAlgorithm *>(this);
     if (depo != nullptr)
       getLogger().error(depo->deprecationMsg(this));
   }
 
-  notificationCenter().postNotification(new StartedNotification(this));
+  postNotification(new StartedNotification(this));
   Mantid::Types::Core::DateAndTime startTime;
 
   // Return a failure if the algorithm hasn't been initialized
@@ -483,7 +603,7 @@ bool Algorithm::execute() {
     }
     // Try the validation again
     if (!validateProperties()) {
-      notificationCenter().postNotification(
+      postNotification(
           new ErrorNotification(this, "Some invalid Properties found"));
       throw std::runtime_error("Some invalid Properties found");
     }
@@ -501,8 +621,7 @@ bool Algorithm::execute() {
     getLogger().error() << "Error in execution of algorithm " << this->name()
                         << "\n"
                         << ex.what() << "\n";
-    notificationCenter().postNotification(
-        new ErrorNotification(this, ex.what()));
+    postNotification(new ErrorNotification(this, ex.what()));
     m_running = false;
     if (m_isChildAlgorithm || m_runningAsync || m_rethrow) {
       m_runningAsync = false;
@@ -538,7 +657,7 @@ bool Algorithm::execute() {
       }
       // Throw because something was invalid
       if (numErrors > 0) {
-        notificationCenter().postNotification(
+        postNotification(
             new ErrorNotification(this, "Some invalid Properties found"));
         throw std::runtime_error("Some invalid Properties found");
       }
@@ -579,8 +698,20 @@ bool Algorithm::execute() {
 
       startTime = Mantid::Types::Core::DateAndTime::getCurrentTime();
       // Call the concrete algorithm's exec method
-      this->exec(executionMode);
-      registerFeatureUsage();
+      {
+        AlgorithmProfile profile(*this, m_outputWorkspaceProps);
+        // Deterministic algorithms may be set to reuse earlier results
+        auto &resultCache = AlgorithmResultCache::Instance();
+        const auto cacheKey =
+            m_lightweightExecution ? std::string() : resultCache.key(*this);
+        if (cacheKey.empty() || !resultCache.restore(*this, cacheKey)) {
+          this->exec(executionMode);
+          if (!cacheKey.empty())
+            resultCache.store(*this, cacheKey);
+        }
+      }
+      if (!m_lightweightExecution)
+        registerFeatureUsage();
       // Check for a cancellation request in case the concrete algorithm doesn't
       interruption_point();
       const float timingExec = timer.elapsed(resetTimer);
@@ -603,14 +734,16 @@ bool Algorithm::execute() {
       setExecuted(true);
 
       // Log that execution has completed.
-      getLogger().debug(
-          "Time to validate properties: " +
-          std::to_string(timingPropertyValidation) + " seconds\n" +
-          "Time for other input validation: " +
-          std::to_string(timingInputValidation) + " seconds\n" +
-          "Time for other initialization: " + std::to_string(timingInit) +
-          " seconds\n" + "Time to run exec: " + std::to_string(timingExec) +
-          " seconds\n");
+      if (!m_lightweightExecution) {
+        getLogger().debug(
+            "Time to validate properties: " +
+            std::to_string(timingPropertyValidation) + " seconds\n" +
+            "Time for other input validation: " +
+            std::to_string(timingInputValidation) + " seconds\n" +
+            "Time for other initialization: " + std::to_string(timingInit) +
+            " seconds\n" + "Time to run exec: " + std::to_string(timingExec) +
+            " seconds\n");
+      }
       reportCompleted(duration);
     } catch (std::runtime_error &ex) {
       this->unlockWorkspaces();
@@ -621,8 +754,7 @@ bool Algorithm::execute() {
             << "Error in execution of algorithm " << this->name() << '\n'
             << ex.what() << '\n';
       }
-      notificationCenter().postNotification(
-          new ErrorNotification(this, ex.what()));
+      postNotification(new ErrorNotification(this, ex.what()));
       m_running = false;
     } catch (std::logic_error &ex) {
       this->unlockWorkspaces();
@@ -633,16 +765,14 @@ bool Algorithm::execute() {
             << "Logic Error in execution of algorithm " << this->name() << '\n'
             << ex.what() << '\n';
       }
-      notificationCenter().postNotification(
-          new ErrorNotification(this, ex.what()));
+      postNotification(new ErrorNotification(this, ex.what()));
       m_running = false;
     }
   } catch (CancelException &ex) {
     m_runningAsync = false;
     m_running = false;
     getLogger().error() << this->name() << ": Execution terminated by user.\n";
-    notificationCenter().postNotification(
-        new ErrorNotification(this, ex.what()));
+    postNotification(new ErrorNotification(this, ex.what()));
     this->unlockWorkspaces();
     throw;
   }
@@ -652,8 +782,7 @@ bool Algorithm::execute() {
     m_runningAsync = false;
     m_running = false;
 
-    notificationCenter().postNotification(
-        new ErrorNotification(this, ex.what()));
+    postNotification(new ErrorNotification(this, ex.what()));
     getLogger().error() << "Error in execution of algorithm " << this->name()
                         << ":\n"
                         << ex.what() << "\n";
@@ -667,7 +796,7 @@ bool Algorithm::execute() {
     m_runningAsync = false;
     m_running = false;
 
-    notificationCenter().postNotification(
+    postNotification(
         new ErrorNotification(this, "UNKNOWN Exception is caught in exec()"));
     getLogger().error() << this->name()
                         << ": UNKNOWN Exception is caught in exec()\n";
@@ -678,8 +807,7 @@ bool Algorithm::execute() {
   // Unlock the locked workspaces
   this->unlockWorkspaces();
 
-  notificationCenter().postNotification(
-      new FinishedNotification(this, isExecuted()));
+  postNotification(new FinishedNotification(this, isExecuted()));
   // Only gets to here if algorithm ended normally
   return isExecuted();
 }
@@ -777,6 +905,24 @@ Algorithm_sptr Algorithm::createChildAlgorithm(const std::string &name,
   return alg;
 }
 
+/** Create a Child Algorithm that is cheap to create and run, for use in loops
+ * running it many times, e.g. once per spectrum. It is initialized from a
+ * prototype, see AlgorithmManagerImpl::createFromPrototype, executes in
+ * lightweight mode, see setLightweightExecution, and neither logs nor reports
+ * progress.
+ * @param name :: The name of the Algorithm to use
+ * @param version :: The version of the Algorithm to use, -1 for the newest
+ * @return shared pointer to the initialized Child Algorithm
+ */
+Algorithm_sptr
+Algorithm::createLightweightChildAlgorithm(const std::string &name,
+                                           const int &version) {
+  Algorithm_sptr alg =
+      AlgorithmManager::Instance().createFromPrototype(name, version, true);
+  setupAsChildAlgorithm(alg, -1., -1., false);
+  return alg;
+}
+
 /** Setup algorithm as child algorithm.
  *
  * Used internally by createChildAlgorithm. Arguments are as documented there.
@@ -823,8 +969,19 @@ void Algorithm::setupAsChildAlgorithm(Algorithm_sptr alg,
   // It will be used this to pass on cancellation requests
   // It must be protected by a critical block so that Child Algorithms can run
   // in parallel safely.
+  // Expired pointers are dropped before the vector has to grow, so that it
+  // does not grow without bound when child algorithms run in a loop.
   boost::weak_ptr<IAlgorithm> weakPtr(alg);
   PARALLEL_CRITICAL(Algorithm_StoreWeakPtr) {
+    if (m_ChildAlgorithms.size() >= 16 &&
+        m_ChildAlgorithms.size() == m_ChildAlgorithms.capacity()) {
+      m_ChildAlgorithms.erase(
+          std::remove_if(m_ChildAlgorithms.begin(), m_ChildAlgorithms.end(),
+                         [](const boost::weak_ptr<IAlgorithm> &child) {
+                           return child.expired();
+                         }),
+          m_ChildAlgorithms.end());
+    }
     m_ChildAlgorithms.push_back(weakPtr);
   }
 }
@@ -1042,7 +1199,8 @@ void Algorithm::linkHistoryWithLastChild() {
                 std::ostringstream os;
                 os << "__TMP" << outputProp->getWorkspace().get();
                 if (os.str() == (*propIter)->value()) {
-                  (*propIter)->setValue((*it)->value());
+                  (*childIter)
+                      ->setPropertyValue((*propIter)->name(), (*it)->value());
                   linked = true;
                 }
               }
@@ -1068,7 +1226,7 @@ void Algorithm::trackAlgorithmHistory(
  *  @return if we are tracking the history of this algorithm
  */
 bool Algorithm::trackingHistory() {
-  return (!isChild() || m_recordHistoryForChild);
+  return !m_lightweightExecution && (!isChild() || m_recordHistoryForChild);
 }
 
 /** Populate lists of the input & output workspace properties.
@@ -1345,14 +1503,13 @@ bool Algorithm::doCallProcessGroups(
     setExecuted(false);
     m_runningAsync = false;
     m_running = false;
-    notificationCenter().postNotification(
-        new ErrorNotification(this, ex.what()));
+    postNotification(new ErrorNotification(this, ex.what()));
     throw;
   } catch (...) {
     setExecuted(false);
     m_runningAsync = false;
     m_running = false;
-    notificationCenter().postNotification(new ErrorNotification(
+    postNotification(new ErrorNotification(
         this, "UNKNOWN Exception caught from processGroups"));
     throw;
   }
@@ -1372,8 +1529,7 @@ bool Algorithm::doCallProcessGroups(
   }
 
   setExecuted(completed);
-  notificationCenter().postNotification(
-      new FinishedNotification(this, isExecuted()));
+  postNotification(new FinishedNotification(this, isExecuted()));
 
   return completed;
 }
@@ -1643,6 +1799,17 @@ Poco::NotificationCenter &Algorithm::notificationCenter() const {
   return *m_notificationCenter;
 }
 
+/** Post a notification to the observers of the algorithm. Nothing can observe
+ * an algorithm whose notification center has not been created yet, so the
+ * notification is simply dropped in that case.
+ * @param notification :: the notification, which this method takes ownership of
+ */
+void Algorithm::postNotification(Poco::Notification *notification) const {
+  Poco::AutoPtr<Poco::Notification> ptr(notification);
+  if (m_notificationCenter)
+    m_notificationCenter->postNotification(ptr);
+}
+
 /** Handles and rescales child algorithm progress notifications.
  *  @param pNf :: The progress notification from the child algorithm.
  */
@@ -0,0 +1,215 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/AlgorithmGraph.h"
+#include "MantidAPI/IAlgorithm.h"
+#include "MantidAPI/IWorkspaceProperty.h"
+#include "MantidAPI/Workspace.h"
+#include "MantidKernel/Task.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+
+#include <atomic>
+#include <stdexcept>
+
+using namespace Mantid::Kernel;
+
+namespace Mantid {
+namespace API {
+
+namespace {
+/// @return a description of a step for error messages
+std::string describe(size_t step, const IAlgorithm &algorithm) {
+  return "step " + std::to_string(step) + " (" + algorithm.name() + ")";
+}
+
+/// @return true if the algorithm has a workspace property called name
+bool hasWorkspaceProperty(const IAlgorithm &algorithm,
+                          const std::string &name) {
+  return algorithm.existsProperty(name) &&
+         dynamic_cast<IWorkspaceProperty *>(
+             algorithm.getPointerToProperty(name));
+}
+} // namespace
+
+/** Runs one step, then schedules the steps that were only waiting for it.
+ */
+class AlgorithmGraph::StepTask final : public Task {
+public:
+  StepTask(const AlgorithmGraph &graph, size_t step,
+           std::vector<std::atomic<size_t>> &waiting,
+           ThreadScheduler &scheduler)
+      : m_graph(graph), m_step(step), m_waiting(waiting),
+        m_scheduler(scheduler) {}
+
+  void run() override {
+    m_graph.runStep(m_step);
+    for (const auto dependent : m_graph.m_steps[m_step].dependents) {
+      if (--m_waiting[dependent] == 0)
+        m_scheduler.push(
+            new StepTask(m_graph, dependent, m_waiting, m_scheduler));
+    }
+  }
+
+private:
+  const AlgorithmGraph &m_graph;
+  const size_t m_step;
+  std::vector<std::atomic<size_t>> &m_waiting;
+  ThreadScheduler &m_scheduler;
+};
+
+/** Add a step to the graph.
+ * @param algorithm :: an initialized algorithm with the properties that do
+ *        not come from other steps already set
+ * @param prepare :: optional function called on the algorithm just before
+ *        it runs, e.g. to set properties that refer to workspaces made by
+ *        earlier steps by name
+ * @return the index of the step
+ * @throws std::invalid_argument if the algorithm is null or not initialized
+ */
+size_t AlgorithmGraph::addStep(IAlgorithm_sptr algorithm, Prepare prepare) {
+  if (!algorithm || !algorithm->isInitialized())
+    throw std::invalid_argument(
+        "AlgorithmGraph steps must be initialized algorithms");
+  m_steps.push_back(
+      Step{std::move(algorithm), std::move(prepare), {}, {}, 0});
+  return m_steps.size() - 1;
+}
+
+/** Feed an output workspace of one step into an input of another. The
+ * target step runs after the source step.
+ * @param source :: the step producing the workspace
+ * @param outputProperty :: name of the output workspace property of source
+ * @param target :: the step consuming the workspace
+ * @param inputProperty :: name of the input workspace property of target
+ * @throws std::out_of_range if a step does not exist
+ * @throws std::invalid_argument if a property does not exist or is not a
+ *         workspace property
+ */
+void AlgorithmGraph::connect(size_t source, const std::string &outputProperty,
+                             size_t target, const std::string &inputProperty) {
+  checkStep(source);
+  checkStep(target);
+  const auto &sourceAlg = *m_steps[source].algorithm;
+  const auto &targetAlg = *m_steps[target].algorithm;
+  if (!hasWorkspaceProperty(sourceAlg, outputProperty))
+    throw std::invalid_argument(outputProperty +
+                                " is not a workspace property of " +
+                                describe(source, sourceAlg));
+  if (!hasWorkspaceProperty(targetAlg, inputProperty))
+    throw std::invalid_argument(inputProperty +
+                                " is not a workspace property of " +
+                                describe(target, targetAlg));
+  addDependency(source, target);
+  m_steps[target].inputs.push_back(Link{source, outputProperty, inputProperty});
+}
+
+/** Make one step wait for another without passing any workspace.
+ * @param before :: the step to run first
+ * @param after :: the step to run once before has finished
+ * @throws std::out_of_range if a step does not exist
+ */
+void AlgorithmGraph::addDependency(size_t before, size_t after) {
+  checkStep(before);
+  checkStep(after);
+  m_steps[before].dependents.push_back(after);
+  ++m_steps[after].numDependencies;
+}
+
+/** @param step :: index of a step
+ * @return the algorithm of the step, e.g. to retrieve its outputs after
+ * execution
+ * @throws std::out_of_range if the step does not exist
+ */
+IAlgorithm_sptr AlgorithmGraph::algorithm(size_t step) const {
+  checkStep(step);
+  return m_steps[step].algorithm;
+}
+
+/** Run all steps, each as soon as the steps it depends on have finished.
+ * @param numThreads :: maximum number of steps to run at once; 0 to use as
+ *        many as there are cores (and threads left in the ThreadBudget)
+ * @throws std::runtime_error if the graph has a cycle or a step fails
+ */
+void AlgorithmGraph::execute(size_t numThreads) {
+  checkAcyclic();
+  std::vector<std::atomic<size_t>> waiting(m_steps.size());
+  for (size_t i = 0; i < m_steps.size(); ++i)
+    waiting[i] = m_steps[i].numDependencies;
+
+  auto scheduler = new ThreadSchedulerWorkStealing(numThreads);
+  ThreadPool pool(scheduler, numThreads);
+  for (size_t i = 0; i < m_steps.size(); ++i) {
+    if (m_steps[i].numDependencies == 0)
+      pool.schedule(new StepTask(*this, i, waiting, *scheduler));
+  }
+  // Rethrows the first exception thrown by a step
+  pool.joinAll();
+}
+
+/// @throws std::out_of_range if step does not exist
+void AlgorithmGraph::checkStep(size_t step) const {
+  if (step >= m_steps.size())
+    throw std::out_of_range("AlgorithmGraph has no step " +
+                            std::to_string(step));
+}
+
+/// @throws std::runtime_error if the steps cannot all be run because some of
+/// them depend on each other in a cycle
+void AlgorithmGraph::checkAcyclic() const {
+  std::vector<size_t> waiting(m_steps.size());
+  std::vector<size_t> ready;
+  for (size_t i = 0; i < m_steps.size(); ++i) {
+    waiting[i] = m_steps[i].numDependencies;
+    if (waiting[i] == 0)
+      ready.push_back(i);
+  }
+  size_t numReached(0);
+  while (!ready.empty()) {
+    const size_t step = ready.back();
+    ready.pop_back();
+    ++numReached;
+    for (const auto dependent : m_steps[step].dependents) {
+      if (--waiting[dependent] == 0)
+        ready.push_back(dependent);
+    }
+  }
+  if (numReached != m_steps.size())
+    throw std::runtime_error("AlgorithmGraph has circular dependencies");
+}
+
+/** Set the inputs of a step from the outputs of the steps it depends on and
+ * execute it.
+ * @param step :: index of the step
+ * @throws std::runtime_error if the step fails
+ */
+void AlgorithmGraph::runStep(size_t step) const {
+  const auto &current = m_steps[step];
+  auto &algorithm = *current.algorithm;
+  if (current.prepare)
+    current.prepare(algorithm);
+  for (const auto &link : current.inputs)
+    algorithm.setProperty(link.inputProperty, output(link));
+  algorithm.execute();
+  if (!algorithm.isExecuted())
+    throw std::runtime_error(describe(step, algorithm) +
+                             " of AlgorithmGraph failed to execute");
+}
+
+/// @return the workspace produced for a link by its source step
+Workspace_sptr AlgorithmGraph::output(const Link &link) const {
+  const auto &source = *m_steps[link.source].algorithm;
+  const auto property = dynamic_cast<IWorkspaceProperty *>(
+      source.getPointerToProperty(link.outputProperty));
+  auto workspace = property->getWorkspace();
+  if (!workspace)
+    throw std::runtime_error(describe(link.source, source) +
+                             " did not set its output " + link.outputProperty);
+  return workspace;
+}
+
+} // namespace API
+} // namespace Mantid
@@ -9,7 +9,13 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/Algorithm.h"
+
+#include <boost/functional/hash.hpp>
+#include <boost/weak_ptr.hpp>
+
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 
 namespace Mantid {
 namespace API {
@@ -21,6 +27,66 @@ using Kernel::PropertyHistory_const_sptr;
 using Kernel::PropertyHistory_sptr;
 using Types::Core::DateAndTime;
 
+namespace {
+/** Pool of the property histories in use. Algorithms that are run many times
+ * with mostly the same property values, e.g. in a loop or by live data
+ * processing, then share the PropertyHistory objects for those values
+ * instead of each keeping a copy.
+ */
+class PropertyHistoryPool {
+public:
+  /// @return a property history equal to history, shared if possible
+  PropertyHistory_sptr intern(const PropertyHistory &history) {
+    const auto hash = hashOf(history);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto range = m_pool.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      auto pooled = it->second.lock();
+      if (pooled && *pooled == history &&
+          pooled->direction() == history.direction())
+        return pooled;
+    }
+    auto interned = boost::make_shared<PropertyHistory>(history);
+    m_pool.emplace(hash, interned);
+    if (m_pool.size() >= m_pruneSize)
+      prune();
+    return interned;
+  }
+
+private:
+  static size_t hashOf(const PropertyHistory &history) {
+    size_t hash = 0;
+    boost::hash_combine(hash, history.name());
+    boost::hash_combine(hash, history.value());
+    boost::hash_combine(hash, history.type());
+    boost::hash_combine(hash, history.isDefault());
+    boost::hash_combine(hash, history.direction());
+    return hash;
+  }
+
+  /// Forget the histories that are no longer used
+  void prune() {
+    for (auto it = m_pool.begin(); it != m_pool.end();) {
+      if (it->second.expired())
+        it = m_pool.erase(it);
+      else
+        ++it;
+    }
+    m_pruneSize = std::max(size_t{1024}, 2 * m_pool.size());
+  }
+
+  std::mutex m_mutex;
+  std::unordered_multimap<size_t, boost::weak_ptr<PropertyHistory>> m_pool;
+  /// Size of the pool at which it is next pruned
+  size_t m_pruneSize{1024};
+};
+
+PropertyHistory_sptr intern(const PropertyHistory &history) {
+  static PropertyHistoryPool pool;
+  return pool.intern(history);
+}
+} // namespace
+
 /** Constructor
  *  @param alg ::      A pointer to the algorithm for which the history should
  * be constructed
@@ -73,9 +139,26 @@ void AlgorithmHistory::setProperties(const Algorithm *const alg) {
   // Now go through the algorithm's properties and create the PropertyHistory
   // objects.
   const std::vector<Property *> &properties = alg->getProperties();
+  m_properties.reserve(properties.size());
   for (const auto &property : properties) {
-    m_properties.push_back(
-        boost::make_shared<PropertyHistory>(property->createHistory()));
+    m_properties.push_back(intern(property->createHistory()));
+  }
+}
+
+/** Change the recorded value of a property, e.g. to replace a temporary
+ * workspace name.
+ * @param name :: The name of the property
+ * @param value :: The new value
+ */
+void AlgorithmHistory::setPropertyValue(const std::string &name,
+                                        const std::string &value) {
+  for (auto &property : m_properties) {
+    if (property->name() == name) {
+      property = intern(PropertyHistory(name, value, property->type(),
+                                        property->isDefault(),
+                                        property->direction()));
+      return;
+    }
   }
 }
 
@@ -130,8 +213,8 @@ void AlgorithmHistory::addExecutionInfo(const DateAndTime &start,
 void AlgorithmHistory::addProperty(const std::string &name,
                                    const std::string &value, bool isdefault,
                                    const unsigned int &direction) {
-  m_properties.push_back(boost::make_shared<PropertyHistory>(
-      name, value, "", isdefault, direction));
+  m_properties.push_back(
+      intern(PropertyHistory(name, value, "", isdefault, direction)));
 }
 
 /** Add a child algorithm history to history
@@ -13,6 +13,8 @@
 #include "MantidAPI/AlgorithmProxy.h"
 #include "MantidKernel/ConfigService.h"
 
+#include <typeinfo>
+
 namespace Mantid {
 namespace API {
 namespace {
@@ -54,6 +56,59 @@ Algorithm_sptr AlgorithmManagerImpl::createUnmanaged(const std::string &algName,
                                              version); // Throws on fail:
 }
 
+/** Creates an instance of an algorithm, but does not own that instance, and
+ * initializes it by copying the properties of a prototype instead of calling
+ * its init() method. The prototype is created and initialized the first time
+ * an algorithm and version is requested.
+ *
+ * This saves declaring the properties and building their validators when the
+ * same algorithm is created many times, e.g. in a loop over spectra. It is
+ * only correct for algorithms whose init() does nothing but declare
+ * properties, see Algorithm::supportsInitializationFromPrototype. Other
+ * algorithms are initialized by calling init().
+ *
+ *  @param  algName :: The name of the algorithm required
+ *  @param  version :: The version of the algorithm required, if not defined
+ *most recent version is used -> version =-1
+ *  @param  lightweight :: If true, the algorithm does not log and executes in
+ *lightweight mode, see Algorithm::setLightweightExecution
+ *  @return A pointer to the created algorithm
+ *  @throw  std::runtime_error Thrown if algorithm requested is not registered
+ */
+Algorithm_sptr AlgorithmManagerImpl::createFromPrototype(
+    const std::string &algName, const int &version, bool lightweight) {
+  auto &factory = AlgorithmFactory::Instance();
+  Algorithm_sptr alg = factory.create(algName, version); // Throws on fail:
+  if (lightweight) {
+    alg->setLogging(false);
+    alg->setLightweightExecution(true);
+  }
+  if (!alg->supportsInitializationFromPrototype()) {
+    alg->initialize();
+    return alg;
+  }
+
+  const auto key = std::make_pair(algName, alg->version());
+  boost::shared_ptr<const Algorithm> prototype;
+  {
+    std::lock_guard<std::mutex> _lock(m_prototypesMutex);
+    auto it = m_prototypes.find(key);
+    // The algorithm may have been registered again, e.g. by reloading plugins
+    if (it != m_prototypes.end() && typeid(*it->second) == typeid(*alg))
+      prototype = it->second;
+  }
+  if (!prototype) {
+    Algorithm_sptr newPrototype = factory.create(algName, key.second);
+    newPrototype->initialize();
+    prototype = newPrototype;
+    std::lock_guard<std::mutex> _lock(m_prototypesMutex);
+    m_prototypes[key] = prototype;
+  }
+
+  alg->initializeFromPrototype(*prototype);
+  return alg;
+}
+
 /** Creates and initialises an instance of an algorithm.
  *
  * The algorithm gets tracked in the list of "managed" algorithms,
@@ -125,9 +180,14 @@ IAlgorithm_sptr AlgorithmManagerImpl::create(const std::string &algName,
 }
 
 /**
- * Clears all managed algorithm objects that are not currently running.
+ * Clears all managed algorithm objects that are not currently running and the
+ * prototypes used by createFromPrototype.
  */
 void AlgorithmManagerImpl::clear() {
+  {
+    std::lock_guard<std::mutex> _lock(this->m_prototypesMutex);
+    m_prototypes.clear();
+  }
   std::lock_guard<std::mutex> _lock(this->m_managedMutex);
   for (auto itAlg = m_managed_algs.begin(); itAlg != m_managed_algs.end();) {
     if (!(*itAlg)->isRunning()) {
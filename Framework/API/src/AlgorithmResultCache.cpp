@@ -0,0 +1,509 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/AlgorithmResultCache.h"
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/FileProperty.h"
+#include "MantidAPI/IEventList.h"
+#include "MantidAPI/IEventWorkspace.h"
+#include "MantidAPI/IWorkspaceProperty.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/Sample.h"
+#include "MantidAPI/WorkspaceGroup.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidGeometry/Crystal/OrientedLattice.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidKernel/Material.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/StringTokenizer.h"
+#include "MantidKernel/Unit.h"
+
+#include <Poco/DigestEngine.h>
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <Poco/SHA1Engine.h>
+
+#include <json/json.h>
+
+#include <fstream>
+
+using namespace Mantid::Kernel;
+
+namespace Mantid {
+namespace API {
+namespace {
+/// static logger
+Kernel::Logger g_log("AlgorithmResultCache");
+
+/// Default memory limit if algorithms.resultcache.memorymb is not set
+constexpr size_t DEFAULT_MEMORY_LIMIT_MB = 1024;
+
+void addString(Poco::SHA1Engine &sha1, const std::string &value) {
+  // Include the length so that consecutive strings cannot run into each other
+  const auto length = static_cast<uint64_t>(value.size());
+  sha1.update(&length, sizeof(length));
+  sha1.update(value);
+}
+
+template <typename T>
+void addVector(Poco::SHA1Engine &sha1, const std::vector<T> &values) {
+  const auto length = static_cast<uint64_t>(values.size());
+  sha1.update(&length, sizeof(length));
+  if (!values.empty())
+    sha1.update(values.data(), values.size() * sizeof(T));
+}
+
+void addPosition(Poco::SHA1Engine &sha1, const V3D &position) {
+  const double xyz[] = {position.X(), position.Y(), position.Z()};
+  sha1.update(xyz, sizeof(xyz));
+}
+
+void addMatrix(Poco::SHA1Engine &sha1, const DblMatrix &matrix) {
+  addVector(sha1, matrix.getVector());
+}
+
+/** Add everything the result of an algorithm may depend on in a workspace,
+ * except its name and history.
+ * @param sha1 :: the hash to add to
+ * @param ws :: the workspace
+ * @return false if the workspace cannot be cached: its detectors scan or its
+ * sample shape cannot be written out
+ */
+bool addWorkspace(Poco::SHA1Engine &sha1, const MatrixWorkspace &ws) {
+  const auto &detectorInfo = ws.detectorInfo();
+  if (detectorInfo.isScanning())
+    return false;
+  const auto &sample = ws.sample();
+  const auto shape =
+      dynamic_cast<const Geometry::CSGObject *>(&sample.getShape());
+  if (!shape)
+    return false;
+
+  addString(sha1, ws.id());
+  addString(sha1, ws.YUnit());
+  addString(sha1, ws.isDistribution() ? "distribution" : "counts");
+  const auto unit = ws.getAxis(0)->unit();
+  addString(sha1, unit ? unit->unitID() : "");
+
+  const auto eventWS = dynamic_cast<const IEventWorkspace *>(&ws);
+  std::vector<double> events;
+  std::vector<int64_t> pulseTimes;
+  const size_t numHistograms = ws.getNumberHistograms();
+  for (size_t i = 0; i < numHistograms; ++i) {
+    const auto &spectrum = ws.getSpectrum(i);
+    const auto spectrumNo = static_cast<int64_t>(spectrum.getSpectrumNo());
+    sha1.update(&spectrumNo, sizeof(spectrumNo));
+    const auto &detIDs = spectrum.getDetectorIDs();
+    addVector(sha1, std::vector<detid_t>(detIDs.begin(), detIDs.end()));
+    addVector(sha1, ws.x(i).rawData());
+    if (eventWS) {
+      // Histogrammed values do not distinguish events within one bin
+      const auto &eventList = eventWS->getSpectrum(i);
+      eventList.getTofs(events);
+      addVector(sha1, events);
+      eventList.getWeights(events);
+      addVector(sha1, events);
+      pulseTimes.clear();
+      for (const auto &time : eventList.getPulseTimes())
+        pulseTimes.push_back(time.totalNanoseconds());
+      addVector(sha1, pulseTimes);
+    } else {
+      addVector(sha1, ws.y(i).rawData());
+      addVector(sha1, ws.e(i).rawData());
+    }
+    std::vector<double> masks;
+    if (ws.hasMaskedBins(i)) {
+      for (const auto &mask : ws.maskedBins(i)) {
+        masks.push_back(static_cast<double>(mask.first));
+        masks.push_back(mask.second);
+      }
+    }
+    addVector(sha1, masks);
+  }
+  if (ws.axes() > 1 && !ws.getAxis(1)->isSpectra()) {
+    const auto axis = ws.getAxis(1);
+    addString(sha1, axis->unit() ? axis->unit()->unitID() : "");
+    for (size_t i = 0; i < axis->length(); ++i)
+      addString(sha1, axis->label(i));
+  }
+
+  addString(sha1, ws.getInstrument()->getName());
+  const auto &componentInfo = ws.componentInfo();
+  addPosition(sha1, componentInfo.hasSource() ? componentInfo.sourcePosition()
+                                              : V3D());
+  addPosition(sha1, componentInfo.hasSample() ? componentInfo.samplePosition()
+                                              : V3D());
+  std::vector<double> positions;
+  positions.reserve(4 * detectorInfo.size());
+  for (size_t i = 0; i < detectorInfo.size(); ++i) {
+    const auto position = detectorInfo.position(i);
+    positions.push_back(position.X());
+    positions.push_back(position.Y());
+    positions.push_back(position.Z());
+    positions.push_back(detectorInfo.isMasked(i) ? 1. : 0.);
+  }
+  addVector(sha1, positions);
+  addString(sha1, ws.constInstrumentParameters().asString());
+
+  addString(sha1, shape->getShapeXML());
+  const auto material = sample.getMaterial();
+  addString(sha1, material.name());
+  const double materialValues[] = {
+      material.numberDensity(),        material.temperature(),
+      material.pressure(),             material.cohScatterXSection(),
+      material.incohScatterXSection(), material.absorbXSection()};
+  sha1.update(materialValues, sizeof(materialValues));
+  if (sample.hasOrientedLattice())
+    addMatrix(sha1, sample.getOrientedLattice().getUB());
+  else
+    addMatrix(sha1, DblMatrix());
+
+  const auto &run = ws.run();
+  addMatrix(sha1, run.getGoniometerMatrix());
+  for (const auto log : run.getProperties()) {
+    addString(sha1, log->name());
+    addString(sha1, log->value());
+  }
+  return true;
+}
+
+/// Drop the history a cached workspace was stored with, so that the one
+/// recorded for the current run is all it has
+void clearHistory(Workspace &ws) {
+  ws.history().clearHistory();
+  if (auto group = dynamic_cast<WorkspaceGroup *>(&ws)) {
+    for (size_t i = 0; i < group->size(); ++i)
+      group->getItem(i)->history().clearHistory();
+  }
+}
+
+/// @return the workspace of a workspace property, which may be null
+Workspace_sptr workspaceOf(const Property &property) {
+  const auto wsProp = dynamic_cast<const IWorkspaceProperty *>(&property);
+  return wsProp ? wsProp->getWorkspace() : Workspace_sptr();
+}
+
+/// @return a path in the cache directory
+std::string cachePath(const std::string &directory, const std::string &name) {
+  Poco::Path path(directory);
+  path.append(name);
+  return path.toString();
+}
+} // namespace
+
+/// Private Constructor for singleton class
+AlgorithmResultCacheImpl::AlgorithmResultCacheImpl()
+    : m_memoryLimit(DEFAULT_MEMORY_LIMIT_MB * 1024 * 1024), m_memoryUsed(0) {
+  auto &config = ConfigService::Instance();
+  StringTokenizer names(config.getString("algorithms.resultcache.names"), ",",
+                        StringTokenizer::TOK_TRIM |
+                            StringTokenizer::TOK_IGNORE_EMPTY);
+  m_names.insert(names.begin(), names.end());
+  const auto memoryMB =
+      config.getValue<double>("algorithms.resultcache.memorymb");
+  if (memoryMB)
+    m_memoryLimit = static_cast<size_t>(memoryMB.get() * 1024 * 1024);
+  m_directory = config.getString("algorithms.resultcache.directory");
+}
+
+/** Set the algorithms whose results are cached, replacing any set before.
+ * @param names :: names of the algorithms; empty to cache nothing
+ */
+void AlgorithmResultCacheImpl::setCachedAlgorithms(
+    const std::vector<std::string> &names) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_names = std::unordered_set<std::string>(names.begin(), names.end());
+}
+
+/// @return true if the results of the named algorithm are cached
+bool AlgorithmResultCacheImpl::isCached(
+    const std::string &algorithmName) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_names.count(algorithmName) > 0;
+}
+
+/** Set how much memory the cached workspaces may use. Entries beyond it are
+ * dropped, least recently used first.
+ * @param bytes :: the limit in bytes
+ */
+void AlgorithmResultCacheImpl::setMemoryLimit(size_t bytes) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_memoryLimit = bytes;
+  while (m_memoryUsed > m_memoryLimit && !m_recent.empty()) {
+    const auto &entry = m_entries.at(m_recent.back());
+    m_memoryUsed -= entry.bytes;
+    m_entries.erase(m_recent.back());
+    m_recent.pop_back();
+  }
+}
+
+/** Set the directory results are also saved to and loaded from.
+ * @param directory :: path of the directory; empty to keep results in memory
+ *        only
+ */
+void AlgorithmResultCacheImpl::setDirectory(const std::string &directory) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_directory = directory;
+}
+
+/** Compute the key of a run of an algorithm whose properties are all set.
+ * @param alg :: the algorithm about to run
+ * @return the key, or an empty string if the results of the algorithm are not
+ * cached or cannot be cached with these inputs
+ */
+std::string AlgorithmResultCacheImpl::key(const Algorithm &alg) const {
+  if (!isCached(alg.name()))
+    return "";
+
+  Poco::SHA1Engine sha1;
+  addString(sha1, alg.name());
+  addString(sha1, std::to_string(alg.version()));
+  for (const auto property : alg.getProperties()) {
+    if (property->direction() == Direction::Output)
+      continue;
+    const bool isWorkspace =
+        dynamic_cast<const IWorkspaceProperty *>(property) != nullptr;
+    if (isWorkspace && property->direction() == Direction::InOut) {
+      g_log.debug() << alg.name() << " modifies " << property->name()
+                    << " in place, so its results are not cached.\n";
+      return "";
+    }
+    addString(sha1, property->name());
+    if (!isWorkspace) {
+      addString(sha1, property->value());
+      const auto fileProperty = dynamic_cast<const FileProperty *>(property);
+      if (fileProperty && fileProperty->isLoadProperty() &&
+          !property->value().empty()) {
+        const Poco::File file(property->value());
+        if (file.exists()) {
+          const auto modified = file.getLastModified().epochMicroseconds();
+          const auto size = static_cast<uint64_t>(file.getSize());
+          sha1.update(&modified, sizeof(modified));
+          sha1.update(&size, sizeof(size));
+        }
+      }
+      continue;
+    }
+    const auto ws = workspaceOf(*property);
+    if (!ws) {
+      addString(sha1, "");
+      continue;
+    }
+    const auto matrixWS = dynamic_cast<const MatrixWorkspace *>(ws.get());
+    if (!matrixWS) {
+      g_log.debug() << property->name() << " of " << alg.name()
+                    << " is not a MatrixWorkspace, so the results are not "
+                       "cached.\n";
+      return "";
+    }
+    if (!addWorkspace(sha1, *matrixWS)) {
+      g_log.debug() << property->name() << " of " << alg.name()
+                    << " has scanning detectors or a sample shape that is not "
+                       "CSG, so the results are not cached.\n";
+      return "";
+    }
+  }
+  return alg.name() + "-" + Poco::DigestEngine::digestToHex(sha1.digest());
+}
+
+/** Set the outputs of an algorithm from the cache, if they are there.
+ * @param alg :: the algorithm about to run
+ * @param key :: the key returned by key()
+ * @return true if the outputs were restored
+ */
+bool AlgorithmResultCacheImpl::restore(Algorithm &alg, const std::string &key) {
+  Entry entry;
+  bool found = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      m_recent.splice(m_recent.begin(), m_recent, it->second.recent);
+      entry = it->second;
+      found = true;
+    }
+  }
+  if (!found) {
+    if (!load(key, entry))
+      return false;
+    insert(key, entry);
+  }
+
+  for (const auto &output : entry.workspaces) {
+    Workspace_sptr ws(output.second->clone());
+    clearHistory(*ws);
+    alg.setProperty(output.first, ws);
+  }
+  for (const auto &output : entry.values)
+    alg.setPropertyValue(output.first, output.second);
+  g_log.information() << alg.name() << " results restored from the cache.\n";
+  return true;
+}
+
+/** Store copies of the outputs of an algorithm that has just run.
+ * @param alg :: the algorithm
+ * @param key :: the key returned by key() before it ran
+ */
+void AlgorithmResultCacheImpl::store(const Algorithm &alg,
+                                     const std::string &key) {
+  Entry entry;
+  entry.bytes = 0;
+  for (const auto property : alg.getProperties()) {
+    if (property->direction() != Direction::Output)
+      continue;
+    if (dynamic_cast<const IWorkspaceProperty *>(property)) {
+      if (const auto ws = workspaceOf(*property)) {
+        entry.workspaces.emplace_back(property->name(),
+                                      Workspace_sptr(ws->clone()));
+        entry.bytes += ws->getMemorySize();
+      }
+    } else {
+      entry.values.emplace_back(property->name(), property->value());
+    }
+  }
+  insert(key, entry);
+  save(key, entry);
+}
+
+/// Drop all entries held in memory. Entries saved to disk are kept.
+void AlgorithmResultCacheImpl::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+  m_recent.clear();
+  m_memoryUsed = 0;
+}
+
+/// @return the number of entries held in memory
+size_t AlgorithmResultCacheImpl::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// @return the memory used by the workspaces held in memory, in bytes
+size_t AlgorithmResultCacheImpl::memoryUsed() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_memoryUsed;
+}
+
+/// Add an entry in memory, dropping the least recently used ones to stay
+/// within the memory limit
+void AlgorithmResultCacheImpl::insert(const std::string &key, Entry entry) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (entry.bytes > m_memoryLimit || m_entries.count(key) > 0)
+    return;
+  while (m_memoryUsed + entry.bytes > m_memoryLimit) {
+    const auto &oldest = m_entries.at(m_recent.back());
+    m_memoryUsed -= oldest.bytes;
+    m_entries.erase(m_recent.back());
+    m_recent.pop_back();
+  }
+  m_recent.push_front(key);
+  entry.recent = m_recent.begin();
+  m_memoryUsed += entry.bytes;
+  m_entries.emplace(key, std::move(entry));
+}
+
+/** Load an entry from the cache directory.
+ * @param key :: key of the entry
+ * @param entry :: filled with the entry
+ * @return true if the entry was found and loaded
+ */
+bool AlgorithmResultCacheImpl::load(const std::string &key,
+                                    Entry &entry) const {
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    directory = m_directory;
+  }
+  if (directory.empty())
+    return false;
+  std::ifstream index(cachePath(directory, key + ".json"));
+  if (!index)
+    return false;
+
+  try {
+    ::Json::Value contents;
+    ::Json::Reader reader;
+    if (!reader.parse(index, contents))
+      return false;
+    entry.bytes = 0;
+    for (const auto &output : contents["workspaces"]) {
+      auto loader =
+          AlgorithmManager::Instance().createUnmanaged("LoadNexusProcessed");
+      loader->setChild(true);
+      loader->setLogging(false);
+      loader->initialize();
+      loader->setPropertyValue(
+          "Filename", cachePath(directory, output["file"].asString()));
+      loader->setPropertyValue("OutputWorkspace", "__cached");
+      loader->execute();
+      auto ws = workspaceOf(*loader->getPointerToProperty("OutputWorkspace"));
+      entry.bytes += ws->getMemorySize();
+      entry.workspaces.emplace_back(output["property"].asString(),
+                                    std::move(ws));
+    }
+    const auto &values = contents["values"];
+    for (const auto &name : values.getMemberNames())
+      entry.values.emplace_back(name, values[name].asString());
+  } catch (std::exception &e) {
+    g_log.warning() << "Cannot load cached results " << key << ": " << e.what()
+                    << '\n';
+    return false;
+  }
+  return true;
+}
+
+/// Save an entry to the cache directory, if there is one
+void AlgorithmResultCacheImpl::save(const std::string &key,
+                                    const Entry &entry) const {
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    directory = m_directory;
+  }
+  if (directory.empty())
+    return;
+
+  try {
+    ::Json::Value contents;
+    contents["workspaces"] = ::Json::Value(::Json::arrayValue);
+    for (size_t i = 0; i < entry.workspaces.size(); ++i) {
+      const auto file = key + "-" + std::to_string(i) + ".nxs";
+      auto saver =
+          AlgorithmManager::Instance().createUnmanaged("SaveNexusProcessed");
+      saver->setChild(true);
+      saver->setLogging(false);
+      saver->initialize();
+      saver->setProperty("InputWorkspace", entry.workspaces[i].second);
+      saver->setPropertyValue("Filename", cachePath(directory, file));
+      saver->execute();
+      ::Json::Value output;
+      output["property"] = entry.workspaces[i].first;
+      output["file"] = file;
+      contents["workspaces"].append(output);
+    }
+    contents["values"] = ::Json::Value(::Json::objectValue);
+    for (const auto &value : entry.values)
+      contents["values"][value.first] = value.second;
+    // Written last, so that an entry is only found once it is complete
+    std::ofstream index(cachePath(directory, key + ".json"));
+    index << ::Json::FastWriter().write(contents);
+  } catch (std::exception &e) {
+    g_log.warning() << "Cannot save results " << key << " to the cache: "
+                    << e.what() << '\n';
+  }
+}
+
+} // namespace API
+} // namespace Mantid
@@ -12,6 +12,7 @@
 #include "MantidAPI/Run.h"
 #include "MantidAPI/Sample.h"
 #include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/WorkspaceNearestNeighbours.h"
 
 #include "MantidGeometry/Crystal/OrientedLattice.h"
 #include "MantidGeometry/ICompAssembly.h"
@@ -73,7 +74,8 @@ Kernel::Logger g_log("ExperimentInfo");
  */
 ExperimentInfo::ExperimentInfo()
     : m_moderatorModel(), m_choppers(), m_parmap(new ParameterMap()),
-      sptr_instrument(new Instrument()) {
+      sptr_instrument(new Instrument()),
+      m_nearestNeighbourCache(boost::make_shared<NearestNeighbourCache>()) {
   m_parmap->setInstrument(sptr_instrument.get());
 }
 
@@ -104,6 +106,9 @@ void ExperimentInfo::copyExperimentInfoFrom(const ExperimentInfo *other) {
   for (const auto &chopper : other->m_choppers) {
     m_choppers.push_back(chopper->clone());
   }
+  // Cached tables are validated against the detector positions when used, so
+  // the cache can be shared.
+  m_nearestNeighbourCache = other->m_nearestNeighbourCache;
   // We do not copy Beamline::SpectrumInfo (which contains detector grouping
   // information) for now:
   // - For MatrixWorkspace, grouping information is still stored in ISpectrum
@@ -1053,6 +1058,14 @@ Geometry::DetectorInfo &ExperimentInfo::mutableDetectorInfo() {
   return m_parmap->mutableDetectorInfo();
 }
 
+/** Return a reference to the cache of nearest-neighbour tables used by
+ * WorkspaceNearestNeighbourInfo. The cache is shared between copies of this
+ * object and may be used concurrently.
+ */
+NearestNeighbourCache &ExperimentInfo::nearestNeighbourCache() const {
+  return *m_nearestNeighbourCache;
+}
+
 /** Return a reference to the SpectrumInfo object.
  *
  * Any modifications of the instrument or instrument parameters will invalidate
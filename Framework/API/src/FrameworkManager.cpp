@@ -11,10 +11,12 @@
 #include "MantidAPI/WorkspaceGroup.h"
 
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/ExecutionProfiler.h"
 #include "MantidKernel/LibraryManager.h"
 #include "MantidKernel/Memory.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyManagerDataService.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/UsageService.h"
 
 #include <boost/algorithm/string/split.hpp>
@@ -132,6 +134,7 @@ FrameworkManagerImpl::FrameworkManagerImpl()
   loadPlugins();
   disableNexusOutput();
   setNumOMPThreadsToConfigValue();
+  setupProfiling();
 
 #ifdef MPI_BUILD
   g_log.notice() << "This MPI process is rank: "
@@ -169,6 +172,7 @@ void FrameworkManagerImpl::setNumOMPThreadsToConfigValue() {
 void FrameworkManagerImpl::setNumOMPThreads(const int nthreads) {
   g_log.debug() << "Setting maximum number of threads to " << nthreads << "\n";
   PARALLEL_SET_NUM_THREADS(nthreads);
+  Kernel::ThreadBudget::setCapacity(static_cast<size_t>(nthreads));
   static tbb::task_scheduler_init m_init{nthreads};
 }
 
@@ -194,6 +198,18 @@ void FrameworkManagerImpl::clear() {
 
 void FrameworkManagerImpl::shutdown() {
   Kernel::UsageService::Instance().shutdown();
+  auto &profiler = Kernel::ExecutionProfiler::Instance();
+  if (profiler.isEnabled()) {
+    const auto traceFile = Kernel::ConfigService::Instance().getString(
+        "profiler.tracefile");
+    try {
+      profiler.saveChromeTrace(traceFile);
+      g_log.notice() << "Execution profile written to " << traceFile << '\n';
+    } catch (std::runtime_error &e) {
+      g_log.error() << e.what() << '\n';
+    }
+    profiler.setEnabled(false);
+  }
   clear();
 }
 
@@ -464,6 +480,15 @@ void FrameworkManagerImpl::setupUsageReporting() {
   usageSvc.registerStartup();
 }
 
+void FrameworkManagerImpl::setupProfiling() {
+  const auto traceFile =
+      Kernel::ConfigService::Instance().getString("profiler.tracefile");
+  if (!traceFile.empty()) {
+    g_log.notice() << "Profiling execution to " << traceFile << '\n';
+    Kernel::ExecutionProfiler::Instance().setEnabled(true);
+  }
+}
+
 /// Update instrument definitions from github
 void FrameworkManagerImpl::updateInstrumentDefinitions() {
   try {
@@ -20,6 +20,7 @@
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidGeometry/MDGeometry/GeneralFrame.h"
 #include "MantidGeometry/MDGeometry/MDFrame.h"
+#include "MantidHistogramData/Rebin.h"
 #include "MantidIndexing/GlobalSpectrumIndex.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/MDUnit.h"
@@ -1006,6 +1007,64 @@ bool MatrixWorkspace::isCommonBins() const {
   return m_isCommonBinsFlag;
 }
 
+/**
+ * Returns the X data of the workspace if all spectra have identical X values,
+ * typically because they share the same data. Algorithms can then compute
+ * quantities depending only on X once, and process the Y and E data of all
+ * spectra as a block. The result is cached and is invalidated together with
+ * isCommonBins(), e.g., by setSharedX() or any other non-const access to a
+ * spectrum.
+ * @return the X data common to all spectra, or null if there is none
+ */
+Kernel::cow_ptr<HistogramData::HistogramX> MatrixWorkspace::commonX() const {
+  const size_t numHist = getNumberHistograms();
+  if (numHist == 0)
+    return Kernel::cow_ptr<HistogramData::HistogramX>(nullptr);
+  if (!m_isCommonXSet) {
+    std::lock_guard<std::mutex> lock(m_commonXMutex);
+    if (!m_isCommonXSet) {
+      bool isCommon = true;
+      const auto &first = x(0);
+      for (size_t i = 1; i < numHist && isCommon; ++i) {
+        // Comparing the address first makes this cheap for shared data
+        const auto &current = x(i);
+        isCommon = &current == &first || current.rawData() == first.rawData();
+      }
+      m_isCommonX = isCommon;
+      m_isCommonXSet = true;
+    }
+  }
+  if (!m_isCommonX)
+    return Kernel::cow_ptr<HistogramData::HistogramX>(nullptr);
+  return sharedX(0);
+}
+
+/**
+ * Returns an operator rebinning the histograms of all spectra to binEdges,
+ * with the bin overlaps computed once. The last operator is cached, so
+ * algorithms rebinning the same workspace repeatedly to the same bins reuse
+ * it, as long as the X data of the workspace is not modified.
+ * @param binEdges :: the bin edges to rebin to
+ * @return the operator, or null if the spectra do not have common bin edges
+ * @throws InvalidBinEdgesError for non-positive input/output bin widths
+ */
+boost::shared_ptr<const HistogramData::RebinOperator>
+MatrixWorkspace::rebinOperator(const HistogramData::BinEdges &binEdges) const {
+  const auto x = commonX();
+  if (!x || !isHistogramData())
+    return nullptr;
+  std::lock_guard<std::mutex> lock(m_rebinOperatorMutex);
+  if (m_rebinOperator && m_rebinOperator->inputBinEdges().cowData() == x) {
+    const auto &cachedEdges = m_rebinOperator->outputBinEdges();
+    if (cachedEdges.cowData() == binEdges.cowData() ||
+        cachedEdges.rawData() == binEdges.rawData())
+      return m_rebinOperator;
+  }
+  m_rebinOperator = boost::make_shared<const HistogramData::RebinOperator>(
+      HistogramData::BinEdges(x), binEdges);
+  return m_rebinOperator;
+}
+
 /** Called by the algorithm MaskBins to mask a single bin for the first time,
  * algorithms that later propagate the
  *  the mask from an input to the output should call flagMasked() instead. Here
@@ -8,18 +8,47 @@
 #include "MantidAPI/ExperimentInfo.h"
 #include "MantidAPI/SpectrumInfoIterator.h"
 #include "MantidBeamline/SpectrumInfo.h"
+#include "MantidBeamline/DetectorInfo.h"
+#include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/DetectorGroup.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/make_unique.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
 #include <algorithm>
 #include <boost/make_shared.hpp>
+#include <cmath>
+#include <limits>
 
 namespace Mantid {
 namespace API {
 
+/** Geometry of all spectra, computed in bulk by SpectrumInfo.
+ *
+ * Besides the values this stores the state of the beamline they were computed
+ * for. Holding a copy of the shared spectrum definitions makes any subsequent
+ * change of the grouping detach the definitions held by Beamline::SpectrumInfo,
+ * which is detected by comparing the pointers. */
+struct SpectrumInfo::GeometryCache {
+  Kernel::cow_ptr<std::vector<SpectrumDefinition>> spectrumDefinitions{
+      nullptr};
+  size_t positionRevision{0};
+  Kernel::V3D sourcePosition;
+  Kernel::V3D samplePosition;
+  /// False if source and sample are at the same position.
+  bool hasBeamDirection{false};
+
+  std::vector<double> l2;
+  std::vector<double> twoTheta;
+  std::vector<double> signedTwoTheta;
+  std::vector<double> azimuthal;
+  std::vector<double> difc;
+  std::vector<Kernel::V3D> position;
+};
+
 SpectrumInfo::SpectrumInfo(const Beamline::SpectrumInfo &spectrumInfo,
                            const ExperimentInfo &experimentInfo,
                            Geometry::DetectorInfo &detectorInfo)
@@ -121,6 +150,55 @@ bool SpectrumInfo::hasUniqueDetector(const size_t index) const {
   return spectrumDefinition(index).size() == 1;
 }
 
+/** Returns L2 of all spectra, see l2().
+ *
+ * Entries for spectra without detectors are NaN. */
+const std::vector<double> &SpectrumInfo::l2s() const {
+  return geometryCache().l2;
+}
+
+/** Returns the scattering angle 2 theta in radians of all spectra, see
+ * twoTheta().
+ *
+ * Entries for spectra without detectors or containing monitors are NaN. Throws
+ * if source and sample are at the same position. */
+const std::vector<double> &SpectrumInfo::twoThetas() const {
+  return angularGeometryCache().twoTheta;
+}
+
+/** Returns the signed scattering angle 2 theta in radians of all spectra, see
+ * signedTwoTheta().
+ *
+ * Entries for spectra without detectors or containing monitors are NaN. Throws
+ * if source and sample are at the same position. */
+const std::vector<double> &SpectrumInfo::signedTwoThetas() const {
+  return angularGeometryCache().signedTwoTheta;
+}
+
+/** Returns the azimuthal angle phi in radians of all spectra.
+ *
+ * The angle is computed from the (average) spectrum position, in the same way
+ * as IDetector::getPhi(). Entries for spectra without detectors or containing
+ * monitors are NaN. Throws if source and sample are at the same position. */
+const std::vector<double> &SpectrumInfo::azimuthals() const {
+  return angularGeometryCache().azimuthal;
+}
+
+/** Returns the uncalibrated DIFC (the TOF to d-spacing conversion factor,
+ * TOF = DIFC * d) of all spectra, computed from L1, L2, and 2 theta.
+ *
+ * Entries for spectra without detectors or containing monitors are NaN. Throws
+ * if source and sample are at the same position. */
+const std::vector<double> &SpectrumInfo::difcs() const {
+  return angularGeometryCache().difc;
+}
+
+/// Returns the position of all spectra, see position(). Entries for spectra
+/// without detectors are V3D(0, 0, 0).
+const std::vector<Kernel::V3D> &SpectrumInfo::positions() const {
+  return geometryCache().position;
+}
+
 /** Set the mask flag of the spectrum with given index. Not thread safe.
  *
  * Currently this simply sets the mask flags for the underlying detectors. */
@@ -189,6 +267,105 @@ SpectrumInfo::checkAndGetSpectrumDefinition(const size_t index) const {
   return spectrumDefinition(index);
 }
 
+/** Returns the cached bulk geometry, rebuilding it if it is out of date.
+ *
+ * This is O(N) in the number of spectra even if the cache is valid, since all
+ * spectrum definitions need to be brought up to date first. */
+const SpectrumInfo::GeometryCache &SpectrumInfo::geometryCache() const {
+  const auto &spectrumDefinitions = sharedSpectrumDefinitions();
+  std::lock_guard<std::mutex> lock(m_geometryCacheMutex);
+  if (!m_geometryCache ||
+      m_geometryCache->spectrumDefinitions != spectrumDefinitions ||
+      m_geometryCache->positionRevision !=
+          m_detectorInfo.m_detectorInfo->positionRevision() ||
+      m_geometryCache->sourcePosition != sourcePosition() ||
+      m_geometryCache->samplePosition != samplePosition())
+    m_geometryCache = buildGeometryCache();
+  return *m_geometryCache;
+}
+
+/// Returns the cached bulk geometry, throws if angles are not defined.
+const SpectrumInfo::GeometryCache &SpectrumInfo::angularGeometryCache() const {
+  const auto &cache = geometryCache();
+  if (!cache.hasBeamDirection)
+    throw Kernel::Exception::InstrumentDefinitionError(
+        "Source and sample are at same position!");
+  return cache;
+}
+
+/** Computes L2, angles, DIFC, and positions of all spectra in a single pass.
+ *
+ * The results are identical to those of the corresponding methods for
+ * individual spectra, but source, sample, and reference frame are looked up
+ * only once. */
+std::unique_ptr<SpectrumInfo::GeometryCache>
+SpectrumInfo::buildGeometryCache() const {
+  auto cache = Kernel::make_unique<GeometryCache>();
+  cache->spectrumDefinitions = m_spectrumInfo.sharedSpectrumDefinitions();
+  cache->positionRevision = m_detectorInfo.m_detectorInfo->positionRevision();
+  cache->sourcePosition = sourcePosition();
+  cache->samplePosition = samplePosition();
+
+  const auto samplePos = cache->samplePosition;
+  const auto sourcePos = cache->sourcePosition;
+  const auto beamLine = samplePos - sourcePos;
+  const double l1 = beamLine.norm();
+  cache->hasBeamDirection = !beamLine.nullVector();
+  const auto normToSurface = beamLine.cross_prod(
+      m_experimentInfo.getInstrument()->getReferenceFrame()->vecThetaSign());
+
+  const auto &spectrumDefinitions = *cache->spectrumDefinitions;
+  const size_t count = spectrumDefinitions.size();
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  cache->l2.resize(count, nan);
+  cache->twoTheta.resize(count, nan);
+  cache->signedTwoTheta.resize(count, nan);
+  cache->azimuthal.resize(count, nan);
+  cache->difc.resize(count, nan);
+  cache->position.resize(count);
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(count); ++i) {
+    const auto &spectrumDefinition = spectrumDefinitions[i];
+    if (spectrumDefinition.size() == 0)
+      continue;
+    Kernel::V3D position;
+    double l2{0.0};
+    double twoTheta{0.0};
+    double signedTwoTheta{0.0};
+    bool hasMonitor{false};
+    for (const auto &index : spectrumDefinition) {
+      const auto detPos = m_detectorInfo.position(index);
+      position += detPos;
+      if (m_detectorInfo.isMonitor(index)) {
+        hasMonitor = true;
+        l2 += detPos.distance(sourcePos) - l1;
+        continue;
+      }
+      const auto sampleDetVec = detPos - samplePos;
+      l2 += sampleDetVec.norm();
+      if (!cache->hasBeamDirection)
+        continue;
+      const double angle = sampleDetVec.angle(beamLine);
+      twoTheta += angle;
+      const auto cross = beamLine.cross_prod(sampleDetVec);
+      signedTwoTheta += normToSurface.scalar_prod(cross) < 0 ? -angle : angle;
+    }
+    const auto size = static_cast<double>(spectrumDefinition.size());
+    position /= size;
+    cache->position[i] = position;
+    cache->l2[i] = l2 / size;
+    if (hasMonitor || !cache->hasBeamDirection)
+      continue;
+    cache->twoTheta[i] = twoTheta / size;
+    cache->signedTwoTheta[i] = signedTwoTheta / size;
+    cache->azimuthal[i] = std::atan2(position.Y(), position.X());
+    cache->difc[i] = 1. / Geometry::Conversion::tofToDSpacingFactor(
+                              l1, cache->l2[i], cache->twoTheta[i], 0.);
+  }
+  return cache;
+}
+
 // Begin method for iterator
 SpectrumInfoIterator SpectrumInfo::begin() const {
   return SpectrumInfoIterator(*this, 0);
@@ -0,0 +1,450 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidAPI/WorkspaceOpOverloads.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Unit.h"
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Mantid {
+namespace API {
+
+namespace {
+enum class Operation { Plus, Minus, Multiply, Divide };
+} // namespace
+
+/// A number, a workspace or an operation combining two expressions
+class WorkspaceExpression::Node {
+public:
+  explicit Node(MatrixWorkspace_const_sptr workspace)
+      : workspace(std::move(workspace)) {}
+  explicit Node(const double value) : value(value) {}
+  Node(const Operation operation, boost::shared_ptr<const Node> lhs,
+       boost::shared_ptr<const Node> rhs)
+      : operation(operation), lhs(std::move(lhs)), rhs(std::move(rhs)) {}
+
+  bool isOperation() const { return static_cast<bool>(lhs); }
+
+  MatrixWorkspace_const_sptr workspace;
+  double value{0.};
+  Operation operation{Operation::Plus};
+  boost::shared_ptr<const Node> lhs;
+  boost::shared_ptr<const Node> rhs;
+};
+
+namespace {
+using Node = WorkspaceExpression::Node;
+
+/// How a workspace operand is applied to the spectra of the result
+enum class Shape { Full, SingleColumn, SingleSpectrum, SingleValue };
+
+/// @return true if the operand has a value per spectrum of the result
+bool perSpectrum(const Shape shape) {
+  return shape == Shape::Full || shape == Shape::SingleColumn;
+}
+
+struct Leaf {
+  MatrixWorkspace_const_sptr workspace;
+  Shape shape;
+};
+
+/// Refers to the operand of a step: a number, a leaf or an earlier step
+struct Reference {
+  enum class Kind { Number, Leaf, Step } kind;
+  size_t index;
+  double value;
+};
+
+struct Step {
+  Operation operation;
+  Reference lhs;
+  Reference rhs;
+};
+
+/// The tree flattened into steps in evaluation order
+struct Program {
+  std::vector<Leaf> leaves;
+  std::vector<Step> steps;
+
+  Reference add(const Node &node) {
+    if (node.isOperation()) {
+      const auto lhs = add(*node.lhs);
+      const auto rhs = add(*node.rhs);
+      steps.push_back({node.operation, lhs, rhs});
+      return {Reference::Kind::Step, steps.size() - 1, 0.};
+    }
+    if (node.workspace) {
+      leaves.push_back({node.workspace, Shape::Full});
+      return {Reference::Kind::Leaf, leaves.size() - 1, 0.};
+    }
+    return {Reference::Kind::Number, 0, node.value};
+  }
+};
+
+/// Y unit and distribution flag of an expression, following the rules of the
+/// corresponding BinaryOperation algorithms
+struct Units {
+  bool isWorkspace;
+  std::string yUnit;
+  bool distribution;
+  size_t size;
+};
+
+/// @throw std::invalid_argument if workspaces with different Y units or
+/// distribution flags are added or subtracted, as Plus and Minus do
+Units outputUnits(const Node &node) {
+  if (!node.isOperation()) {
+    if (node.workspace)
+      return {true, node.workspace->YUnit(), node.workspace->isDistribution(),
+              node.workspace->size()};
+    return {false, "", false, 1};
+  }
+  const auto lhs = outputUnits(*node.lhs);
+  const auto rhs = outputUnits(*node.rhs);
+  if (!lhs.isWorkspace || !rhs.isWorkspace)
+    return lhs.isWorkspace ? lhs : rhs;
+  const auto size = std::max(lhs.size, rhs.size);
+  switch (node.operation) {
+  case Operation::Multiply:
+    return {true, lhs.yUnit, lhs.distribution && rhs.distribution, size};
+  case Operation::Divide:
+    if (rhs.yUnit.empty())
+      return {true, lhs.yUnit, lhs.distribution, size};
+    if (lhs.yUnit == rhs.yUnit)
+      return {true, "", true, size};
+    return {true, (lhs.yUnit.empty() ? "1" : lhs.yUnit) + "/" + rhs.yUnit,
+            lhs.distribution, size};
+  default:
+    if (lhs.size > 1 && rhs.size > 1) {
+      if (lhs.yUnit != rhs.yUnit)
+        throw std::invalid_argument("WorkspaceExpression: the workspaces have "
+                                    "different units for the data (Y).");
+      if (lhs.distribution != rhs.distribution)
+        throw std::invalid_argument("WorkspaceExpression: only one of the "
+                                    "workspaces is a distribution.");
+    }
+    return {true, lhs.yUnit, lhs.distribution, size};
+  }
+}
+
+// Views of an operand for one spectrum. V() returns the variance.
+struct ScalarView {
+  double y;
+  double variance;
+  double Y(size_t) const { return y; }
+  double V(size_t) const { return variance; }
+};
+
+struct DataView {
+  const double *y;
+  const double *e;
+  double Y(size_t j) const { return y[j]; }
+  double V(size_t j) const { return e[j] * e[j]; }
+};
+
+struct ResultView {
+  const double *y;
+  const double *variance;
+  double Y(size_t j) const { return y[j]; }
+  double V(size_t j) const { return variance[j]; }
+};
+
+/// An operand resolved for the current spectrum
+struct Operand {
+  enum class Kind { Scalar, Data, Result } kind;
+  const double *y;
+  const double *e;
+  double value;
+  double variance;
+};
+
+/** The fused kernel: combine two operands bin by bin, propagating variances
+ * for uncorrelated values. The views are inlined, so the loops vectorise.
+ */
+template <class L, class R>
+void apply(const Operation operation, const L &lhs, const R &rhs, double *y,
+           double *variance, const size_t size) {
+  switch (operation) {
+  case Operation::Plus:
+    for (size_t j = 0; j < size; ++j) {
+      variance[j] = lhs.V(j) + rhs.V(j);
+      y[j] = lhs.Y(j) + rhs.Y(j);
+    }
+    break;
+  case Operation::Minus:
+    for (size_t j = 0; j < size; ++j) {
+      variance[j] = lhs.V(j) + rhs.V(j);
+      y[j] = lhs.Y(j) - rhs.Y(j);
+    }
+    break;
+  case Operation::Multiply:
+    for (size_t j = 0; j < size; ++j) {
+      const double a = lhs.Y(j);
+      const double b = rhs.Y(j);
+      variance[j] = lhs.V(j) * b * b + rhs.V(j) * a * a;
+      y[j] = a * b;
+    }
+    break;
+  case Operation::Divide:
+    for (size_t j = 0; j < size; ++j) {
+      const double a = lhs.Y(j);
+      const double b = rhs.Y(j);
+      // Same arrangement as in Divide, avoids infinities for a == 0
+      const double ratio = a / b;
+      variance[j] = (lhs.V(j) + rhs.V(j) * ratio * ratio) / (b * b);
+      y[j] = ratio;
+    }
+    break;
+  }
+}
+
+template <class L>
+void apply(const Operation operation, const L &lhs, const Operand &rhs,
+           double *y, double *variance, const size_t size) {
+  switch (rhs.kind) {
+  case Operand::Kind::Scalar:
+    return apply(operation, lhs, ScalarView{rhs.value, rhs.variance}, y,
+                 variance, size);
+  case Operand::Kind::Data:
+    return apply(operation, lhs, DataView{rhs.y, rhs.e}, y, variance, size);
+  case Operand::Kind::Result:
+    return apply(operation, lhs, ResultView{rhs.y, rhs.e}, y, variance, size);
+  }
+}
+
+void apply(const Operation operation, const Operand &lhs, const Operand &rhs,
+           double *y, double *variance, const size_t size) {
+  switch (lhs.kind) {
+  case Operand::Kind::Scalar:
+    return apply(operation, ScalarView{lhs.value, lhs.variance}, rhs, y,
+                 variance, size);
+  case Operand::Kind::Data:
+    return apply(operation, DataView{lhs.y, lhs.e}, rhs, y, variance, size);
+  case Operand::Kind::Result:
+    return apply(operation, ResultView{lhs.y, lhs.e}, rhs, y, variance, size);
+  }
+}
+
+/// Check the operands can be combined and classify them. Returns the first
+/// operand of full size, which gives the shape and metadata of the result.
+MatrixWorkspace_const_sptr checkLeaves(std::vector<Leaf> &leaves) {
+  size_t numberHistograms(0);
+  for (const auto &leaf : leaves)
+    numberHistograms =
+        std::max(numberHistograms, leaf.workspace->getNumberHistograms());
+  size_t blocksize(0);
+  MatrixWorkspace_const_sptr parent;
+  for (const auto &leaf : leaves)
+    if (leaf.workspace->getNumberHistograms() == numberHistograms &&
+        (!parent || leaf.workspace->blocksize() > blocksize)) {
+      blocksize = leaf.workspace->blocksize();
+      parent = leaf.workspace;
+    }
+  const auto xUnit = parent->getAxis(0)->unit()->unitID();
+  for (auto &leaf : leaves) {
+    const auto &ws = *leaf.workspace;
+    if (ws.getNumberHistograms() == numberHistograms &&
+        ws.blocksize() == blocksize)
+      leaf.shape = Shape::Full;
+    else if (ws.getNumberHistograms() == numberHistograms &&
+             ws.blocksize() == 1)
+      leaf.shape = Shape::SingleColumn;
+    else if (ws.getNumberHistograms() == 1 && ws.blocksize() == blocksize)
+      leaf.shape = Shape::SingleSpectrum;
+    else if (ws.getNumberHistograms() == 1 && ws.blocksize() == 1)
+      leaf.shape = Shape::SingleValue;
+    else
+      throw std::invalid_argument(
+          "WorkspaceExpression: workspace " + ws.getName() + " with " +
+          std::to_string(ws.getNumberHistograms()) + " spectra of " +
+          std::to_string(ws.blocksize()) + " bins does not match " +
+          std::to_string(numberHistograms) + " spectra of " +
+          std::to_string(blocksize) + " bins.");
+    if (ws.blocksize() > 1 && blocksize > 1 &&
+        ws.getAxis(0)->unit()->unitID() != xUnit)
+      throw std::invalid_argument("WorkspaceExpression: workspace " +
+                                  ws.getName() +
+                                  " has different units on the X axis.");
+    if (ws.blocksize() > 1 && blocksize > 1 &&
+        !WorkspaceHelpers::matchingBins(*parent, ws, true))
+      throw std::invalid_argument("WorkspaceExpression: the X values of "
+                                  "workspace " +
+                                  ws.getName() + " do not match.");
+  }
+  return parent;
+}
+} // namespace
+
+/// @param workspace :: the workspace this expression stands for
+WorkspaceExpression::WorkspaceExpression(
+    const MatrixWorkspace_const_sptr &workspace)
+    : m_node(boost::make_shared<Node>(workspace)) {
+  if (!workspace)
+    throw std::invalid_argument("WorkspaceExpression: null workspace");
+}
+
+/// @param workspace :: the workspace this expression stands for
+WorkspaceExpression::WorkspaceExpression(const MatrixWorkspace_sptr &workspace)
+    : WorkspaceExpression(MatrixWorkspace_const_sptr(workspace)) {}
+
+/// @param value :: a number without error
+WorkspaceExpression::WorkspaceExpression(const double value)
+    : m_node(boost::make_shared<Node>(value)) {}
+
+WorkspaceExpression::WorkspaceExpression(boost::shared_ptr<const Node> node)
+    : m_node(std::move(node)) {}
+
+/** Compute the expression in one pass over the spectra.
+ * @return a new workspace holding the result
+ * @throw std::invalid_argument if the expression contains no workspace or the
+ * workspaces do not match
+ */
+MatrixWorkspace_sptr WorkspaceExpression::evaluate() const {
+  Program program;
+  const auto root = program.add(*m_node);
+  if (program.leaves.empty())
+    throw std::invalid_argument(
+        "WorkspaceExpression: the expression contains no workspace");
+  if (root.kind == Reference::Kind::Leaf)
+    return MatrixWorkspace_sptr(program.leaves.front().workspace->clone());
+
+  const auto parent = checkLeaves(program.leaves);
+  const auto units = outputUnits(*m_node);
+  const auto numberHistograms = parent->getNumberHistograms();
+  const auto blocksize = parent->blocksize();
+  auto out = WorkspaceFactory::Instance().create(parent);
+  out->setYUnit(units.yUnit);
+  out->setDistribution(units.distribution);
+
+  // SpectrumInfo is built lazily, so get it before the parallel region.
+  std::vector<const SpectrumInfo *> leafSpectrumInfos;
+  for (const auto &leaf : program.leaves)
+    if (perSpectrum(leaf.shape) && leaf.workspace != parent)
+      leafSpectrumInfos.push_back(&leaf.workspace->spectrumInfo());
+  const auto &parentSpectrumInfo = parent->spectrumInfo();
+  auto &outSpectrumInfo = out->mutableSpectrumInfo();
+
+  const auto &steps = program.steps;
+  const auto &leaves = program.leaves;
+  PARALLEL {
+    // Results of all steps but the last, which is written to the output
+    std::vector<std::vector<double>> scratch(2 * (steps.size() - 1),
+                                             std::vector<double>(blocksize));
+    // Operands without a value per spectrum are the same for every spectrum
+    std::vector<HistogramData::Histogram> histograms;
+    histograms.reserve(leaves.size());
+    for (const auto &leaf : leaves)
+      histograms.push_back(leaf.workspace->histogram(0));
+    PRAGMA_OMP(for schedule(static))
+    for (int64_t index = 0; index < static_cast<int64_t>(numberHistograms);
+         ++index) {
+      const auto i = static_cast<size_t>(index);
+      out->setSharedX(i, parent->sharedX(i));
+      bool masked =
+          parentSpectrumInfo.hasDetectors(i) && parentSpectrumInfo.isMasked(i);
+      for (const auto info : leafSpectrumInfos)
+        masked |= info->hasDetectors(i) && info->isMasked(i);
+      if (masked) {
+        PARALLEL_CRITICAL(WorkspaceExpression_mask) {
+          outSpectrumInfo.setMasked(i, true);
+        }
+        continue;
+      }
+
+      // histogram() is safe to call concurrently, also for EventWorkspaces
+      for (size_t k = 0; k < leaves.size(); ++k)
+        if (perSpectrum(leaves[k].shape))
+          histograms[k] = leaves[k].workspace->histogram(i);
+      auto resolve = [&](const Reference &reference) -> Operand {
+        switch (reference.kind) {
+        case Reference::Kind::Number:
+          return {Operand::Kind::Scalar, nullptr, nullptr, reference.value, 0.};
+        case Reference::Kind::Leaf: {
+          const auto &histogram = histograms[reference.index];
+          const auto shape = leaves[reference.index].shape;
+          if (shape == Shape::SingleValue || shape == Shape::SingleColumn) {
+            const double e = histogram.e()[0];
+            return {Operand::Kind::Scalar, nullptr, nullptr, histogram.y()[0],
+                    e * e};
+          }
+          return {Operand::Kind::Data, histogram.y().rawData().data(),
+                  histogram.e().rawData().data(), 0., 0.};
+        }
+        default:
+          return {Operand::Kind::Result, scratch[2 * reference.index].data(),
+                  scratch[2 * reference.index + 1].data(), 0., 0.};
+        }
+      };
+
+      auto &y = out->mutableY(i);
+      auto &e = out->mutableE(i);
+      for (size_t s = 0; s < steps.size(); ++s) {
+        const bool last = s + 1 == steps.size();
+        apply(steps[s].operation, resolve(steps[s].lhs), resolve(steps[s].rhs),
+              last ? &y[0] : scratch[2 * s].data(),
+              last ? &e[0] : scratch[2 * s + 1].data(), blocksize);
+      }
+      for (auto &error : e)
+        error = std::sqrt(error);
+    }
+  }
+
+  // Carry over the bin masks of the other operands that have bins
+  for (const auto &leaf : leaves) {
+    if (leaf.workspace == parent || leaf.shape == Shape::SingleValue ||
+        leaf.shape == Shape::SingleColumn)
+      continue;
+    for (size_t i = 0; i < numberHistograms; ++i) {
+      const size_t index = leaf.shape == Shape::Full ? i : 0;
+      if (!leaf.workspace->hasMaskedBins(index))
+        continue;
+      for (const auto &mask : leaf.workspace->maskedBins(index))
+        out->flagMasked(i, mask.first, mask.second);
+    }
+  }
+  return out;
+}
+
+/// @return an expression for the sum of lhs and rhs
+WorkspaceExpression operator+(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(boost::make_shared<WorkspaceExpression::Node>(
+      Operation::Plus, lhs.m_node, rhs.m_node));
+}
+
+/// @return an expression for the difference of lhs and rhs
+WorkspaceExpression operator-(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(boost::make_shared<WorkspaceExpression::Node>(
+      Operation::Minus, lhs.m_node, rhs.m_node));
+}
+
+/// @return an expression for the product of lhs and rhs
+WorkspaceExpression operator*(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(boost::make_shared<WorkspaceExpression::Node>(
+      Operation::Multiply, lhs.m_node, rhs.m_node));
+}
+
+/// @return an expression for lhs divided by rhs
+WorkspaceExpression operator/(const WorkspaceExpression &lhs,
+                              const WorkspaceExpression &rhs) {
+  return WorkspaceExpression(boost::make_shared<WorkspaceExpression::Node>(
+      Operation::Divide, lhs.m_node, rhs.m_node));
+}
+
+} // namespace API
+} // namespace Mantid
@@ -8,6 +8,8 @@
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/HistoryView.h"
+#include "MantidKernel/ConfigObserver.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/EnvironmentHistory.h"
 #include "MantidKernel/StringTokenizer.h"
 #include "MantidKernel/Strings.h"
@@ -18,6 +20,9 @@
 #include "Poco/DateTime.h"
 #include <Poco/DateTimeParser.h>
 
+#include <algorithm>
+#include <atomic>
+
 using Mantid::Kernel::EnvironmentHistory;
 using boost::algorithm::split;
 
@@ -26,6 +31,59 @@ namespace API {
 namespace {
 /// static logger object
 Kernel::Logger g_log("WorkspaceHistory");
+
+/// Keeps the value of history.maxentries, so that recording an algorithm
+/// does not have to look it up in the ConfigService
+class MaxEntriesObserver : public Kernel::ConfigObserver {
+public:
+  MaxEntriesObserver() : m_maxEntries(readMaxEntries()) {}
+  size_t maxEntries() const { return m_maxEntries.load(); }
+
+protected:
+  void onValueChanged(const std::string &name, const std::string &,
+                      const std::string &) override {
+    if (name == "history.maxentries")
+      m_maxEntries.store(readMaxEntries());
+  }
+
+private:
+  static size_t readMaxEntries() {
+    const auto limit =
+        Kernel::ConfigService::Instance().getValue<int>("history.maxentries");
+    return static_cast<size_t>(std::max(limit.get_value_or(0), 0));
+  }
+
+  std::atomic<size_t> m_maxEntries;
+};
+
+/// @return the maximum number of entries of a history, 0 if unbounded
+size_t maxEntries() {
+  static const MaxEntriesObserver observer;
+  return observer.maxEntries();
+}
+
+/// @return true if next is another run of the algorithm of previous with the
+/// same property values
+bool isRepeat(const AlgorithmHistory &previous, const AlgorithmHistory &next) {
+  if (previous.name() != next.name() || previous.version() != next.version())
+    return false;
+  const auto &previousProperties = previous.getProperties();
+  const auto &nextProperties = next.getProperties();
+  return std::equal(previousProperties.cbegin(), previousProperties.cend(),
+                    nextProperties.cbegin(), nextProperties.cend(),
+                    [](const Kernel::PropertyHistory_sptr &lhs,
+                       const Kernel::PropertyHistory_sptr &rhs) {
+                      // Property histories are interned, so usually the
+                      // pointers are equal
+                      return lhs == rhs || *lhs == *rhs;
+                    });
+}
+
+/// Drop the oldest entries of algorithms so that at most limit are left
+void truncate(AlgorithmHistories &algorithms, const size_t limit) {
+  while (algorithms.size() > limit)
+    algorithms.erase(algorithms.begin());
+}
 } // namespace
 
 /// Default Constructor
@@ -35,18 +93,16 @@ WorkspaceHistory::WorkspaceHistory() : m_environment() {}
 WorkspaceHistory::~WorkspaceHistory() = default;
 
 /**
-  Standard Copy Constructor
+  Standard Copy Constructor. The algorithm histories are shared with A.
   @param A :: WorkspaceHistory Item to copy
  */
 WorkspaceHistory::WorkspaceHistory(const WorkspaceHistory &A)
-    : m_environment(A.m_environment) {
-  m_algorithms = A.m_algorithms;
-}
+    : m_environment(A.m_environment), m_algorithms(A.m_algorithms) {}
 
 /// Returns a const reference to the algorithmHistory
 const Mantid::API::AlgorithmHistories &
 WorkspaceHistory::getAlgorithmHistories() const {
-  return m_algorithms;
+  return *m_algorithms;
 }
 /// Returns a const reference to the EnvironmentHistory
 const Kernel::EnvironmentHistory &
@@ -61,32 +117,56 @@ void WorkspaceHistory::addHistory(const WorkspaceHistory &otherHistory) {
     return;
   }
 
+  // Nothing to merge if the histories are shared, e.g. because this is the
+  // history of a clone of the other workspace
+  if (m_algorithms == otherHistory.m_algorithms || otherHistory.empty()) {
+    return;
+  }
+  if (empty()) {
+    m_algorithms = otherHistory.m_algorithms;
+    return;
+  }
+
   // Merge the histories
   const AlgorithmHistories &otherAlgorithms =
       otherHistory.getAlgorithmHistories();
-  m_algorithms.insert(otherAlgorithms.begin(), otherAlgorithms.end());
+  auto &algorithms = m_algorithms.access();
+  algorithms.insert(otherAlgorithms.begin(), otherAlgorithms.end());
+  if (const auto limit = maxEntries())
+    truncate(algorithms, limit);
 }
 
 /// Append an AlgorithmHistory to this WorkspaceHistory
 void WorkspaceHistory::addHistory(AlgorithmHistory_sptr algHistory) {
-  m_algorithms.insert(std::move(algHistory));
+  auto &algorithms = m_algorithms.access();
+  const auto limit = maxEntries();
+  if (limit > 0) {
+    // Keep only the last of repeated runs of the same step
+    if (!algorithms.empty() && isRepeat(**algorithms.rbegin(), *algHistory))
+      algorithms.erase(std::prev(algorithms.end()));
+  }
+  algorithms.insert(std::move(algHistory));
+  if (limit > 0)
+    truncate(algorithms, limit);
 }
 
 /*
  Return the history length
  */
-size_t WorkspaceHistory::size() const { return m_algorithms.size(); }
+size_t WorkspaceHistory::size() const { return m_algorithms->size(); }
 
 /**
  * Query if the history is empty or not
  * @returns True if the list is empty, false otherwise
  */
-bool WorkspaceHistory::empty() const { return m_algorithms.empty(); }
+bool WorkspaceHistory::empty() const { return m_algorithms->empty(); }
 
 /**
  * Empty the list of algorithm history objects.
  */
-void WorkspaceHistory::clearHistory() { m_algorithms.clear(); }
+void WorkspaceHistory::clearHistory() {
+  m_algorithms = boost::make_shared<AlgorithmHistories>();
+}
 
 /**
  * Retrieve an algorithm history by index
@@ -100,7 +180,7 @@ WorkspaceHistory::getAlgorithmHistory(const size_t index) const {
     throw std::out_of_range(
         "WorkspaceHistory::getAlgorithmHistory() - Index out of range");
   }
-  return *std::next(m_algorithms.cbegin(), index);
+  return *std::next(m_algorithms->cbegin(), index);
 }
 
 /**
@@ -129,7 +209,7 @@ WorkspaceHistory::getAlgorithm(const size_t index) const {
  * @returns A shared pointer to the algorithm
  */
 boost::shared_ptr<IAlgorithm> WorkspaceHistory::lastAlgorithm() const {
-  if (m_algorithms.empty()) {
+  if (m_algorithms->empty()) {
     throw std::out_of_range(
         "WorkspaceHistory::lastAlgorithm() - History contains no algorithms.");
   }
@@ -148,7 +228,7 @@ void WorkspaceHistory::printSelf(std::ostream &os, const int indent) const {
   AlgorithmHistories::const_iterator it;
   os << std::string(indent, ' ') << "Histories:\n";
 
-  for (const auto &algorithm : m_algorithms) {
+  for (const auto &algorithm : *m_algorithms) {
     os << '\n';
     algorithm->printSelf(os, indent + 2);
   }
@@ -183,7 +263,7 @@ void WorkspaceHistory::saveNexus(::NeXus::File *file) const {
 
   // Algorithm History
   int algCount = 0;
-  for (const auto &algorithm : m_algorithms) {
+  for (const auto &algorithm : *m_algorithms) {
     algorithm->saveNexus(file, algCount);
   }
 
@@ -30,7 +30,7 @@ WorkspaceNearestNeighbourInfo::WorkspaceNearestNeighbourInfo(
 
   m_nearestNeighbours = Kernel::make_unique<WorkspaceNearestNeighbours>(
       nNeighbours, workspace.spectrumInfo(), std::move(spectrumNumbers),
-      ignoreMaskedDetectors);
+      ignoreMaskedDetectors, &workspace.nearestNeighbourCache());
 }
 
 // Defined as default in source for forward declaration with std::unique_ptr.
@@ -12,14 +12,78 @@
 // Nearest neighbours library
 #include "MantidKernel/ANN/ANN.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Timer.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 namespace Mantid {
 using namespace Geometry;
 namespace API {
 using Kernel::V3D;
 using Mantid::detid_t;
 
+/// Nearest neighbours of a set of spectra, as found by a single search
+struct NearestNeighbourTable {
+  /// Number of neighbours searched for each point
+  int nNeighbours;
+  /// Spectrum number of each point
+  std::vector<specnum_t> spectra;
+  /// Scaled position of each point
+  std::vector<V3D> points;
+  /// Scaling applied to the detector positions
+  V3D scale;
+  /// The largest distance to a nearest neighbour
+  double cutoff;
+  /// Point index for each spectrum number
+  std::unordered_map<specnum_t, size_t> pointIndices;
+  /// Point indices of the neighbours of each point, nNeighbours per point
+  std::vector<int> neighbours;
+};
+
+/**
+ * Returns a table matching the spectra, points, scale and number of
+ * neighbours of the given key, or an empty pointer if there is none.
+ * @param key :: Table with the search input filled in
+ */
+boost::shared_ptr<const NearestNeighbourTable>
+NearestNeighbourCache::find(const NearestNeighbourTable &key) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (const auto &table : m_tables) {
+    if (table->nNeighbours == key.nNeighbours && table->scale == key.scale &&
+        table->spectra == key.spectra &&
+        std::equal(table->points.begin(), table->points.end(),
+                   key.points.begin(), key.points.end(),
+                   [](const V3D &a, const V3D &b) {
+                     return a.X() == b.X() && a.Y() == b.Y() && a.Z() == b.Z();
+                   }))
+      return table;
+  }
+  return nullptr;
+}
+
+/**
+ * Adds a table to the cache, replacing a table with the same number of
+ * neighbours or the oldest table if the cache is full.
+ * @param table :: The table to add
+ */
+void NearestNeighbourCache::insert(
+    boost::shared_ptr<const NearestNeighbourTable> table) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = std::find_if(m_tables.begin(), m_tables.end(),
+                         [&table](const auto &item) {
+                           return item->nNeighbours == table->nNeighbours;
+                         });
+  if (it != m_tables.end()) {
+    *it = std::move(table);
+    return;
+  }
+  if (m_tables.size() == maxTables)
+    m_tables.erase(m_tables.begin());
+  m_tables.push_back(std::move(table));
+}
+
 /**
  * Constructor
  * @param nNeighbours :: Number of neighbours to use
@@ -29,14 +93,17 @@ using Mantid::detid_t;
  * of spectra
  * @param ignoreMaskedDetectors :: flag indicating that masked detectors should
  * be ignored.
+ * @param cache :: Optional cache of neighbour tables, may be shared with other
+ * objects. Must outlive this object.
  */
 WorkspaceNearestNeighbours::WorkspaceNearestNeighbours(
     int nNeighbours, const SpectrumInfo &spectrumInfo,
-    std::vector<specnum_t> spectrumNumbers, bool ignoreMaskedDetectors)
+    std::vector<specnum_t> spectrumNumbers, bool ignoreMaskedDetectors,
+    NearestNeighbourCache *cache)
     : m_spectrumInfo(spectrumInfo),
       m_spectrumNumbers(std::move(spectrumNumbers)),
-      m_noNeighbours(nNeighbours), m_cutoff(-DBL_MAX), m_radius(0),
-      m_bIgnoreMaskedDetectors(ignoreMaskedDetectors) {
+      m_noNeighbours(nNeighbours), m_cutoff(-DBL_MAX), m_cache(cache),
+      m_radius(0), m_bIgnoreMaskedDetectors(ignoreMaskedDetectors) {
   this->build(m_noNeighbours);
 }
 
@@ -110,9 +177,10 @@ WorkspaceNearestNeighbours::neighboursInRadius(const specnum_t spectrum,
 // Private member functions
 //--------------------------------------------------------------------------
 /**
- * Builds a map based on the given number of neighbours
+ * Builds the neighbour table based on the given number of neighbours. The
+ * search for each spectrum is independent and run in parallel.
  * @param noNeighbours :: The number of nearest neighbours to use to build
- * the graph
+ * the table
  */
 void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   const auto indices = getSpectraDetectors();
@@ -127,75 +195,74 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
         "NearestNeighbours::build - Invalid number of neighbours");
   }
 
-  // Clear current
-  m_graph.clear();
-  m_specToVertex.clear();
   m_noNeighbours = noNeighbours;
 
+  auto table = boost::make_shared<NearestNeighbourTable>();
+  table->nNeighbours = noNeighbours;
   BoundingBox bbox;
   // Base the scaling on the first detector, should be adequate but we can look
   // at this
   const auto &firstDet = m_spectrumInfo.detector(indices.front());
   firstDet.getBoundingBox(bbox);
-  m_scale = V3D(bbox.width());
-  ANNpointArray dataPoints = annAllocPts(nspectra, 3);
-  MapIV pointNoToVertex;
-
-  int pointNo = 0;
+  table->scale = V3D(bbox.width());
+  table->spectra.reserve(indices.size());
+  table->points.reserve(indices.size());
   for (const auto i : indices) {
-    const specnum_t spectrum = m_spectrumNumbers[i];
-    V3D pos = m_spectrumInfo.position(i) / m_scale;
+    table->spectra.push_back(m_spectrumNumbers[i]);
+    table->points.push_back(m_spectrumInfo.position(i) / table->scale);
+  }
+
+  if (m_cache) {
+    if (auto cached = m_cache->find(*table)) {
+      m_table = std::move(cached);
+      m_cutoff = std::max(m_cutoff, m_table->cutoff);
+      return;
+    }
+  }
+
+  ANNpointArray dataPoints = annAllocPts(nspectra, 3);
+  for (int pointNo = 0; pointNo < nspectra; ++pointNo) {
+    const auto &pos = table->points[pointNo];
     dataPoints[pointNo][0] = pos.X();
     dataPoints[pointNo][1] = pos.Y();
     dataPoints[pointNo][2] = pos.Z();
-    Vertex vertex = boost::add_vertex(spectrum, m_graph);
-    pointNoToVertex[pointNo] = vertex;
-    m_specToVertex[spectrum] = vertex;
-    ++pointNo;
   }
 
   auto annTree = new ANNkd_tree(dataPoints, nspectra, 3);
-  pointNo = 0;
-  // Run the nearest neighbour search on each detector, reusing the arrays
-  auto nnIndexList = new ANNidx[m_noNeighbours];
-  auto nnDistList = new ANNdist[m_noNeighbours];
-
-  for (const auto idx : indices) {
-    ANNpoint scaledPos = dataPoints[pointNo];
-    annTree->annkSearch(scaledPos,      // Point to search nearest neighbours of
-                        m_noNeighbours, // Number of neighbours to find (8)
-                        nnIndexList,    // Index list of results
-                        nnDistList,     // List of distances to each of these
-                        0.0 // Error bound (?) is this the radius to search in?
-    );
-    // The distances that are returned are in our scaled coordinate
-    // system. We store the real space ones.
-    V3D realPos = V3D(scaledPos[0], scaledPos[1], scaledPos[2]) * m_scale;
-    for (int i = 0; i < m_noNeighbours; i++) {
-      ANNidx index = nnIndexList[i];
-      V3D neighbour = V3D(dataPoints[index][0], dataPoints[index][1],
-                          dataPoints[index][2]) *
-                      m_scale;
-      V3D distance = neighbour - realPos;
-      double separation = distance.norm();
-      boost::add_edge(m_specToVertex[m_spectrumNumbers[idx]], // from
-                      pointNoToVertex[index],                 // to
-                      distance, m_graph);
-      if (separation > m_cutoff) {
-        m_cutoff = separation;
-      }
-    }
-    pointNo++;
+  table->neighbours.resize(indices.size() * noNeighbours);
+  // Distances are not used but ANN requires somewhere to write them
+  std::vector<ANNdist> distances(PARALLEL_GET_MAX_THREADS * noNeighbours);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int pointNo = 0; pointNo < nspectra; ++pointNo) {
+    annTree->annkSearch(dataPoints[pointNo], noNeighbours,
+                        table->neighbours.data() + pointNo * noNeighbours,
+                        distances.data() + PARALLEL_THREAD_NUMBER * noNeighbours,
+                        0.0);
   }
-  delete[] nnIndexList;
-  delete[] nnDistList;
   delete annTree;
   annDeallocPts(dataPoints);
   annClose();
-  pointNoToVertex.clear();
 
-  m_vertexID = get(boost::vertex_name, m_graph);
-  m_edgeLength = get(boost::edge_name, m_graph);
+  // The distances that are returned by ANN are in our scaled coordinate
+  // system. The cutoff is based on the real space ones.
+  table->cutoff = -DBL_MAX;
+  for (size_t pointNo = 0; pointNo < indices.size(); ++pointNo) {
+    const V3D realPos = table->points[pointNo] * table->scale;
+    for (int i = 0; i < noNeighbours; ++i) {
+      const ANNidx index = table->neighbours[pointNo * noNeighbours + i];
+      if (index == ANN_NULL_IDX)
+        continue;
+      const double separation =
+          (table->points[index] * table->scale - realPos).norm();
+      table->cutoff = std::max(table->cutoff, separation);
+    }
+    table->pointIndices[table->spectra[pointNo]] = pointNo;
+  }
+  m_cutoff = std::max(m_cutoff, table->cutoff);
+
+  if (m_cache)
+    m_cache->insert(table);
+  m_table = std::move(table);
 }
 
 /**
@@ -207,25 +274,23 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
  */
 std::map<specnum_t, V3D>
 WorkspaceNearestNeighbours::defaultNeighbours(const specnum_t spectrum) const {
-  auto vertex = m_specToVertex.find(spectrum);
-
-  if (vertex != m_specToVertex.end()) {
-    std::map<specnum_t, V3D> result;
-    std::pair<Graph::adjacency_iterator, Graph::adjacency_iterator> adjacent =
-        boost::adjacent_vertices(vertex->second, m_graph);
-    Graph::adjacency_iterator adjIt;
-    for (adjIt = adjacent.first; adjIt != adjacent.second; adjIt++) {
-      Vertex nearest = (*adjIt);
-      specnum_t nrSpec = specnum_t(m_vertexID[nearest]);
-      std::pair<Graph::edge_descriptor, bool> nrEd =
-          boost::edge(vertex->second, nearest, m_graph);
-      result[nrSpec] = m_edgeLength[nrEd.first];
-    }
-    return result;
-  } else {
+  const auto point = m_table->pointIndices.find(spectrum);
+  if (point == m_table->pointIndices.end()) {
     throw Mantid::Kernel::Exception::NotFoundError(
         "NearestNeighbours: Unable to find spectrum in vertex map", spectrum);
   }
+  const size_t pointNo = point->second;
+  const int nNeighbours = m_table->nNeighbours;
+  const V3D realPos = m_table->points[pointNo] * m_table->scale;
+  std::map<specnum_t, V3D> result;
+  for (int i = 0; i < nNeighbours; ++i) {
+    const int index = m_table->neighbours[pointNo * nNeighbours + i];
+    if (index == ANN_NULL_IDX)
+      continue;
+    result[m_table->spectra[index]] =
+        m_table->points[index] * m_table->scale - realPos;
+  }
+  return result;
 }
 
 /// Returns the list of valid spectrum indices
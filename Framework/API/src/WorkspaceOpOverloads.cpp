@@ -13,6 +13,8 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidHistogramData/VectorArithmetic.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Property.h"
 
 #include <numeric>
@@ -547,6 +549,31 @@ void WorkspaceHelpers::makeDistribution(MatrixWorkspace_sptr workspace,
     throw std::runtime_error(
         "Workspace is using point data for x (should be bin edges).");
   }
+  if (const auto commonX = workspace->commonX()) {
+    // The bin widths are the same for all spectra, so they are computed once
+    // and the Y and E data of all spectra are processed as one block.
+    const auto &X = *commonX;
+    std::vector<double> widths(X.size() - 1);
+    for (size_t j = 0; j < widths.size(); ++j)
+      widths[j] = X[j + 1] - X[j];
+    const auto yMode = forwards ? HistogramData::Histogram::YMode::Frequencies
+                                : HistogramData::Histogram::YMode::Counts;
+    const auto apply = forwards ? &HistogramData::VectorArithmetic::divide
+                                : &HistogramData::VectorArithmetic::multiply;
+    const auto size = widths.size();
+    PARALLEL_FOR_IF(Kernel::threadSafe(*workspace))
+    for (int64_t i = 0; i < static_cast<int64_t>(numberOfSpectra); ++i) {
+      auto &spectrum = workspace->getSpectrum(i);
+      if (spectrum.yMode() == yMode)
+        continue;
+      auto y = HistogramData::detail::mutableDataPointer(spectrum.mutableY());
+      auto e = HistogramData::detail::mutableDataPointer(spectrum.mutableE());
+      apply(y, widths.data(), y, size);
+      apply(e, widths.data(), e, size);
+      spectrum.setYMode(yMode);
+    }
+    return;
+  }
   for (size_t i = 0; i < numberOfSpectra; ++i) {
     if (forwards) {
       workspace->convertToFrequencies(i);
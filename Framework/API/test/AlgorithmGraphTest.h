@@ -0,0 +1,208 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_ALGORITHMGRAPHTEST_H_
+#define MANTID_API_ALGORITHMGRAPHTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmGraph.h"
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidKernel/ThreadBudget.h"
+#include "MantidTestHelpers/FakeObjects.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+using namespace Mantid::API;
+using namespace Mantid::Kernel;
+
+namespace {
+/// Makes a workspace holding a single value
+class GraphSource : public Algorithm {
+public:
+  const std::string name() const override { return "GraphSource"; }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Testing"; }
+  const std::string summary() const override { return "Test"; }
+  void init() override {
+    declareProperty("Value", 0.0);
+    declareProperty(make_unique<WorkspaceProperty<>>("OutputWorkspace", "",
+                                                     Direction::Output));
+  }
+  void exec() override {
+    if (waitFor)
+      waitFor(*this);
+    auto ws = boost::make_shared<WorkspaceTester>();
+    ws->initialize(1, 1, 1);
+    const double value = getProperty("Value");
+    ws->mutableY(0)[0] = value;
+    setProperty("OutputWorkspace", ws);
+  }
+  std::function<void(GraphSource &)> waitFor;
+};
+
+/// Adds the values of two workspaces
+class GraphPlus : public Algorithm {
+public:
+  const std::string name() const override { return "GraphPlus"; }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Testing"; }
+  const std::string summary() const override { return "Test"; }
+  void init() override {
+    declareProperty(
+        make_unique<WorkspaceProperty<>>("LHS", "", Direction::Input));
+    declareProperty(
+        make_unique<WorkspaceProperty<>>("RHS", "", Direction::Input));
+    declareProperty(make_unique<WorkspaceProperty<>>("OutputWorkspace", "",
+                                                     Direction::Output));
+  }
+  void exec() override {
+    MatrixWorkspace_const_sptr lhs = getProperty("LHS");
+    MatrixWorkspace_const_sptr rhs = getProperty("RHS");
+    auto ws = boost::make_shared<WorkspaceTester>();
+    ws->initialize(1, 1, 1);
+    ws->mutableY(0)[0] = lhs->y(0)[0] + rhs->y(0)[0];
+    setProperty("OutputWorkspace", ws);
+  }
+};
+
+template <typename Alg> boost::shared_ptr<Alg> makeStep() {
+  auto alg = boost::make_shared<Alg>();
+  alg->setChild(true);
+  alg->setRethrows(true);
+  alg->initialize();
+  alg->setPropertyValue("OutputWorkspace", "__unused_name");
+  return alg;
+}
+
+boost::shared_ptr<GraphSource> makeSource(double value) {
+  auto alg = makeStep<GraphSource>();
+  alg->setProperty("Value", value);
+  return alg;
+}
+
+double valueOf(const IAlgorithm_sptr &alg) {
+  MatrixWorkspace_const_sptr ws = alg->getProperty("OutputWorkspace");
+  return ws->y(0)[0];
+}
+} // namespace
+
+class AlgorithmGraphTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AlgorithmGraphTest *createSuite() { return new AlgorithmGraphTest(); }
+  static void destroySuite(AlgorithmGraphTest *suite) { delete suite; }
+
+  void test_addStep_requires_initialized_algorithm() {
+    AlgorithmGraph graph;
+    TS_ASSERT_THROWS(graph.addStep(boost::make_shared<GraphSource>()),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS(graph.addStep(nullptr), const std::invalid_argument &);
+    TS_ASSERT_EQUALS(graph.size(), 0);
+  }
+
+  void test_connect_checks_steps_and_properties() {
+    AlgorithmGraph graph;
+    const auto source = graph.addStep(makeSource(1.));
+    const auto plus = graph.addStep(makeStep<GraphPlus>());
+    TS_ASSERT_THROWS(graph.connect(source, "OutputWorkspace", 2, "LHS"),
+                     const std::out_of_range &);
+    TS_ASSERT_THROWS(graph.connect(source, "Value", plus, "LHS"),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS(graph.connect(source, "OutputWorkspace", plus, "Nope"),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS(graph.algorithm(2), const std::out_of_range &);
+  }
+
+  void test_outputs_are_passed_between_steps_without_the_ADS() {
+    const auto adsSize = AnalysisDataService::Instance().size();
+    AlgorithmGraph graph;
+    const auto a = graph.addStep(makeSource(1.));
+    const auto b = graph.addStep(makeSource(2.));
+    const auto c = graph.addStep(makeSource(4.));
+    const auto ab = graph.addStep(makeStep<GraphPlus>());
+    const auto abc = graph.addStep(makeStep<GraphPlus>());
+    graph.connect(a, "OutputWorkspace", ab, "LHS");
+    graph.connect(b, "OutputWorkspace", ab, "RHS");
+    graph.connect(ab, "OutputWorkspace", abc, "LHS");
+    graph.connect(c, "OutputWorkspace", abc, "RHS");
+    TS_ASSERT_THROWS_NOTHING(graph.execute());
+    TS_ASSERT_EQUALS(valueOf(graph.algorithm(ab)), 3.);
+    TS_ASSERT_EQUALS(valueOf(graph.algorithm(abc)), 7.);
+    TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), adsSize);
+  }
+
+  void test_prepare_is_called_before_execution() {
+    AlgorithmGraph graph;
+    const auto a = graph.addStep(makeSource(1.));
+    const auto b = graph.addStep(makeSource(0.), [&graph, a](IAlgorithm &alg) {
+      alg.setProperty("Value", valueOf(graph.algorithm(a)) + 1.);
+    });
+    graph.addDependency(a, b);
+    graph.execute();
+    TS_ASSERT_EQUALS(valueOf(graph.algorithm(b)), 2.);
+  }
+
+  void test_independent_steps_run_concurrently() {
+    const auto capacity = ThreadBudget::capacity();
+    ThreadBudget::setCapacity(2);
+    std::mutex mutex;
+    std::condition_variable arrived;
+    int numArrived(0);
+    bool overlapped(false);
+    // Each source waits for the other to start, which only happens if they
+    // run at the same time
+    auto waitForOther = [&](GraphSource &) {
+      std::unique_lock<std::mutex> lock(mutex);
+      ++numArrived;
+      arrived.notify_all();
+      if (arrived.wait_for(lock, std::chrono::seconds(10),
+                           [&] { return numArrived == 2; }))
+        overlapped = true;
+    };
+    AlgorithmGraph graph;
+    auto a = makeSource(1.);
+    auto b = makeSource(2.);
+    a->waitFor = waitForOther;
+    b->waitFor = waitForOther;
+    graph.addStep(a);
+    graph.addStep(b);
+    graph.execute(2);
+    ThreadBudget::setCapacity(capacity);
+    TS_ASSERT(overlapped);
+  }
+
+  void test_circular_dependencies_throw() {
+    AlgorithmGraph graph;
+    const auto a = graph.addStep(makeStep<GraphPlus>());
+    const auto b = graph.addStep(makeStep<GraphPlus>());
+    graph.connect(a, "OutputWorkspace", b, "LHS");
+    graph.connect(b, "OutputWorkspace", a, "LHS");
+    TS_ASSERT_THROWS(graph.execute(), const std::runtime_error &);
+  }
+
+  void test_failing_step_stops_dependents() {
+    AlgorithmGraph graph;
+    const auto a = graph.addStep(makeSource(1.));
+    const auto b = graph.addStep(makeStep<GraphPlus>());
+    const auto c = graph.addStep(makeStep<GraphPlus>());
+    // RHS of b is never set, so b fails validation
+    graph.connect(a, "OutputWorkspace", b, "LHS");
+    graph.connect(b, "OutputWorkspace", c, "LHS");
+    graph.connect(a, "OutputWorkspace", c, "RHS");
+    TS_ASSERT_THROWS(graph.execute(), const std::runtime_error &);
+    TS_ASSERT(graph.algorithm(a)->isExecuted());
+    TS_ASSERT(!graph.algorithm(c)->isExecuted());
+  }
+};
+
+#endif /* MANTID_API_ALGORITHMGRAPHTEST_H_ */
@@ -13,7 +13,9 @@
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AlgorithmProxy.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ConfigService.h"
+#include "MantidKernel/ListValidator.h"
 #include <Poco/ActiveResult.h>
 #include <Poco/Thread.h>
 #include <stdexcept>
@@ -89,9 +91,31 @@ public:
   void cancel() override { isRunningFlag = false; }
 };
 
+/** Algorithm declaring properties with validators */
+class AlgWithProperties : public Algorithm {
+public:
+  void init() override {
+    auto positive = boost::make_shared<Mantid::Kernel::BoundedValidator<int>>();
+    positive->setLower(0);
+    for (int i = 0; i < 10; ++i) {
+      declareProperty("Int" + std::to_string(i), 0, positive);
+      declareProperty("Option" + std::to_string(i), "A",
+                      boost::make_shared<Mantid::Kernel::StringListValidator>(
+                          std::vector<std::string>{"A", "B", "C"}));
+    }
+  }
+  void exec() override {}
+  const std::string name() const override { return "AlgWithProperties"; }
+  int version() const override { return (1); }
+  const std::string category() const override { return ("Cat1"); }
+  const std::string summary() const override { return "Test summary"; }
+  bool supportsInitializationFromPrototype() const override { return true; }
+};
+
 DECLARE_ALGORITHM(AlgTest)
 DECLARE_ALGORITHM(AlgRunsForever)
 DECLARE_ALGORITHM(AlgTestSecond)
+DECLARE_ALGORITHM(AlgWithProperties)
 
 class AlgorithmManagerTest : public CxxTest::TestSuite {
 public:
@@ -401,7 +425,70 @@ public:
     AlgorithmManager::Instance().clear();
   }
 
+  void test_createFromPrototype() {
+    auto &manager = AlgorithmManager::Instance();
+    manager.clear();
+    auto first = manager.createFromPrototype("AlgWithProperties");
+    TS_ASSERT(first->isInitialized());
+    TS_ASSERT_EQUALS(first->propertyCount(), 20);
+    TS_ASSERT(!first->isLightweightExecution());
+    TS_ASSERT_EQUALS(manager.size(), 0);
+
+    first->setProperty("Int3", 5);
+    auto second = manager.createFromPrototype("AlgWithProperties", 1);
+    TS_ASSERT_DIFFERS(first, second);
+    TS_ASSERT_EQUALS(second->getPropertyValue("Int3"), "0");
+    TS_ASSERT_THROWS(second->setProperty("Int3", -1), std::invalid_argument);
+    TS_ASSERT_THROWS(second->setPropertyValue("Option0", "D"),
+                     std::invalid_argument);
+
+    TS_ASSERT_THROWS(manager.createFromPrototype("AlgWithProperties", 3),
+                     std::runtime_error);
+  }
+
+  void test_createFromPrototype_lightweight() {
+    auto alg = AlgorithmManager::Instance().createFromPrototype(
+        "AlgWithProperties", -1, true);
+    TS_ASSERT(alg->isInitialized());
+    TS_ASSERT(alg->isLightweightExecution());
+    TS_ASSERT(!alg->isLogging());
+    TS_ASSERT(alg->execute());
+  }
+
   int m_notificationValue;
 };
 
+class AlgorithmManagerTestPerformance : public CxxTest::TestSuite {
+public:
+  static AlgorithmManagerTestPerformance *createSuite() {
+    return new AlgorithmManagerTestPerformance();
+  }
+  static void destroySuite(AlgorithmManagerTestPerformance *suite) {
+    delete suite;
+  }
+
+  void test_create_child_and_execute() {
+    AlgWithProperties parent;
+    parent.initialize();
+    for (int i = 0; i < NUM_CALLS; ++i) {
+      auto alg = parent.createChildAlgorithm("AlgWithProperties");
+      alg->setProperty("Int0", i);
+      alg->execute();
+    }
+  }
+
+  void test_create_lightweight_child_and_execute() {
+    AlgWithProperties parent;
+    parent.initialize();
+    for (int i = 0; i < NUM_CALLS; ++i) {
+      auto alg = parent.createLightweightChildAlgorithm("AlgWithProperties");
+      alg->setProperty("Int0", i);
+      alg->execute();
+    }
+  }
+
+private:
+  static constexpr int NUM_CALLS = 10000;
+};
+
 #endif /* AlgorithmManagerTest_H_*/
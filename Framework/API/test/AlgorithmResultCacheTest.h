@@ -0,0 +1,208 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_ALGORITHMRESULTCACHETEST_H_
+#define MANTID_API_ALGORITHMRESULTCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmResultCache.h"
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/Sample.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+#include "MantidTestHelpers/FakeObjects.h"
+
+using namespace Mantid::API;
+using namespace Mantid::Kernel;
+
+namespace {
+/// Scales a workspace, counting how often it really runs
+class CachedScale : public Algorithm {
+public:
+  const std::string name() const override { return "CachedScale"; }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Testing"; }
+  const std::string summary() const override { return "Test"; }
+  void init() override {
+    declareProperty(make_unique<WorkspaceProperty<>>("InputWorkspace", "",
+                                                     Direction::Input));
+    declareProperty("Factor", 1.0);
+    declareProperty(make_unique<WorkspaceProperty<>>("OutputWorkspace", "",
+                                                     Direction::Output));
+    declareProperty("Sum", 0.0, Direction::Output);
+  }
+  void exec() override {
+    ++numExecutions;
+    MatrixWorkspace_const_sptr in = getProperty("InputWorkspace");
+    const double factor = getProperty("Factor");
+    MatrixWorkspace_sptr out = in->clone();
+    out->mutableY(0)[0] *= factor;
+    setProperty("OutputWorkspace", out);
+    setProperty("Sum", out->y(0)[0]);
+  }
+  static int numExecutions;
+};
+int CachedScale::numExecutions = 0;
+
+MatrixWorkspace_sptr makeWorkspace(double value) {
+  auto ws = boost::make_shared<WorkspaceTester>();
+  ws->initialize(1, 2, 1);
+  ws->mutableY(0)[0] = value;
+  return ws;
+}
+
+MatrixWorkspace_sptr runScale(const MatrixWorkspace_sptr &in, double factor,
+                              double *sum = nullptr) {
+  CachedScale alg;
+  alg.setChild(true);
+  alg.setRethrows(true);
+  alg.initialize();
+  alg.setProperty("InputWorkspace", in);
+  alg.setProperty("Factor", factor);
+  alg.setPropertyValue("OutputWorkspace", "unused");
+  alg.execute();
+  if (sum)
+    *sum = alg.getProperty("Sum");
+  return alg.getProperty("OutputWorkspace");
+}
+} // namespace
+
+class AlgorithmResultCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AlgorithmResultCacheTest *createSuite() {
+    return new AlgorithmResultCacheTest();
+  }
+  static void destroySuite(AlgorithmResultCacheTest *suite) { delete suite; }
+
+  void setUp() override {
+    auto &cache = AlgorithmResultCache::Instance();
+    cache.clear();
+    cache.setCachedAlgorithms({"CachedScale"});
+    cache.setMemoryLimit(1024 * 1024);
+    cache.setDirectory("");
+    CachedScale::numExecutions = 0;
+  }
+
+  void tearDown() override {
+    auto &cache = AlgorithmResultCache::Instance();
+    cache.setCachedAlgorithms({});
+    cache.clear();
+  }
+
+  void test_nothing_is_cached_unless_enabled() {
+    AlgorithmResultCache::Instance().setCachedAlgorithms({});
+    const auto in = makeWorkspace(2.);
+    runScale(in, 3.);
+    runScale(in, 3.);
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 2);
+    TS_ASSERT_EQUALS(AlgorithmResultCache::Instance().size(), 0);
+  }
+
+  void test_identical_run_is_restored() {
+    const auto in = makeWorkspace(2.);
+    double firstSum(0.), secondSum(0.);
+    const auto first = runScale(in, 3., &firstSum);
+    const auto second = runScale(in, 3., &secondSum);
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 1);
+    TS_ASSERT_EQUALS(second->y(0)[0], 6.);
+    TS_ASSERT_EQUALS(secondSum, firstSum);
+    // Each run gets its own copy
+    TS_ASSERT_DIFFERS(first, second);
+    TS_ASSERT_EQUALS(AlgorithmResultCache::Instance().size(), 1);
+    TS_ASSERT_LESS_THAN(0, AlgorithmResultCache::Instance().memoryUsed());
+  }
+
+  void test_same_content_under_another_workspace_hits() {
+    runScale(makeWorkspace(2.), 3.);
+    runScale(makeWorkspace(2.), 3.);
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 1);
+  }
+
+  void test_different_inputs_miss() {
+    const auto in = makeWorkspace(2.);
+    runScale(in, 3.);
+    runScale(in, 4.);
+    runScale(makeWorkspace(5.), 3.);
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 3);
+  }
+
+  void test_bin_masks_goniometer_and_sample_shape_are_part_of_the_key() {
+    runScale(makeWorkspace(2.), 3.);
+    auto masked = makeWorkspace(2.);
+    masked->flagMasked(0, 0);
+    runScale(masked, 3.);
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 2);
+    auto rotated = makeWorkspace(2.);
+    rotated->mutableRun().mutableGoniometer().pushAxis("phi", 0., 1., 0., 30.);
+    runScale(rotated, 3.);
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 3);
+    auto withShape = makeWorkspace(2.);
+    withShape->mutableSample().setShape(
+        ComponentCreationHelper::createSphere(0.01));
+    runScale(withShape, 3.);
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 4);
+  }
+
+  void test_changing_the_output_does_not_change_the_cache() {
+    const auto in = makeWorkspace(2.);
+    auto out = runScale(in, 3.);
+    out->mutableY(0)[0] = 100.;
+    TS_ASSERT_EQUALS(runScale(in, 3.)->y(0)[0], 6.);
+  }
+
+  void test_least_recently_used_entry_is_dropped() {
+    const auto in = makeWorkspace(2.);
+    const auto bytes = runScale(in, 1.)->getMemorySize();
+    AlgorithmResultCache::Instance().setMemoryLimit(2 * bytes);
+    runScale(in, 2.);
+    runScale(in, 1.); // hit, so factor 2 is now the oldest
+    runScale(in, 3.);
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 3);
+    TS_ASSERT_EQUALS(AlgorithmResultCache::Instance().size(), 2);
+    runScale(in, 1.);
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 3);
+    runScale(in, 2.);
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 4);
+  }
+
+  void test_restored_output_has_the_same_history() {
+    auto &ads = AnalysisDataService::Instance();
+    ads.addOrReplace("cache_in", makeWorkspace(2.));
+    for (const auto &out : {"cache_out1", "cache_out2"}) {
+      CachedScale alg;
+      alg.initialize();
+      alg.setPropertyValue("InputWorkspace", "cache_in");
+      alg.setProperty("Factor", 3.);
+      alg.setPropertyValue("OutputWorkspace", out);
+      TS_ASSERT(alg.execute());
+    }
+    TS_ASSERT_EQUALS(CachedScale::numExecutions, 1);
+    const auto &history1 = ads.retrieve("cache_out1")->getHistory();
+    const auto &history2 = ads.retrieve("cache_out2")->getHistory();
+    TS_ASSERT_EQUALS(history1.size(), 1);
+    TS_ASSERT_EQUALS(history2.size(), 1);
+    TS_ASSERT_EQUALS(history2.getAlgorithmHistory(0)->name(), "CachedScale");
+    TS_ASSERT_EQUALS(history2.getAlgorithmHistory(0)
+                         ->getPropertyValue("OutputWorkspace"),
+                     "cache_out2");
+    // Nothing of the run that filled the cache is left
+    for (size_t i = 0; i < history2.size(); ++i)
+      TS_ASSERT_DIFFERS(history2.getAlgorithmHistory(i)
+                            ->getPropertyValue("OutputWorkspace"),
+                        "cache_out1");
+    for (const auto &name : {"cache_in", "cache_out1", "cache_out2"})
+      ads.remove(name);
+  }
+};
+
+#endif /* MANTID_API_ALGORITHMRESULTCACHETEST_H_ */
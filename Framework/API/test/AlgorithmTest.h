@@ -16,12 +16,15 @@
 #include "MantidAPI/HistogramValidator.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidAPI/WorkspaceHistory.h"
 #include "MantidAPI/WorkspaceProperty.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/ExecutionProfiler.h"
 #include "MantidKernel/Property.h"
 #include "MantidKernel/ReadLock.h"
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/Strings.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/WriteLock.h"
 #include "MantidTestHelpers/FakeObjects.h"
 #include "PropertyManagerHelper.h"
@@ -42,6 +45,7 @@ public:
   int version() const override { return 1; }
   const std::string category() const override { return "Cat;Leopard;Mink"; }
   const std::string summary() const override { return "Test summary"; }
+  bool supportsInitializationFromPrototype() const override { return true; }
 
   void init() override {
     declareProperty(make_unique<WorkspaceProperty<>>("InputWorkspace1", "",
@@ -195,6 +199,23 @@ public:
 
 DECLARE_ALGORITHM(IndexingAlgorithm)
 
+class ThreadLimitAlgorithm : public Algorithm {
+public:
+  const std::string name() const override { return "ThreadLimitAlgorithm"; }
+  int version() const override { return 1; }
+  const std::string summary() const override {
+    return "Records the thread limit it runs with";
+  }
+  void init() override {}
+  void exec() override {
+    threadLimit = ThreadBudget::threadLimit();
+    Mantid::Kernel::ThreadBudget::Reservation reservation;
+    numThreads = reservation.numThreads();
+  }
+  size_t threadLimit{0};
+  int numThreads{0};
+};
+
 class AlgorithmTest : public CxxTest::TestSuite {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -297,6 +318,126 @@ public:
     TS_ASSERT(myAlg.isExecuted());
   }
 
+  void test_setMaxThreads_limits_threads_during_execution() {
+    ThreadLimitAlgorithm threadAlg;
+    threadAlg.initialize();
+    TS_ASSERT_EQUALS(threadAlg.getMaxThreads(), 0);
+    threadAlg.setMaxThreads(1);
+    TS_ASSERT_EQUALS(threadAlg.getMaxThreads(), 1);
+    TS_ASSERT(threadAlg.execute());
+    TS_ASSERT_EQUALS(threadAlg.threadLimit, 1);
+    TS_ASSERT_EQUALS(threadAlg.numThreads, 1);
+    // The limit only applies while executing
+    TS_ASSERT_EQUALS(ThreadBudget::threadLimit(), 0);
+  }
+
+  void test_execution_is_recorded_by_profiler() {
+    auto &profiler = ExecutionProfiler::Instance();
+    profiler.clear();
+    profiler.setEnabled(true);
+    AnalysisDataService::Instance().addOrReplace(
+        "profiled_in", boost::make_shared<WorkspaceTester>());
+    StubbedWorkspaceAlgorithm alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace1", "profiled_in");
+    alg.setPropertyValue("OutputWorkspace1", "profiled_out1");
+    alg.setPropertyValue("OutputWorkspace2", "profiled_out2");
+    TS_ASSERT(alg.execute());
+    profiler.setEnabled(false);
+
+    const auto events = profiler.events();
+    profiler.clear();
+    TS_ASSERT_EQUALS(events.size(), 1);
+    const auto &event = events.front();
+    TS_ASSERT_EQUALS(event.name, "StubbedWorkspaceAlgorithm v1");
+    TS_ASSERT_EQUALS(event.category, "algorithm");
+    std::map<std::string, double> args(event.args.begin(), event.args.end());
+    TS_ASSERT_EQUALS(args.size(), 3);
+    TS_ASSERT_LESS_THAN_EQUALS(0., args["cpu_seconds"]);
+    TS_ASSERT_LESS_THAN_EQUALS(0., args["peak_rss_growth_bytes"]);
+    const auto outputBytes = static_cast<double>(
+        AnalysisDataService::Instance()
+                .retrieve("profiled_out1")
+                ->getMemorySize() +
+        AnalysisDataService::Instance()
+            .retrieve("profiled_out2")
+            ->getMemorySize());
+    TS_ASSERT_EQUALS(args["output_workspace_bytes"], outputBytes);
+    for (const auto &name : {"profiled_in", "profiled_out1", "profiled_out2"})
+      AnalysisDataService::Instance().remove(name);
+  }
+
+  void test_initializeFromPrototype() {
+    StubbedWorkspaceAlgorithm prototype;
+    prototype.initialize();
+    StubbedWorkspaceAlgorithm copy;
+    TS_ASSERT_THROWS_NOTHING(copy.initializeFromPrototype(prototype));
+    TS_ASSERT(copy.isInitialized());
+    TS_ASSERT_EQUALS(copy.propertyCount(), prototype.propertyCount());
+    copy.setProperty("Number", 3.);
+    TS_ASSERT_EQUALS(prototype.getPropertyValue("Number"), "0");
+
+    StubbedWorkspaceAlgorithm uninitialized;
+    TS_ASSERT_THROWS(uninitialized.initializeFromPrototype(
+                         StubbedWorkspaceAlgorithm()),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(uninitialized.initializeFromPrototype(alg),
+                     std::invalid_argument);
+  }
+
+  void test_lightweight_execution_records_no_history() {
+    auto &ads = AnalysisDataService::Instance();
+    ads.addOrReplace("lightweight_in", boost::make_shared<WorkspaceTester>());
+    for (const bool lightweight : {false, true}) {
+      StubbedWorkspaceAlgorithm alg;
+      alg.initialize();
+      alg.setLightweightExecution(lightweight);
+      TS_ASSERT_EQUALS(alg.isLightweightExecution(), lightweight);
+      alg.setPropertyValue("InputWorkspace1", "lightweight_in");
+      alg.setPropertyValue("OutputWorkspace1", "lightweight_out");
+      TS_ASSERT(alg.execute());
+      TS_ASSERT_EQUALS(ads.retrieve("lightweight_out")->getHistory().size(),
+                       lightweight ? 0 : 1);
+    }
+    ads.remove("lightweight_in");
+    ads.remove("lightweight_out");
+  }
+
+  void test_createLightweightChildAlgorithm() {
+    ToyAlgorithm parent;
+    parent.initialize();
+    auto child =
+        parent.createLightweightChildAlgorithm("StubbedWorkspaceAlgorithm");
+    TS_ASSERT(child->isInitialized());
+    TS_ASSERT(child->isChild());
+    TS_ASSERT(child->isLightweightExecution());
+    TS_ASSERT(!child->isLogging());
+    TS_ASSERT(child->existsProperty("InputWorkspace1"));
+  }
+
+  void test_createLightweightChildAlgorithm_with_index_properties() {
+    ToyAlgorithm parent;
+    parent.initialize();
+    auto child = parent.createLightweightChildAlgorithm("IndexingAlgorithm");
+    auto other = parent.createLightweightChildAlgorithm("IndexingAlgorithm");
+    auto wksp =
+        WorkspaceFactory::Instance().create("WorkspaceTester", 10, 10, 9);
+    TS_ASSERT_THROWS_NOTHING(
+        (child->setWorkspaceInputProperties<MatrixWorkspace, std::string>(
+            "InputWorkspace", wksp, IndexType::WorkspaceIndex, "1:5")));
+
+    MatrixWorkspace_sptr wsTest;
+    SpectrumIndexSet indexSet;
+    TS_ASSERT_THROWS_NOTHING(
+        std::tie(wsTest, indexSet) =
+            child->getWorkspaceAndIndices<MatrixWorkspace>("InputWorkspace"));
+    TS_ASSERT_EQUALS(wsTest, wksp);
+    TS_ASSERT_EQUALS(indexSet.size(), 5);
+    for (size_t i = 0; i < indexSet.size(); i++)
+      TS_ASSERT_EQUALS(indexSet[i], i + 1);
+    TS_ASSERT(other->getPointerToProperty("InputWorkspace")->isDefault());
+  }
+
   void testSetPropertyValue() {
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("prop1", "val"))
     TS_ASSERT_THROWS(alg.setPropertyValue("prop3", "1"),
@@ -23,6 +23,7 @@
 #include "MantidGeometry/Instrument/Detector.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidHistogramData/Rebin.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/VMD.h"
@@ -471,6 +472,101 @@ public:
     TS_ASSERT_EQUALS(ws.size(), 0);
   }
 
+  void test_commonX_empty_workspace() {
+    WorkspaceTester ws;
+    TS_ASSERT(!ws.commonX());
+  }
+
+  void test_commonX_with_equal_X_values() {
+    WorkspaceTester ws;
+    ws.initialize(3, 4, 3);
+    TS_ASSERT_DIFFERS(&ws.x(0), &ws.x(2));
+    const auto x = ws.commonX();
+    TS_ASSERT(x);
+    TS_ASSERT_EQUALS(x->rawData(), ws.x(2).rawData());
+  }
+
+  void test_commonX_with_shared_X() {
+    WorkspaceTester ws;
+    ws.initialize(3, 4, 3);
+    const auto x = make_cow<HistogramData::HistogramX>(
+        std::vector<double>{1., 2., 4., 8.});
+    for (size_t i = 0; i < 3; ++i)
+      ws.setSharedX(i, x);
+    TS_ASSERT_EQUALS(ws.commonX(), x);
+  }
+
+  void test_commonX_is_null_for_different_X() {
+    WorkspaceTester ws;
+    ws.initialize(3, 4, 3);
+    ws.mutableX(2)[3] = 5.;
+    TS_ASSERT(!ws.commonX());
+    // Again, from the cache
+    TS_ASSERT(!ws.commonX());
+  }
+
+  void test_commonX_is_invalidated_by_setSharedX() {
+    WorkspaceTester ws;
+    ws.initialize(2, 4, 3);
+    TS_ASSERT(ws.commonX());
+    ws.setSharedX(1, make_cow<HistogramData::HistogramX>(
+                         std::vector<double>{1., 2., 3., 5.}));
+    TS_ASSERT(!ws.commonX());
+    ws.setSharedX(1, ws.sharedX(0));
+    TS_ASSERT_EQUALS(ws.commonX(), ws.sharedX(1));
+  }
+
+  void test_commonX_is_invalidated_by_setBinEdges() {
+    WorkspaceTester ws;
+    ws.initialize(2, 4, 3);
+    TS_ASSERT(ws.commonX());
+    ws.setBinEdges(0, HistogramData::BinEdges{0., 1., 2., 3.});
+    TS_ASSERT(!ws.commonX());
+  }
+
+  void test_rebinOperator_is_cached() {
+    WorkspaceTester ws;
+    ws.initialize(2, 4, 3);
+    const auto x = make_cow<HistogramData::HistogramX>(
+        std::vector<double>{0., 1., 2., 3.});
+    for (size_t i = 0; i < 2; ++i)
+      ws.setSharedX(i, x);
+    const auto rebinOperator =
+        ws.rebinOperator(HistogramData::BinEdges{0., 1.5, 3.});
+    TS_ASSERT(rebinOperator);
+    TS_ASSERT_EQUALS(ws.rebinOperator(HistogramData::BinEdges{0., 1.5, 3.}),
+                     rebinOperator);
+    TS_ASSERT_EQUALS(rebinOperator->apply(ws.histogram(1)).y()[0], 1.5);
+    TS_ASSERT_DIFFERS(ws.rebinOperator(HistogramData::BinEdges{0., 3.}),
+                      rebinOperator);
+  }
+
+  void test_rebinOperator_is_recomputed_when_X_changes() {
+    WorkspaceTester ws;
+    ws.initialize(2, 4, 3);
+    auto x = make_cow<HistogramData::HistogramX>(
+        std::vector<double>{0., 1., 2., 3.});
+    for (size_t i = 0; i < 2; ++i)
+      ws.setSharedX(i, x);
+    const HistogramData::BinEdges edges{0., 1.5, 3.};
+    const auto rebinOperator = ws.rebinOperator(edges);
+    x = make_cow<HistogramData::HistogramX>(
+        std::vector<double>{0., 1., 2.5, 3.});
+    for (size_t i = 0; i < 2; ++i)
+      ws.setSharedX(i, x);
+    const auto newOperator = ws.rebinOperator(edges);
+    TS_ASSERT_DIFFERS(newOperator, rebinOperator);
+    TS_ASSERT_EQUALS(newOperator->inputBinEdges().cowData(), x);
+  }
+
+  void test_rebinOperator_is_null_without_common_bins() {
+    WorkspaceTester ws;
+    ws.initialize(2, 4, 3);
+    ws.setBinEdges(0, HistogramData::BinEdges{0., 1., 2., 3.});
+    ws.setBinEdges(1, HistogramData::BinEdges{0., 1., 2., 4.});
+    TS_ASSERT(!ws.rebinOperator(HistogramData::BinEdges{0., 1.5, 3.}));
+  }
+
   void test_updateSpectraUsing() {
     WorkspaceTester testWS;
     testWS.initialize(3, 1, 1);
@@ -13,8 +13,10 @@
 #include "MantidAPI/SpectrumInfoIterator.h"
 #include "MantidBeamline/SpectrumInfo.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/Detector.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/Exception.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/make_unique.h"
 #include "MantidTestHelpers/FakeObjects.h"
@@ -282,6 +284,94 @@ public:
     detectorInfo.setPosition(1, oldPos);
   }
 
+  void test_bulk_l2_and_positions_match_individual() {
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const auto &l2s = spectrumInfo.l2s();
+    const auto &positions = spectrumInfo.positions();
+    TS_ASSERT_EQUALS(l2s.size(), spectrumInfo.size());
+    TS_ASSERT_EQUALS(positions.size(), spectrumInfo.size());
+    for (size_t i = 0; i < spectrumInfo.size(); ++i) {
+      TS_ASSERT_EQUALS(l2s[i], spectrumInfo.l2(i));
+      TS_ASSERT_EQUALS(positions[i], spectrumInfo.position(i));
+    }
+  }
+
+  void test_bulk_angles_match_individual() {
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const auto &twoThetas = spectrumInfo.twoThetas();
+    const auto &signedTwoThetas = spectrumInfo.signedTwoThetas();
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_EQUALS(twoThetas[i], spectrumInfo.twoTheta(i));
+      TS_ASSERT_EQUALS(signedTwoThetas[i], spectrumInfo.signedTwoTheta(i));
+      TS_ASSERT_DELTA(spectrumInfo.azimuthals()[i],
+                      spectrumInfo.detector(i).getPhi(), 1e-12);
+    }
+    // Monitors
+    TS_ASSERT(std::isnan(twoThetas[3]));
+    TS_ASSERT(std::isnan(signedTwoThetas[4]));
+    TS_ASSERT(std::isnan(spectrumInfo.difcs()[3]));
+  }
+
+  void test_bulk_difc() {
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const auto &difcs = spectrumInfo.difcs();
+    TS_ASSERT_DELTA(difcs[0],
+                    1. / Geometry::Conversion::tofToDSpacingFactor(
+                             spectrumInfo.l1(), spectrumInfo.l2(0),
+                             spectrumInfo.twoTheta(0), 0.),
+                    1e-9);
+  }
+
+  void test_grouped_bulk() {
+    const auto &spectrumInfo = m_grouped.spectrumInfo();
+    TS_ASSERT_EQUALS(spectrumInfo.l2s()[GroupOfDets2And3],
+                     spectrumInfo.l2(GroupOfDets2And3));
+    TS_ASSERT_EQUALS(spectrumInfo.twoThetas()[GroupOfDets1And2],
+                     spectrumInfo.twoTheta(GroupOfDets1And2));
+    TS_ASSERT_EQUALS(spectrumInfo.positions()[GroupOfDets1And2],
+                     spectrumInfo.position(GroupOfDets1And2));
+    // Partial monitor
+    TS_ASSERT(std::isnan(spectrumInfo.twoThetas()[GroupOfDets1And4]));
+  }
+
+  void test_bulk_tracks_position_changes() {
+    auto ws = makeDefaultWorkspace();
+    auto &detectorInfo = ws.mutableDetectorInfo();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[1], 0.0, 1e-6);
+    detectorInfo.setPosition(1, V3D(0.0, -0.1, 5.0));
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[1], 0.0199973, 1e-6);
+    TS_ASSERT_EQUALS(spectrumInfo.positions()[1], V3D(0.0, -0.1, 5.0));
+  }
+
+  void test_bulk_tracks_component_moves() {
+    auto ws = makeDefaultWorkspace();
+    auto &componentInfo = ws.mutableComponentInfo();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    const double l2 = spectrumInfo.l2s()[1];
+    componentInfo.setPosition(componentInfo.sample(), V3D(0.0, 0.0, 1.0));
+    TS_ASSERT_DELTA(spectrumInfo.l2s()[1], l2 - 1.0, 1e-12);
+  }
+
+  void test_bulk_tracks_grouping_changes() {
+    auto ws = makeDefaultWorkspace();
+    const auto &spectrumInfo = ws.spectrumInfo();
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[0], 0.0199973, 1e-6);
+    ws.getSpectrum(0).setDetectorIDs({2});
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[0], 0.0, 1e-6);
+  }
+
+  void test_bulk_throws_if_source_at_sample() {
+    auto ws = makeDefaultWorkspace();
+    auto &componentInfo = ws.mutableComponentInfo();
+    componentInfo.setPosition(componentInfo.source(),
+                              componentInfo.samplePosition());
+    const auto &spectrumInfo = ws.spectrumInfo();
+    TS_ASSERT_THROWS_NOTHING(spectrumInfo.l2s());
+    TS_ASSERT_THROWS(spectrumInfo.twoThetas(),
+                     Kernel::Exception::InstrumentDefinitionError);
+  }
+
   void test_hasDetectors() {
     const auto &spectrumInfo = m_workspace.spectrumInfo();
     TS_ASSERT(spectrumInfo.hasDetectors(0));
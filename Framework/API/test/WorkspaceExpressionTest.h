@@ -0,0 +1,223 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_WORKSPACEEXPRESSIONTEST_H_
+#define MANTID_API_WORKSPACEEXPRESSIONTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidTestHelpers/FakeObjects.h"
+
+#include <cmath>
+
+using namespace Mantid::API;
+using Expr = Mantid::API::WorkspaceExpression;
+
+namespace {
+MatrixWorkspace_sptr makeWorkspace(const size_t numSpectra, const double y,
+                                   const double e, const size_t numBins = 3) {
+  auto ws = boost::make_shared<WorkspaceTester>();
+  ws->initialize(numSpectra, numBins + 1, numBins);
+  for (size_t i = 0; i < numSpectra; ++i) {
+    ws->mutableY(i) = y + static_cast<double>(i);
+    ws->mutableE(i) = e;
+  }
+  return ws;
+}
+} // namespace
+
+class WorkspaceExpressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static WorkspaceExpressionTest *createSuite() {
+    return new WorkspaceExpressionTest();
+  }
+  static void destroySuite(WorkspaceExpressionTest *suite) { delete suite; }
+
+  WorkspaceExpressionTest() {
+    if (!WorkspaceFactory::Instance().exists("WorkspaceTester"))
+      WorkspaceFactory::Instance().subscribe<WorkspaceTester>(
+          "WorkspaceTester");
+  }
+
+  void test_plus_and_minus_add_variances() {
+    const auto a = makeWorkspace(2, 5., 3.);
+    const auto b = makeWorkspace(2, 1., 4.);
+    const auto sum = (Expr(a) + b).evaluate();
+    const auto difference = (Expr(a) - b).evaluate();
+    TS_ASSERT_EQUALS(sum->y(1)[0], 8.);
+    TS_ASSERT_EQUALS(difference->y(1)[0], 4.);
+    TS_ASSERT_DELTA(sum->e(1)[0], 5., 1e-12);
+    TS_ASSERT_DELTA(difference->e(1)[0], 5., 1e-12);
+    TS_ASSERT_EQUALS(sum->x(1).rawData(), a->x(1).rawData());
+  }
+
+  void test_multiply_and_divide_propagate_relative_errors() {
+    const auto a = makeWorkspace(1, 6., 0.3);
+    const auto b = makeWorkspace(1, 2., 0.4);
+    const auto product = (Expr(a) * b).evaluate();
+    const auto ratio = (Expr(a) / b).evaluate();
+    TS_ASSERT_EQUALS(product->y(0)[2], 12.);
+    TS_ASSERT_DELTA(product->e(0)[2], std::hypot(0.3 * 2., 0.4 * 6.), 1e-12);
+    TS_ASSERT_EQUALS(ratio->y(0)[2], 3.);
+    TS_ASSERT_DELTA(ratio->e(0)[2], std::hypot(0.3, 3. * 0.4) / 2., 1e-12);
+  }
+
+  void test_fused_expression_matches_step_by_step_evaluation() {
+    const auto sample = makeWorkspace(4, 10., 2.);
+    const auto can = makeWorkspace(4, 3., 1.);
+    const auto vanadium = makeWorkspace(4, 2., 0.5);
+    const auto fused = ((Expr(sample) - 0.9 * Expr(can)) / vanadium * 2.)
+                           .evaluate();
+    const auto scaledCan = (0.9 * Expr(can)).evaluate();
+    const auto subtracted = (Expr(sample) - scaledCan).evaluate();
+    const auto normalised = (Expr(subtracted) / vanadium).evaluate();
+    const auto expected = (Expr(normalised) * 2.).evaluate();
+    for (size_t i = 0; i < 4; ++i) {
+      TS_ASSERT_DELTA(fused->y(i)[1], expected->y(i)[1], 1e-12);
+      TS_ASSERT_DELTA(fused->e(i)[1], expected->e(i)[1], 1e-12);
+    }
+    const double y = (10. - 0.9 * 3.) / 2. * 2.;
+    TS_ASSERT_DELTA(fused->y(0)[0], y, 1e-12);
+  }
+
+  void test_single_spectrum_workspace_applies_to_all_spectra() {
+    const auto a = makeWorkspace(3, 1., 0.);
+    const auto monitor = makeWorkspace(1, 2., 0.);
+    const auto out = (Expr(a) / monitor).evaluate();
+    TS_ASSERT_EQUALS(out->getNumberHistograms(), 3);
+    TS_ASSERT_EQUALS(out->y(0)[0], 0.5);
+    TS_ASSERT_EQUALS(out->y(2)[0], 1.5);
+  }
+
+  void test_single_bin_workspace_applies_to_all_bins_of_its_spectrum() {
+    const auto sample = makeWorkspace(3, 4., 0.);
+    const auto integratedVanadium = makeWorkspace(3, 2., 0.2, 1);
+    const auto out = (Expr(sample) / integratedVanadium).evaluate();
+    TS_ASSERT_EQUALS(out->getNumberHistograms(), 3);
+    TS_ASSERT_EQUALS(out->blocksize(), 3);
+    for (size_t i = 0; i < 3; ++i) {
+      const double expected = (4. + static_cast<double>(i)) /
+                              (2. + static_cast<double>(i));
+      for (size_t j = 0; j < 3; ++j)
+        TS_ASSERT_DELTA(out->y(i)[j], expected, 1e-12);
+    }
+    // Relative error of the divisor only
+    TS_ASSERT_DELTA(out->e(0)[2], 2. * 0.1, 1e-12);
+  }
+
+  void test_single_value_workspace_acts_as_number_with_error() {
+    const auto a = makeWorkspace(2, 4., 0.);
+    const auto factor = makeWorkspace(1, 2., 0.1, 1);
+    const auto out = (Expr(a) * factor).evaluate();
+    TS_ASSERT_EQUALS(out->y(1)[0], 10.);
+    TS_ASSERT_DELTA(out->e(1)[0], 0.5, 1e-12);
+  }
+
+  void test_dividing_workspaces_with_equal_units_gives_distribution() {
+    const auto a = makeWorkspace(1, 4., 0.);
+    const auto b = makeWorkspace(1, 2., 0.);
+    a->setYUnit("Counts");
+    b->setYUnit("Counts");
+    const auto out = (Expr(a) / b).evaluate();
+    TS_ASSERT_EQUALS(out->YUnit(), "");
+    TS_ASSERT(out->isDistribution());
+    TS_ASSERT_EQUALS((Expr(a) * 3.).evaluate()->YUnit(), "Counts");
+  }
+
+  void test_masked_bins_are_carried_over() {
+    const auto a = makeWorkspace(2, 4., 0.);
+    const auto b = makeWorkspace(2, 2., 0.);
+    b->flagMasked(1, 2);
+    const auto out = (Expr(a) + b).evaluate();
+    TS_ASSERT(out->hasMaskedBins(1));
+    TS_ASSERT(!out->hasMaskedBins(0));
+    TS_ASSERT_EQUALS(out->y(1)[2], 0.);
+  }
+
+  void test_operands_are_not_modified() {
+    const auto a = makeWorkspace(2, 4., 1.);
+    const auto out = (Expr(a) * 2. + 1.).evaluate();
+    TS_ASSERT_DIFFERS(out, a);
+    TS_ASSERT_EQUALS(a->y(0)[0], 4.);
+    TS_ASSERT_EQUALS(out->y(0)[0], 9.);
+  }
+
+  void test_single_workspace_expression_is_copied() {
+    const auto a = makeWorkspace(2, 4., 1.);
+    const auto out = Expr(a).evaluate();
+    TS_ASSERT_DIFFERS(out, a);
+    TS_ASSERT_EQUALS(out->y(1)[0], 5.);
+  }
+
+  void test_throws_for_mismatched_workspaces() {
+    const auto a = makeWorkspace(3, 1., 0.);
+    const auto b = makeWorkspace(2, 1., 0.);
+    TS_ASSERT_THROWS((Expr(a) + b).evaluate(), std::invalid_argument);
+    const auto c = makeWorkspace(3, 1., 0., 4);
+    TS_ASSERT_THROWS((Expr(a) + c).evaluate(), std::invalid_argument);
+  }
+
+  void test_throws_for_mismatched_bins() {
+    const auto a = makeWorkspace(2, 1., 0.);
+    const auto b = makeWorkspace(2, 1., 0.);
+    for (size_t i = 0; i < b->getNumberHistograms(); ++i)
+      b->mutableX(i) += 1.;
+    TS_ASSERT_THROWS((Expr(a) + b).evaluate(), std::invalid_argument);
+    TS_ASSERT_THROWS((Expr(a) * b).evaluate(), std::invalid_argument);
+  }
+
+  void test_throws_for_mismatched_y_units_or_distribution() {
+    const auto a = makeWorkspace(2, 1., 0.);
+    const auto b = makeWorkspace(2, 1., 0.);
+    b->setYUnit("Counts");
+    TS_ASSERT_THROWS((Expr(a) + b).evaluate(), std::invalid_argument);
+    TS_ASSERT_THROWS((Expr(a) - b).evaluate(), std::invalid_argument);
+    TS_ASSERT_THROWS_NOTHING((Expr(a) * b).evaluate());
+    const auto c = makeWorkspace(2, 1., 0.);
+    c->setDistribution(true);
+    TS_ASSERT_THROWS((Expr(a) + c).evaluate(), std::invalid_argument);
+    TS_ASSERT_THROWS((Expr(a) - c).evaluate(), std::invalid_argument);
+  }
+
+  void test_throws_without_workspace() {
+    TS_ASSERT_THROWS((Expr(1.) + 2.).evaluate(), std::invalid_argument);
+  }
+};
+
+class WorkspaceExpressionTestPerformance : public CxxTest::TestSuite {
+public:
+  static WorkspaceExpressionTestPerformance *createSuite() {
+    return new WorkspaceExpressionTestPerformance();
+  }
+  static void destroySuite(WorkspaceExpressionTestPerformance *suite) {
+    delete suite;
+  }
+
+  WorkspaceExpressionTestPerformance() {
+    if (!WorkspaceFactory::Instance().exists("WorkspaceTester"))
+      WorkspaceFactory::Instance().subscribe<WorkspaceTester>(
+          "WorkspaceTester");
+    m_sample = makeWorkspace(10000, 10., 2., 1000);
+    m_can = makeWorkspace(10000, 3., 1., 1000);
+    m_vanadium = makeWorkspace(10000, 2., 0.5, 1000);
+  }
+
+  void test_reduction_expression() {
+    for (int i = 0; i < 5; ++i)
+      (((Expr(m_sample) - 0.9 * Expr(m_can)) / m_vanadium) * 1.5).evaluate();
+  }
+
+private:
+  MatrixWorkspace_sptr m_sample;
+  MatrixWorkspace_sptr m_can;
+  MatrixWorkspace_sptr m_vanadium;
+};
+
+#endif /* MANTID_API_WORKSPACEEXPRESSIONTEST_H_ */
@@ -12,6 +12,7 @@
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/FileFinder.h"
 #include "MantidAPI/WorkspaceHistory.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Property.h"
 #include "MantidTestHelpers/NexusTestHelper.h"
 #include "Poco/File.h"
@@ -135,6 +136,74 @@ public:
     TS_ASSERT_THROWS(emptyHistory.lastAlgorithm(), std::out_of_range);
     TS_ASSERT_THROWS(emptyHistory.getAlgorithm(1), std::out_of_range);
   }
+
+  void test_Copies_Share_History_Until_One_Changes() {
+    WorkspaceHistory history;
+    history.addHistory(makeHistory("First", "1", 0));
+    WorkspaceHistory copy(history);
+    TS_ASSERT_EQUALS(&copy.getAlgorithmHistories(),
+                     &history.getAlgorithmHistories());
+    // Merging a shared history does nothing
+    copy.addHistory(history);
+    TS_ASSERT_EQUALS(&copy.getAlgorithmHistories(),
+                     &history.getAlgorithmHistories());
+
+    copy.addHistory(makeHistory("Second", "1", 1));
+    TS_ASSERT_EQUALS(history.size(), 1);
+    TS_ASSERT_EQUALS(copy.size(), 2);
+    TS_ASSERT_EQUALS(copy.getAlgorithmHistory(0),
+                     history.getAlgorithmHistory(0));
+  }
+
+  void test_Merging_Into_Empty_History_Shares_It() {
+    WorkspaceHistory history;
+    history.addHistory(makeHistory("First", "1", 0));
+    WorkspaceHistory output;
+    output.addHistory(history);
+    TS_ASSERT_EQUALS(&output.getAlgorithmHistories(),
+                     &history.getAlgorithmHistories());
+    output.clearHistory();
+    TS_ASSERT(output.empty());
+    TS_ASSERT_EQUALS(history.size(), 1);
+  }
+
+  void test_Equal_Property_Histories_Are_Shared() {
+    const auto first = makeHistory("Alg", "1", 0);
+    const auto second = makeHistory("Alg", "1", 1);
+    const auto third = makeHistory("Alg", "2", 2);
+    TS_ASSERT_EQUALS(first->getProperties()[0], second->getProperties()[0]);
+    TS_ASSERT_DIFFERS(first->getProperties()[0], third->getProperties()[0]);
+  }
+
+  void test_Bounded_History_Keeps_Last_Repeat_And_Newest_Entries() {
+    auto &config = ConfigService::Instance();
+    const auto maxEntries = config.getString("history.maxentries");
+    config.setString("history.maxentries", "3");
+    WorkspaceHistory history;
+    history.addHistory(makeHistory("Load", "a", 0));
+    history.addHistory(makeHistory("Scale", "2", 1));
+    history.addHistory(makeHistory("Scale", "2", 2));
+    history.addHistory(makeHistory("Scale", "3", 3));
+    TS_ASSERT_EQUALS(history.size(), 3);
+    TS_ASSERT_EQUALS(history.getAlgorithmHistory(1)->execCount(), 2);
+
+    history.addHistory(makeHistory("Rebin", "1", 4));
+    TS_ASSERT_EQUALS(history.size(), 3);
+    TS_ASSERT_EQUALS(history.getAlgorithmHistory(0)->name(), "Scale");
+    TS_ASSERT_EQUALS(history.getAlgorithmHistory(2)->name(), "Rebin");
+    config.setString("history.maxentries", maxEntries);
+  }
+
+private:
+  AlgorithmHistory_sptr makeHistory(const std::string &name,
+                                    const std::string &value,
+                                    size_t execCount) {
+    auto history = boost::make_shared<AlgorithmHistory>(
+        name, 1, Mantid::Types::Core::DateAndTime::defaultTime(), 1.0,
+        execCount);
+    history->addProperty("Value", value, false, Direction::Input);
+    return history;
+  }
 };
 
 class WorkspaceHistoryTestPerformance : public CxxTest::TestSuite {
@@ -12,6 +12,7 @@
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
@@ -178,6 +179,33 @@ public:
     TS_ASSERT_EQUALS(nb.size(), 4);
   }
 
+  void testCacheGivesSameNeighbours() {
+    const auto ws = makeWorkspace(256, 767);
+    ws->setInstrument(
+        ComponentCreationHelper::createTestInstrumentRectangular(2, 16));
+    const auto spectrumNumbers = getSpectrumNumbers(*ws);
+    const specnum_t spec = 256 + 2 * 16 + 3;
+
+    WorkspaceNearestNeighbours uncached(8, ws->spectrumInfo(), spectrumNumbers);
+    WorkspaceNearestNeighbours nn(8, ws->spectrumInfo(), spectrumNumbers, false,
+                                  &ws->nearestNeighbourCache());
+    // A copy of the workspace shares the cache
+    const auto copy = ws->clone();
+    TS_ASSERT_EQUALS(&copy->nearestNeighbourCache(),
+                     &ws->nearestNeighbourCache());
+    WorkspaceNearestNeighbours cached(8, copy->spectrumInfo(), spectrumNumbers,
+                                      false, &copy->nearestNeighbourCache());
+    TS_ASSERT_EQUALS(cached.neighbours(spec), uncached.neighbours(spec));
+    TS_ASSERT_EQUALS(nn.neighbours(spec), uncached.neighbours(spec));
+    TS_ASSERT_EQUALS(cached.neighboursInRadius(spec, 0.016).size(), 4);
+
+    // Moving a detector must not give the cached result
+    copy->mutableDetectorInfo().setPosition(0, V3D(0, 0, 0));
+    WorkspaceNearestNeighbours moved(8, copy->spectrumInfo(), spectrumNumbers,
+                                     false, &copy->nearestNeighbourCache());
+    TS_ASSERT_DIFFERS(moved.neighbours(256), uncached.neighbours(256));
+  }
+
   void testIgnoreAndApplyMasking() {
     const auto ws = makeWorkspace(1, 18);
     ws->setInstrument(
@@ -10,6 +10,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "MantidAPI/WorkspaceOpOverloads.h"
+#include "MantidKernel/make_cow.h"
 #include "MantidTestHelpers/FakeObjects.h"
 
 using namespace Mantid::API;
@@ -212,6 +213,35 @@ public:
     TS_ASSERT_EQUALS(ws->readE(1)[0], 1.0)
   }
 
+  void test_makeDistribution_with_common_bins() {
+    auto ws = boost::make_shared<WorkspaceTester>();
+    ws->initialize(3, 3, 2);
+    const auto x = Mantid::Kernel::make_cow<Mantid::HistogramData::HistogramX>(
+        std::vector<double>{0., 2., 2.5});
+    for (size_t i = 0; i < 3; ++i) {
+      ws->setSharedX(i, x);
+      ws->mutableY(i) = static_cast<double>(i + 1);
+    }
+
+    TS_ASSERT_THROWS_NOTHING(WorkspaceHelpers::makeDistribution(ws));
+    TS_ASSERT(ws->isDistribution());
+    TS_ASSERT_EQUALS(ws->y(2)[0], 1.5);
+    TS_ASSERT_EQUALS(ws->y(2)[1], 6.0);
+    TS_ASSERT_EQUALS(ws->e(0)[0], 0.5);
+    TS_ASSERT_EQUALS(ws->e(0)[1], 2.0);
+    TS_ASSERT_EQUALS(ws->sharedX(1), x);
+
+    // Nothing to do the second time
+    TS_ASSERT_THROWS_NOTHING(WorkspaceHelpers::makeDistribution(ws));
+    TS_ASSERT_EQUALS(ws->y(2)[0], 1.5);
+
+    TS_ASSERT_THROWS_NOTHING(WorkspaceHelpers::makeDistribution(ws, false));
+    TS_ASSERT(!ws->isDistribution());
+    TS_ASSERT_EQUALS(ws->y(2)[0], 3.0);
+    TS_ASSERT_EQUALS(ws->y(2)[1], 3.0);
+    TS_ASSERT_EQUALS(ws->e(0)[1], 1.0);
+  }
+
   void test_makeDistribution_fails_for_point_data() {
     auto ws = boost::make_shared<WorkspaceTester>();
     ws->initialize(2, 2, 2);
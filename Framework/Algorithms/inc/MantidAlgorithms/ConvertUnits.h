@@ -105,10 +105,11 @@ protected:
 
   /// Internal function to gather detector specific L2, theta and efixed values
   bool getDetectorValues(const API::SpectrumInfo &spectrumInfo,
+                         const std::vector<double> &l2s,
+                         const std::vector<double> &twoThetas,
                          const Kernel::Unit &outputUnit, int emode,
-                         const API::MatrixWorkspace &ws, const bool signedTheta,
-                         int64_t wsIndex, double &efixed, double &l2,
-                         double &twoTheta);
+                         const API::MatrixWorkspace &ws, int64_t wsIndex,
+                         double &efixed, double &l2, double &twoTheta);
 
   /// Convert the workspace units using TOF as an intermediate step in the
   /// conversion
@@ -93,6 +93,9 @@ private:
 
   // For events
   void execEvent();
+  template <class T>
+  void scatterEvents(DataObjects::EventWorkspace &output,
+                     API::Progress &progress, const bool inPlace);
 
   /// Loop over the workspace and determine the rebin parameters
   /// (Xmin,Xmax,step) for each group.
@@ -45,6 +45,10 @@ public:
     return "Transforms\\Splitting";
   }
 
+  /// init() only declares properties, so instances run in loops may be
+  /// initialized from a prototype
+  bool supportsInitializationFromPrototype() const override { return true; }
+
 private:
   /// Initialisation code
   void init() override;
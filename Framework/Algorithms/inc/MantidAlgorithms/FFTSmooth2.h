@@ -10,6 +10,8 @@
 #include "MantidAPI/MatrixWorkspace_fwd.h"
 #include "MantidAPI/ParallelAlgorithm.h"
 
+#include <vector>
+
 namespace Mantid {
 namespace Algorithms {
 /** Data smoothing using the FFT algorithm and various filters.
@@ -42,11 +44,9 @@ private:
   void exec() override;
 
   // Smoothing by zeroing.
-  void zero(int n, API::MatrixWorkspace_sptr &unfilteredWS,
-            API::MatrixWorkspace_sptr &filteredWS);
+  void zero(int n, std::vector<double> &transform) const;
   // Smoothing using Butterworth filter of any positive order.
-  void Butterworth(int n, int order, API::MatrixWorkspace_sptr &unfilteredWS,
-                   API::MatrixWorkspace_sptr &filteredWS);
+  void Butterworth(int n, int order, std::vector<double> &transform) const;
 };
 
 } // namespace Algorithms
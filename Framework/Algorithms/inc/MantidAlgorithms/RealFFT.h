@@ -36,6 +36,10 @@ public:
   /// Algorithm's category for identification overriding a virtual method
   const std::string category() const override { return "Arithmetic\\FFT"; }
 
+  /// init() only declares properties, so instances run in loops may be
+  /// initialized from a prototype
+  bool supportsInitializationFromPrototype() const override { return true; }
+
 private:
   // Overridden Algorithm methods
   void init() override;
@@ -0,0 +1,44 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_ALGORITHMS_RUNDISTRIBUTED_H_
+#define MANTID_ALGORITHMS_RUNDISTRIBUTED_H_
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAlgorithms/DllConfig.h"
+
+namespace Mantid {
+namespace Algorithms {
+
+/** RunDistributed : runs an algorithm supporting distributed execution, e.g.
+  any DistributedAlgorithm, on a number of local ranks.
+
+  The input workspace is partitioned across the ranks with the partitioner of
+  Indexing::IndexInfo, each rank runs the algorithm on its own spectra, and
+  the partial outputs are gathered into a single output workspace. Ranks are
+  threads exchanging messages via a shared-memory Parallel::Communicator, so
+  this behaves like an MPI run of the algorithm on a single machine.
+*/
+class MANTID_ALGORITHMS_DLL RunDistributed : public API::Algorithm {
+public:
+  const std::string name() const override { return "RunDistributed"; }
+  const std::string summary() const override {
+    return "Runs an algorithm with distributed execution support on several "
+           "local ranks, each processing a part of the spectra.";
+  }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Utility"; }
+
+private:
+  void init() override;
+  void exec() override;
+  std::map<std::string, std::string> validateInputs() override;
+};
+
+} // namespace Algorithms
+} // namespace Mantid
+
+#endif /* MANTID_ALGORITHMS_RUNDISTRIBUTED_H_ */
@@ -10,6 +10,7 @@
 #include "MantidAPI/ParallelAlgorithm.h"
 #include "MantidGeometry/IDTypes.h"
 #include <set>
+#include <vector>
 
 namespace Mantid {
 namespace Algorithms {
@@ -67,6 +68,12 @@ private:
   void doSimpleSum(API::MatrixWorkspace_sptr outputWorkspace,
                    API::Progress &progress, size_t &numSpectra,
                    size_t &numMasked, size_t &numZeros);
+  /// Sum the histograms of either workspace type
+  std::vector<double>
+  parallelSum(API::MatrixWorkspace_const_sptr localworkspace,
+              API::MatrixWorkspace_sptr outputWorkspace,
+              API::Progress &progress, size_t &numSpectra, size_t &numMasked,
+              size_t &numZeros);
 
   // Overridden Algorithm methods
   void init() override;
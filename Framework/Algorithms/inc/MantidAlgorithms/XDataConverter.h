@@ -57,9 +57,7 @@ private:
   void setXData(API::MatrixWorkspace_sptr outputWS,
                 const API::MatrixWorkspace_sptr inputWS, const int index);
 
-  /// Flag if the X data is shared
-  bool m_sharedX;
-  /// Cached data for shared X values
+  /// X values for all spectra if the input X data is common, else null
   Kernel::cow_ptr<HistogramData::HistogramX> m_cachedX{nullptr};
 };
 
@@ -18,9 +18,12 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/UnitConversion.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidParallel/Communicator.h"
 
+#include <cmath>
+#include <memory>
 #include <numeric>
 
 namespace Mantid {
@@ -29,6 +32,17 @@ namespace Algorithms {
 // Register with the algorithm factory
 DECLARE_ALGORITHM(ConvertUnits)
 
+namespace {
+/// The parameters of the conversion of a spectrum
+struct DetectorValues {
+  double l2;
+  double twoTheta;
+  double efixed;
+  /// False if the spectrum cannot be converted
+  bool valid;
+};
+} // namespace
+
 using namespace Kernel;
 using namespace API;
 using namespace DataObjects;
@@ -397,10 +411,11 @@ ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
 
 /** Get the L2, theta and efixed values for a workspace index
  * @param spectrumInfo :: SpectrumInfo of the workspace
+ * @param l2s :: L2 of all spectra, see SpectrumInfo::l2s()
+ * @param twoThetas :: Signed or unsigned two theta of all spectra
  * @param outputUnit :: The output unit
  * @param emode :: The energy mode
  * @param ws :: The workspace
- * @param signedTheta :: Return twotheta with sign or without
  * @param wsIndex :: The workspace index
  * @param efixed :: the returned fixed energy
  * @param l2 :: The returned sample - detector distance
@@ -408,22 +423,24 @@ ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
  * @returns true if lookup successful, false on error
  */
 bool ConvertUnits::getDetectorValues(const API::SpectrumInfo &spectrumInfo,
+                                     const std::vector<double> &l2s,
+                                     const std::vector<double> &twoThetas,
                                      const Kernel::Unit &outputUnit, int emode,
-                                     const MatrixWorkspace &ws,
-                                     const bool signedTheta, int64_t wsIndex,
+                                     const MatrixWorkspace &ws, int64_t wsIndex,
                                      double &efixed, double &l2,
                                      double &twoTheta) {
   if (!spectrumInfo.hasDetectors(wsIndex))
     return false;
 
-  l2 = spectrumInfo.l2(wsIndex);
+  l2 = l2s[wsIndex];
 
   if (!spectrumInfo.isMonitor(wsIndex)) {
     // The scattering angle for this detector (in radians).
-    if (signedTheta)
-      twoTheta = spectrumInfo.signedTwoTheta(wsIndex);
-    else
-      twoTheta = spectrumInfo.twoTheta(wsIndex);
+    twoTheta = twoThetas[wsIndex];
+    // Groups containing monitors have no well-defined scattering angle
+    if (std::isnan(twoTheta))
+      throw std::logic_error(
+          "Two theta (scattering angle) is not defined for monitors.");
     // If an indirect instrument, try getting Efixed from the geometry
     if (emode == 2 && efixed == EMPTY_DBL()) // indirect
     {
@@ -521,13 +538,20 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   auto localFromUnit = std::unique_ptr<Unit>(fromUnit->clone());
   auto localOutputUnit = std::unique_ptr<Unit>(outputUnit->clone());
 
+  // Geometry of all spectra is computed once up front. The output workspace is
+  // created from the input and thus has identical geometry.
+  const auto &l2s = spectrumInfo.l2s();
+  const auto &twoThetas =
+      signedTheta ? spectrumInfo.signedTwoThetas() : spectrumInfo.twoThetas();
+
   // Perform Sanity Validation before creating workspace
   double checkefixed = efixedProp;
   double checkl2;
   double checktwoTheta;
   size_t checkIndex = 0;
-  if (getDetectorValues(spectrumInfo, *outputUnit, emode, *inputWS, signedTheta,
-                        checkIndex, checkefixed, checkl2, checktwoTheta)) {
+  if (getDetectorValues(spectrumInfo, l2s, twoThetas, *outputUnit, emode,
+                        *inputWS, checkIndex, checkefixed, checkl2,
+                        checktwoTheta)) {
     const double checkdelta = 0.0;
     // copy the X values for the check
     auto checkXValues = inputWS->readX(checkIndex);
@@ -546,32 +570,18 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   assert(static_cast<bool>(eventWS) == m_inputEvents); // Sanity check
 
   auto &outSpectrumInfo = outputWS->mutableSpectrumInfo();
-  // Loop over the histograms (detector spectra)
+  // Find the detector values of all spectra first, since this may look up
+  // instrument parameters and mask spectra. The conversions then run in
+  // parallel.
+  std::vector<DetectorValues> detectorValues(m_numberOfSpectra);
   for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
-    double efixed = efixedProp;
-
-    // Now get the detector object for this histogram
-    double l2;
-    double twoTheta;
-    if (getDetectorValues(outSpectrumInfo, *outputUnit, emode, *outputWS,
-                          signedTheta, i, efixed, l2, twoTheta)) {
-
-      /// @todo Don't yet consider hold-off (delta)
-      const double delta = 0.0;
-
-      // TODO toTOF and fromTOF need to be reimplemented outside of kernel
-      localFromUnit->toTOF(outputWS->dataX(i), emptyVec, l1, l2, twoTheta,
-                           emode, efixed, delta);
-      // Convert from time-of-flight to the desired unit
-      localOutputUnit->fromTOF(outputWS->dataX(i), emptyVec, l1, l2, twoTheta,
-                               emode, efixed, delta);
-
-      // EventWorkspace part, modifying the EventLists.
-      if (m_inputEvents) {
-        eventWS->getSpectrum(i).convertUnitsViaTof(localFromUnit.get(),
-                                                   localOutputUnit.get());
-      }
-    } else {
+    auto &values = detectorValues[i];
+    values.efixed = efixedProp;
+    values.valid =
+        getDetectorValues(outSpectrumInfo, l2s, twoThetas, *outputUnit, emode,
+                          *outputWS, i, values.efixed, values.l2,
+                          values.twoTheta);
+    if (!values.valid) {
       // Get to here if exception thrown when calculating distance to detector
       failedDetectorCount++;
       // Since you usually (always?) get to here when there's no attached
@@ -582,9 +592,46 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
       if (outSpectrumInfo.hasDetectors(i))
         outSpectrumInfo.setMasked(i, true);
     }
+  }
+
+  // Each thread initializes its own copies of the units for each spectrum
+  std::vector<std::unique_ptr<Unit>> fromUnits;
+  std::vector<std::unique_ptr<Unit>> toUnits;
+  for (int thread = 0; thread < PARALLEL_GET_MAX_THREADS; ++thread) {
+    fromUnits.emplace_back(localFromUnit->clone());
+    toUnits.emplace_back(localOutputUnit->clone());
+  }
+
+  PARALLEL_FOR_IF(Kernel::threadSafe(*outputWS))
+  for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto &values = detectorValues[i];
+    if (values.valid) {
+      const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+      auto &spectrumFromUnit = *fromUnits[thread];
+      auto &spectrumToUnit = *toUnits[thread];
+      /// @todo Don't yet consider hold-off (delta)
+      const double delta = 0.0;
+      spectrumFromUnit.initialize(l1, values.l2, values.twoTheta, emode,
+                                  values.efixed, delta);
+      spectrumToUnit.initialize(l1, values.l2, values.twoTheta, emode,
+                                values.efixed, delta);
+
+      auto &x = outputWS->dataX(i);
+      UnitConversion::run(spectrumFromUnit, spectrumToUnit, x.data(),
+                          x.data(), x.size());
+
+      // EventWorkspace part, modifying the EventLists.
+      if (m_inputEvents) {
+        eventWS->getSpectrum(i).convertUnitsViaTof(&spectrumFromUnit,
+                                                   &spectrumToUnit);
+      }
+    }
 
     prog.report("Convert to " + m_outputUnit->unitID());
+    PARALLEL_END_INTERUPT_REGION
   } // loop over spectra
+  PARALLEL_CHECK_INTERUPT_REGION
 
   if (failedDetectorCount != 0) {
     g_log.information() << "Unable to calculate sample-detector distance for "
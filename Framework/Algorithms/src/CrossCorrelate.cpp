@@ -13,9 +13,11 @@
 #include "MantidAPI/WorkspaceUnitValidator.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
+#include "MantidKernel/FFTService.h"
 #include "MantidKernel/VectorHelper.h"
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <algorithm>
 #include <numeric>
 #include <sstream>
 
@@ -169,6 +171,19 @@ void CrossCorrelate::exec() {
   double refNorm = 1.0 / sqrt(refVar);
   double refNormE = 0.5 * pow(refNorm, 3) * sqrt(refVarE);
 
+  // The correlations for all shifts are computed from the products of the
+  // Fourier transforms, padded with zeros so they do not wrap around
+  const size_t fftSize = FFTService::fastSize(2 * refY.size() - 1);
+  const auto plan = FFTService::plan(fftSize);
+  // Transforms of (y[i]-refMean), its square and the errors squared
+  std::vector<double> refTransforms(3 * fftSize, 0.0);
+  for (size_t j = 0; j < refY.size(); ++j) {
+    refTransforms[j] = refY[j];
+    refTransforms[fftSize + j] = refY[j] * refY[j];
+    refTransforms[2 * fftSize + j] = refE[j];
+  }
+  plan->forward(refTransforms.data(), 3);
+
   // Now copy the other spectra
   bool is_distrib = inputWS->isDistribution();
 
@@ -229,27 +244,36 @@ void CrossCorrelate::exec() {
     auto &outY = out->mutableY(i);
     auto &outE = out->mutableE(i);
 
+    // Transforms of the centred spectrum, its errors squared and its square
+    std::vector<double> transforms(3 * fftSize, 0.0);
+    for (int j = 0; j < nY; ++j) {
+      transforms[j] = tempY[j];
+      transforms[fftSize + j] = tempE[j];
+      transforms[2 * fftSize + j] = tempY[j] * tempY[j];
+    }
+    plan->forward(transforms.data(), 3, false);
+    double *val = transforms.data();
+    double *err2 = val + fftSize;
+    double *square = val + 2 * fftSize;
+    // For the shift k, val[k] is the sum of refY[j] * tempY[j + k] and err2[k]
+    // the sum of refY[j]^2 * tempE[j + k] + refE[j] * tempY[j + k]^2
+    FFTService::multiplyConjugate(refTransforms.data(), val, val, fftSize);
+    FFTService::multiplyConjugate(refTransforms.data() + fftSize, err2, err2,
+                                  fftSize);
+    FFTService::multiplyConjugate(refTransforms.data() + 2 * fftSize, square,
+                                  square, fftSize);
+    for (size_t j = 0; j < fftSize; ++j)
+      err2[j] += square[j];
+    plan->inverse(transforms.data(), 2, false);
+
     for (int k = -nY + 2; k <= nY - 2; ++k) {
-      int kp = abs(k);
-      double val = 0, err2 = 0, x, y, xE, yE;
-      for (int j = nY - 1 - kp; j >= 0; --j) {
-        if (k >= 0) {
-          x = refY[j];
-          y = tempY[j + kp];
-          xE = refE[j];
-          yE = tempE[j + kp];
-        } else {
-          x = tempY[j];
-          y = refY[j + kp];
-          xE = tempE[j];
-          yE = refE[j + kp];
-        }
-        val += (x * y);
-        err2 += x * x * yE + y * y * xE;
-      }
-      outY[k + nY - 2] = (val * normalisation);
-      outE[k + nY - 2] = sqrt(val * val * normalisationE2 +
-                              normalisation * normalisation * err2);
+      // Negative shifts wrap around to the end of the correlations
+      const size_t j = k >= 0 ? k : fftSize + k;
+      // The sum of the positive terms may be rounded to below zero
+      const double kErr2 = std::max(err2[j], 0.0);
+      outY[k + nY - 2] = (val[j] * normalisation);
+      outE[k + nY - 2] = sqrt(val[j] * val[j] * normalisationE2 +
+                              normalisation * normalisation * kErr2);
     }
     // Update progress information
     // double prog=static_cast<double>(i)/nspecs;
@@ -24,6 +24,8 @@
 #include <cfloat>
 #include <iterator>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -38,6 +40,53 @@ namespace Algorithms {
 // Register the class into the algorithm factory
 DECLARE_ALGORITHM(DiffractionFocussing2)
 
+namespace {
+/// Appends events to out, converting them to the output event type T.
+template <class T, class In>
+typename std::enable_if<std::is_constructible<T, const In &>::value>::type
+appendEvents(const std::vector<In> &events, std::vector<T> &out) {
+  out.insert(out.end(), events.cbegin(), events.cend());
+}
+
+/// The output event type is the most general one of the input, so this is
+/// never called.
+template <class T, class In>
+typename std::enable_if<!std::is_constructible<T, const In &>::value>::type
+appendEvents(const std::vector<In> &, std::vector<T> &) {
+  throw std::logic_error("Cannot convert events to a less general type.");
+}
+
+template <class T>
+void appendEvents(const EventList &events, std::vector<T> &out) {
+  switch (events.getEventType()) {
+  case TOF:
+    appendEvents(events.getEvents(), out);
+    break;
+  case WEIGHTED:
+    appendEvents(events.getWeightedEvents(), out);
+    break;
+  case WEIGHTED_NOTIME:
+    appendEvents(events.getWeightedEventsNoTime(), out);
+    break;
+  }
+}
+
+/// The event vector of type T of an EventList.
+template <class T> std::vector<T> &eventsOfType(EventList &events);
+template <>
+std::vector<Types::Event::TofEvent> &eventsOfType(EventList &events) {
+  return events.getEvents();
+}
+template <> std::vector<WeightedEvent> &eventsOfType(EventList &events) {
+  return events.getWeightedEvents();
+}
+template <>
+std::vector<WeightedEventNoTime> &eventsOfType(EventList &events) {
+  return events.getWeightedEventsNoTime();
+}
+
+} // namespace
+
 /** Initialisation method. Declares properties to be used in algorithm.
  *
  */
@@ -352,103 +401,34 @@ void DiffractionFocussing2::execEvent() {
   std::unique_ptr<Progress> prog =
       make_unique<Progress>(this, 0.2, 0.25, nGroups);
 
-  // determine precount size
-  vector<size_t> size_required(this->m_validGroups.size(), 0);
   int totalHistProcess = 0;
-  for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
-    const vector<size_t> &indices = this->m_wsIndices[iGroup];
-
+  for (const auto &indices : m_wsIndices)
     totalHistProcess += static_cast<int>(indices.size());
-    for (auto index : indices) {
-      size_required[iGroup] += m_eventW->getSpectrum(index).getNumberEvents();
-    }
-    prog->report(1, "Pre-counting");
-  }
 
   // ------------- Pre-allocate Event Lists ----------------------------
-  prog.reset();
-  prog = make_unique<Progress>(this, 0.25, 0.3, totalHistProcess);
-
-  // This creates and reserves the space required
   for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
     const int group = static_cast<int>(m_validGroups[iGroup]);
     EventList &groupEL = out->getSpectrum(iGroup);
     groupEL.switchTo(eventWtype);
-    groupEL.reserve(size_required[iGroup]);
     groupEL.clearDetectorIDs();
     groupEL.setSpectrumNo(group);
-    prog->reportIncrement(1, "Allocating");
+    prog->report("Allocating");
   }
 
   // ----------- Focus ---------------
   prog.reset();
-  prog = make_unique<Progress>(this, 0.3, 0.9, totalHistProcess);
-
-  if (this->m_validGroups.size() == 1) {
-    g_log.information() << "Performing focussing on a single group\n";
-    // Special case of a single group - parallelize differently
-    EventList &groupEL = out->getSpectrum(0);
-    const std::vector<size_t> &indices = this->m_wsIndices[0];
-
-    int chunkSize = 200;
-
-    int end = (totalHistProcess / chunkSize) + 1;
-    // cppcheck-suppress syntaxError
-    PRAGMA_OMP(parallel for schedule(dynamic, 1) )
-    for (int wiChunk = 0; wiChunk < end; wiChunk++) {
-      PARALLEL_START_INTERUPT_REGION
-
-      // Perform in chunks for more efficiency
-      int max = (wiChunk + 1) * chunkSize;
-      if (max > totalHistProcess)
-        max = totalHistProcess;
-
-      // Make a blank EventList that will accumulate the chunk.
-      EventList chunkEL;
-      chunkEL.switchTo(eventWtype);
-      // chunkEL.reserve(numEventsInChunk);
-
-      // process the chunk
-      for (int i = wiChunk * chunkSize; i < max; i++) {
-        // Accumulate the chunk
-        size_t wi = indices[i];
-        chunkEL += m_eventW->getSpectrum(wi);
-      }
-
-      // Rejoin the chunk with the rest.
-      PARALLEL_CRITICAL(DiffractionFocussing2_JoinChunks) {
-        groupEL += chunkEL;
-      }
-
-      PARALLEL_END_INTERUPT_REGION
-    }
-    PARALLEL_CHECK_INTERUPT_REGION
-  } else {
-    // ------ PARALLELIZE BY GROUPS -------------------------
-
-    int nValidGroups = static_cast<int>(this->m_validGroups.size());
-    PARALLEL_FOR_IF(Kernel::threadSafe(*m_eventW))
-    for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
-      PARALLEL_START_INTERUPT_REGION
-      const std::vector<size_t> &indices = this->m_wsIndices[iGroup];
-      for (auto wi : indices) {
-        // In workspace index iGroup, put what was in the OLD workspace index wi
-        out->getSpectrum(iGroup) += m_eventW->getSpectrum(wi);
-
-        prog->reportIncrement(1, "Appending Lists");
-
-        // When focussing in place, you can clear out old memory from the input
-        // one!
-        if (inPlace) {
-          boost::const_pointer_cast<EventWorkspace>(m_eventW)
-              ->getSpectrum(wi)
-              .clear();
-        }
-      }
-      PARALLEL_END_INTERUPT_REGION
-    }
-    PARALLEL_CHECK_INTERUPT_REGION
-  } // (done with parallel by groups)
+  prog = make_unique<Progress>(this, 0.25, 0.9, totalHistProcess);
+  switch (eventWtype) {
+  case TOF:
+    scatterEvents<Types::Event::TofEvent>(*out, *prog, inPlace);
+    break;
+  case WEIGHTED:
+    scatterEvents<WeightedEvent>(*out, *prog, inPlace);
+    break;
+  case WEIGHTED_NOTIME:
+    scatterEvents<WeightedEventNoTime>(*out, *prog, inPlace);
+    break;
+  }
 
   // Now that the data is cleaned up, go through it and set the X vectors to the
   // input workspace we first talked about.
@@ -485,6 +465,47 @@ void DiffractionFocussing2::execEvent() {
   setProperty("OutputWorkspace", std::move(out));
 }
 
+/** Copies the events of all input spectra into their group's output list.
+ * Each output list reserves its final size once, then the events of its
+ * spectra are appended, so every output event is written a single time.
+ * @param output :: the focussed workspace, one spectrum per group
+ * @param progress :: reports one step per input spectrum
+ * @param inPlace :: whether to clear input spectra once they are copied
+ */
+template <class T>
+void DiffractionFocussing2::scatterEvents(EventWorkspace &output,
+                                          Progress &progress,
+                                          const bool inPlace) {
+  const auto &input = *m_eventW;
+  const auto &wsIndices = m_wsIndices;
+  const auto numGroups = static_cast<int64_t>(wsIndices.size());
+  PARALLEL_FOR_IF(Kernel::threadSafe(input, output))
+  for (int64_t group = 0; group < numGroups; ++group) {
+    PARALLEL_START_INTERUPT_REGION
+    size_t groupSize(0);
+    for (const auto wi : wsIndices[group])
+      groupSize += input.getSpectrum(wi).getNumberEvents();
+    auto &groupList = output.getSpectrum(group);
+    auto &events = eventsOfType<T>(groupList);
+    events.reserve(groupSize);
+    for (const auto wi : wsIndices[group]) {
+      const auto &inputList = input.getSpectrum(wi);
+      groupList.addDetectorIDs(inputList.getDetectorIDs());
+      appendEvents(inputList, events);
+      // When focussing in place, you can clear out old memory from the input
+      // one!
+      if (inPlace)
+        boost::const_pointer_cast<EventWorkspace>(m_eventW)
+            ->getSpectrum(wi)
+            .clear();
+      progress.report("Copying events");
+    }
+    groupList.setSortOrder(UNSORTED);
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+}
+
 //=============================================================================
 /** Verify that all the contributing detectors to a spectrum belongs to the same
  * group
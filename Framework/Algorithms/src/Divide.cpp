@@ -8,10 +8,12 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAlgorithms/Divide.h"
+#include "MantidHistogramData/VectorArithmetic.h"
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 using namespace Mantid::DataObjects;
+using namespace Mantid::HistogramData;
 
 namespace Mantid {
 namespace Algorithms {
@@ -40,28 +42,16 @@ void Divide::performBinaryOperation(const MantidVec &lhsX,
                                     MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
 
-  const int bins = static_cast<int>(lhsE.size());
-
-  for (int j = 0; j < bins; ++j) {
-    // Get references to the input Y's
-    const double leftY = lhsY[j];
-    const double rightY = rhsY[j];
-
-    //  error dividing two uncorrelated numbers, re-arrange so that you don't
-    //  get infinity if leftY==0 (when rightY=0 the Y value and the result will
-    //  both be infinity)
-    // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
-    // (Sa c/a)2 + (Sb c/b)2 = (Sc)2
-    // = (Sa 1/b)2 + (Sb (a/b2))2
-    // (Sc)2 = (1/b)2( (Sa)2 + (Sb a/b)2 )
-    EOut[j] =
-        sqrt(pow(lhsE[j], 2) + pow(leftY * rhsE[j] / rightY, 2)) / fabs(rightY);
-
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY / rightY;
-    ;
-  }
+  //  error dividing two uncorrelated numbers, re-arrange so that you don't
+  //  get infinity if leftY==0 (when rightY=0 the Y value and the result will
+  //  both be infinity)
+  // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
+  // (Sa c/a)2 + (Sb c/b)2 = (Sc)2
+  // = (Sa 1/b)2 + (Sb (a/b2))2
+  // (Sc)2 = (1/b)2( (Sa)2 + (Sb a/b)2 )
+  VectorArithmetic::divideWithErrors(lhsY.data(), lhsE.data(), rhsY.data(),
+                                     rhsE.data(), YOut.data(), EOut.data(),
+                                     lhsE.size());
 }
 
 void Divide::performBinaryOperation(const MantidVec &lhsX,
@@ -76,19 +66,9 @@ void Divide::performBinaryOperation(const MantidVec &lhsX,
                        "with value zero."
                     << "\n";
 
-  // Do the right-hand part of the error calculation just once
-  const double rhsFactor = pow(rhsE / rhsY, 2);
-  const int bins = static_cast<int>(lhsE.size());
-  for (int j = 0; j < bins; ++j) {
-    // Get reference to input Y
-    const double leftY = lhsY[j];
-
-    // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhsE[j], 2) + pow(leftY, 2) * rhsFactor) / fabs(rhsY);
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY / rhsY;
-  }
+  // see comment in the function above for the error formula
+  VectorArithmetic::divideWithErrors(lhsY.data(), lhsE.data(), rhsY, rhsE,
+                                     YOut.data(), EOut.data(), lhsE.size());
 }
 
 void Divide::setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
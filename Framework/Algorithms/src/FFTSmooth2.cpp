@@ -10,11 +10,15 @@
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/FFTService.h"
 #include "MantidKernel/ListValidator.h"
 
 #include <boost/algorithm/string/detail/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -69,7 +73,8 @@ void FFTSmooth2::exec() {
   int s0 = getProperty("WorkspaceIndex");
   // By default only do one
   int send = s0 + 1;
-  if (getProperty("AllSpectra")) { // Except if AllSpectra
+  const bool allSpectra = getProperty("AllSpectra");
+  if (allSpectra) { // Except if AllSpectra
     s0 = 0;
     send = static_cast<int>(inWS->getNumberHistograms());
   }
@@ -77,158 +82,119 @@ void FFTSmooth2::exec() {
   API::MatrixWorkspace_sptr outWS = API::WorkspaceFactory::Instance().create(
       inWS, send - s0, inWS->x(0).size(), inWS->y(0).size());
 
-  // Symmetrize the input spectrum
-  int dn = static_cast<int>(inWS->y(0).size());
-  API::MatrixWorkspace_sptr symmWS = API::WorkspaceFactory::Instance().create(
-      "Workspace2D", 1, inWS->x(0).size() + dn, inWS->y(0).size() + dn);
+  // Read the filter parameters
+  const std::string type = getProperty("Filter");
+  int n(2), order(2);
+  if (type == "Zeroing") {
+    std::string sn = getProperty("Params");
+    if (!sn.empty())
+      n = std::stoi(sn);
+    if (n <= 1)
+      throw std::invalid_argument(
+          "Truncation parameter must be an integer > 1");
+  } else if (type == "Butterworth") {
+    std::string string_params = getProperty("Params");
+    std::vector<std::string> params;
+    boost::split(params, string_params,
+                 boost::algorithm::detail::is_any_ofF<char>(" ,:;\t"));
+    if (params.size() == 2) {
+      std::string param0 = params.at(0);
+      std::string param1 = params.at(1);
+      n = std::stoi(param0);
+      order = std::stoi(param1);
+    }
+    if (n <= 1)
+      throw std::invalid_argument(
+          "Truncation parameter must be an integer > 1");
+    if (order < 1)
+      throw std::invalid_argument(
+          "Butterworth filter order must be an integer >= 1");
+  }
+
+  // The input spectrum is symmetrized to twice its length, so its ends join
+  // smoothly when the transform repeats it
+  const int dn = static_cast<int>(inWS->y(0).size());
+  const auto plan = FFTService::plan(2 * dn);
+  const bool isHistogram = inWS->isHistogramData();
 
-  Progress progress(this, 0.0, 1.0, 4 * (send - s0));
+  Progress progress(this, 0.0, 1.0, send - s0);
 
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inWS, *outWS))
   for (int spec = s0; spec < send; spec++) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto &x = inWS->x(spec);
+    const auto &y = inWS->y(spec);
     // Save the starting x value so it can be restored after all transforms.
-    double x0 = inWS->x(spec)[0];
-
-    double dx = (inWS->x(spec).back() - inWS->x(spec).front()) /
-                (static_cast<double>(inWS->x(spec).size()) - 1.0);
-
-    progress.report();
+    double x0 = x[0];
 
-    auto &symX = symmWS->mutableX(0);
-    auto &symY = symmWS->mutableY(0);
+    double dx = (x.back() - x.front()) / (static_cast<double>(x.size()) - 1.0);
 
+    // Symmetrize the input spectrum
+    std::vector<double> symX(x.size() + dn);
+    std::vector<double> symY(y.size() + dn);
     for (int i = 0; i < dn; i++) {
-      symX[dn + i] = inWS->x(spec)[i];
-      symY[dn + i] = inWS->y(spec)[i];
+      symX[dn + i] = x[i];
+      symY[dn + i] = y[i];
 
       symX[dn - i] = x0 - dx * i;
-      symY[dn - i] = inWS->y(spec)[i];
+      symY[dn - i] = y[i];
     }
-    symY.front() = inWS->y(spec).back();
+    symY.front() = y.back();
     symX.front() = x0 - dx * dn;
-    if (inWS->isHistogramData())
-      symX.back() = inWS->x(spec).back();
-
-    // setProperty("OutputWorkspace",symmWS); return;
-
-    progress.report("Calculating FFT");
-    // Forward Fourier transform
-    IAlgorithm_sptr fft = createChildAlgorithm("RealFFT", 0, 0.5);
-    fft->setProperty("InputWorkspace", symmWS);
-    fft->setProperty("WorkspaceIndex", 0);
-    fft->setProperty("IgnoreXBins", ignoreXBins);
-    try {
-      fft->execute();
-    } catch (...) {
-      g_log.error("Error in direct FFT algorithm");
-      throw;
+    if (isHistogram)
+      symX.back() = x.back();
+
+    // Check that the x values are evenly spaced
+    if (!ignoreXBins) {
+      const double symDx = (symX.back() - symX.front()) /
+                           static_cast<double>(symX.size() - 1);
+      for (size_t i = 0; i < symX.size() - 2; i++)
+        if (std::abs(symDx - symX[i + 1] + symX[i]) / symDx > 1e-7)
+          throw std::invalid_argument(
+              "X axis must be linear (all bins have same "
+              "width). This can be ignored if "
+              "IgnoreXBins is set to true.");
     }
 
-    API::MatrixWorkspace_sptr unfilteredWS =
-        fft->getProperty("OutputWorkspace");
-    API::MatrixWorkspace_sptr filteredWS;
+    // Forward Fourier transform
+    plan->forward(symY.data());
 
     // Apply the filter
-    std::string type = getProperty("Filter");
-
-    if (type == "Zeroing") {
-      std::string sn = getProperty("Params");
-      int n;
-      if (sn.empty())
-        n = 2;
-      else
-        n = std::stoi(sn);
-      if (n <= 1)
-        throw std::invalid_argument(
-            "Truncation parameter must be an integer > 1");
-
-      progress.report("Zero Filter");
-
-      zero(n, unfilteredWS, filteredWS);
-    } else if (type == "Butterworth") {
-      int n, order;
-
-      std::string string_params = getProperty("Params");
-      std::vector<std::string> params;
-      boost::split(params, string_params,
-                   boost::algorithm::detail::is_any_ofF<char>(" ,:;\t"));
-      if (params.size() != 2) {
-        n = 2;
-        order = 2;
-      } else {
-        std::string param0 = params.at(0);
-        std::string param1 = params.at(1);
-        n = std::stoi(param0);
-        order = std::stoi(param1);
-      }
-      if (n <= 1)
-        throw std::invalid_argument(
-            "Truncation parameter must be an integer > 1");
-      if (order < 1)
-        throw std::invalid_argument(
-            "Butterworth filter order must be an integer >= 1");
-
-      progress.report("ButterWorth Filter");
-      Butterworth(n, order, unfilteredWS, filteredWS);
-    }
+    if (type == "Zeroing")
+      zero(n, symY);
+    else if (type == "Butterworth")
+      Butterworth(n, order, symY);
 
-    progress.report("Backward Transformation");
     // Backward transform
-    fft = createChildAlgorithm("RealFFT", 0.5, 1.);
-    fft->setProperty("InputWorkspace", filteredWS);
-    fft->setProperty("Transform", "Backward");
-    fft->setProperty("IgnoreXBins", ignoreXBins);
-    try {
-      fft->execute();
-    } catch (...) {
-      g_log.error("Error in inverse FFT algorithm");
-      throw;
-    }
-    API::MatrixWorkspace_sptr tmpWS = fft->getProperty("OutputWorkspace");
-
-    // FIXME: The intent of the following line is not clear. std::floor or
-    // std::ceil should
-    // probably be used.
-    dn = static_cast<int>(tmpWS->blocksize()) / 2;
-
-    if (getProperty("AllSpectra")) {
-      outWS->setSharedX(spec, inWS->sharedX(spec));
-      outWS->mutableY(spec).assign(tmpWS->y(0).cbegin() + dn,
-                                   tmpWS->y(0).cend());
-    } else {
-      outWS->setSharedX(0, inWS->sharedX(spec));
-      outWS->mutableY(0).assign(tmpWS->y(0).cbegin() + dn, tmpWS->y(0).cend());
-    }
+    plan->inverse(symY.data());
+
+    const int outIndex = allSpectra ? spec : 0;
+    outWS->setSharedX(outIndex, inWS->sharedX(spec));
+    outWS->mutableY(outIndex).assign(symY.cbegin() + dn, symY.cend());
+
+    progress.report();
+    PARALLEL_END_INTERUPT_REGION
   }
+  PARALLEL_CHECK_INTERUPT_REGION
 
   setProperty("OutputWorkspace", outWS);
 }
 
 /** Smoothing by zeroing.
  *  @param n :: The order of truncation
- *  @param unfilteredWS :: workspace for storing the unfiltered Fourier
- * transform of the input spectrum
- *  @param filteredWS :: workspace for storing the filtered spectrum
+ *  @param transform :: the Fourier transform of the symmetrized spectrum in
+ * half-complex order, filtered in place
  */
-void FFTSmooth2::zero(int n, API::MatrixWorkspace_sptr &unfilteredWS,
-                      API::MatrixWorkspace_sptr &filteredWS) {
-  int mx = static_cast<int>(unfilteredWS->x(0).size());
-  int my = static_cast<int>(unfilteredWS->y(0).size());
+void FFTSmooth2::zero(int n, std::vector<double> &transform) const {
+  // The number of frequencies, including zero
+  int my = static_cast<int>(transform.size()) / 2 + 1;
   int ny = my / n;
 
   if (ny == 0)
     ny = 1;
 
-  filteredWS =
-      API::WorkspaceFactory::Instance().create(unfilteredWS, 2, mx, my);
-
-  filteredWS->setSharedX(0, unfilteredWS->sharedX(0));
-  filteredWS->setSharedX(1, unfilteredWS->sharedX(0));
-
-  std::copy(unfilteredWS->y(0).cbegin(), unfilteredWS->y(0).begin() + ny,
-            filteredWS->mutableY(0).begin());
-
-  std::copy(unfilteredWS->y(1).cbegin(), unfilteredWS->y(1).begin() + ny,
-            filteredWS->mutableY(1).begin());
+  // Frequency k is stored at 2k - 1 and 2k
+  std::fill(transform.begin() + (2 * ny - 1), transform.end(), 0.0);
 }
 
 /** Smoothing using Butterworth filter.
@@ -240,38 +206,27 @@ void FFTSmooth2::zero(int n, API::MatrixWorkspace_sptr &unfilteredWS,
  *               and set to 1 if the truncated value was zero.
  *  @param order :: The order of the Butterworth filter, 1, 2, etc.
  *               This must be a positive integer.
- *  @param unfilteredWS :: workspace for storing the unfiltered Fourier
- * transform of the input spectrum
- *  @param filteredWS :: workspace for storing the filtered spectrum
+ *  @param transform :: the Fourier transform of the symmetrized spectrum in
+ * half-complex order, filtered in place
  */
 void FFTSmooth2::Butterworth(int n, int order,
-                             API::MatrixWorkspace_sptr &unfilteredWS,
-                             API::MatrixWorkspace_sptr &filteredWS) {
-  int mx = static_cast<int>(unfilteredWS->x(0).size());
-  int my = static_cast<int>(unfilteredWS->y(0).size());
+                             std::vector<double> &transform) const {
+  // The number of frequencies, including zero
+  int my = static_cast<int>(transform.size()) / 2 + 1;
   int ny = my / n;
 
   if (ny == 0)
     ny = 1;
 
-  filteredWS =
-      API::WorkspaceFactory::Instance().create(unfilteredWS, 2, mx, my);
-
-  filteredWS->setSharedX(0, unfilteredWS->sharedX(0));
-  filteredWS->setSharedX(1, unfilteredWS->sharedX(0));
-
-  auto &Yr = unfilteredWS->y(0);
-  auto &Yi = unfilteredWS->y(1);
-  auto &yr = filteredWS->mutableY(0);
-  auto &yi = filteredWS->mutableY(1);
-
   double cutoff = ny;
 
-  for (int i = 0; i < my; i++) {
+  for (int i = 1; i < my; i++) {
     double scale =
         1.0 / (1.0 + pow(static_cast<double>(i) / cutoff, 2 * order));
-    yr[i] = scale * Yr[i];
-    yi[i] = scale * Yi[i];
+    // Frequency i is stored at 2i - 1 and 2i, except the highest one
+    transform[2 * i - 1] *= scale;
+    if (2 * i < static_cast<int>(transform.size()))
+      transform[2 * i] *= scale;
   }
 }
 
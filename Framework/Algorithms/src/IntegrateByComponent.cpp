@@ -188,7 +188,7 @@ IntegrateByComponent::makeMap(API::MatrixWorkspace_sptr countsWS, int parents) {
     return makeInstrumentMap(countsWS);
   }
 
-  const auto spectrumInfo = countsWS->spectrumInfo();
+  const auto &spectrumInfo = countsWS->spectrumInfo();
   const auto &detectorInfo = countsWS->detectorInfo();
   for (size_t i = 0; i < countsWS->getNumberHistograms(); i++) {
     if (!spectrumInfo.hasDetectors(i)) {
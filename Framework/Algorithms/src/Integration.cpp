@@ -16,9 +16,11 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/VectorHelper.h"
+#include "MantidKernel/make_cow.h"
 
 #include <cmath>
 #include <numeric>
+#include <tuple>
 
 namespace Mantid {
 namespace Algorithms {
@@ -76,6 +78,22 @@ public:
   }
 };
 
+namespace {
+/// Finds the range of bin edges of X within [lowerLimit, upperLimit], with
+/// EMPTY_DBL() meaning no limit.
+std::pair<MantidVec::const_iterator, MantidVec::const_iterator>
+findIntegrationRange(const HistogramData::HistogramX &X,
+                     const double lowerLimit, const double upperLimit) {
+  auto lowit = X.begin();
+  if (lowerLimit != EMPTY_DBL())
+    lowit = std::lower_bound(X.begin(), X.end(), lowerLimit, tolerant_less());
+  auto highit = X.end();
+  if (upperLimit != EMPTY_DBL())
+    highit = std::upper_bound(lowit, X.end(), upperLimit, tolerant_less());
+  return {lowit, highit};
+}
+} // namespace
+
 /** Executes the algorithm
  *
  *  @throw runtime_error Thrown if algorithm cannot execute
@@ -167,6 +185,26 @@ void Integration::exec() {
   bool is_distrib = outputWorkspace->isDistribution();
   Progress progress(this, progressStart, 1.0, maxWsIndex - minWsIndex + 1);
 
+  // If all spectra have the same bins and limits the integration range is
+  // found only once, and the output spectra share their X data.
+  const auto commonX = localworkspace->commonX();
+  const bool commonRange = commonX && minRanges.empty() && maxRanges.empty();
+  std::pair<std::ptrdiff_t, std::ptrdiff_t> commonOffsets{0, 0};
+  Kernel::cow_ptr<HistogramData::HistogramX> commonOutputX(nullptr);
+  if (commonRange) {
+    const auto &X = *commonX;
+    auto range = findIntegrationRange(X, minRange, maxRange);
+    commonOffsets.first = std::distance(X.begin(), range.first);
+    commonOffsets.second = std::distance(X.begin(), range.second);
+    if (incPartBins) {
+      commonOutputX = Kernel::make_cow<HistogramData::HistogramX>(
+          std::initializer_list<double>{minRange, maxRange});
+    } else if (range.first != X.end() && range.second != X.begin()) {
+      commonOutputX = Kernel::make_cow<HistogramData::HistogramX>(
+          std::initializer_list<double>{*range.first, *(range.second - 1)});
+    }
+  }
+
   const bool axisIsText = localworkspace->getAxis(1)->isText();
   const bool axisIsNumeric = localworkspace->getAxis(1)->isNumeric();
 
@@ -213,8 +251,12 @@ void Integration::exec() {
     // values regardless of whether they're 'in range' for this spectrum
     // Have to do this here, ahead of the 'continue' a bit down from here.
     if (incPartBins) {
-      outSpec.dataX()[0] = lowerLimit;
-      outSpec.dataX()[1] = upperLimit;
+      if (commonOutputX) {
+        outSpec.setSharedX(commonOutputX);
+      } else {
+        outSpec.dataX()[0] = lowerLimit;
+        outSpec.dataX()[1] = upperLimit;
+      }
     }
 
     if (upperLimit < lowerLimit) {
@@ -226,16 +268,12 @@ void Integration::exec() {
       progress.report();
       continue;
     }
-    if (lowerLimit == EMPTY_DBL()) {
-      lowit = X.begin();
-    } else {
-      lowit = std::lower_bound(X.begin(), X.end(), lowerLimit, tolerant_less());
-    }
-
-    if (upperLimit == EMPTY_DBL()) {
-      highit = X.end();
+    if (commonRange) {
+      lowit = X.begin() + commonOffsets.first;
+      highit = X.begin() + commonOffsets.second;
     } else {
-      highit = std::upper_bound(lowit, X.end(), upperLimit, tolerant_less());
+      std::tie(lowit, highit) =
+          findIntegrationRange(X, lowerLimit, upperLimit);
     }
 
     // If range specified doesn't overlap with this spectrum then bail out
@@ -317,6 +355,8 @@ void Integration::exec() {
           sumF += Fmax * fraction;
         }
       }
+    } else if (commonOutputX) {
+      outSpec.setSharedX(commonOutputX);
     } else {
       outSpec.mutableX()[0] = lowit == X.end() ? *(lowit - 1) : *(lowit);
       outSpec.mutableX()[1] = *highit;
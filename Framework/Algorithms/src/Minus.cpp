@@ -8,10 +8,11 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAlgorithms/Minus.h"
-#include "MantidKernel/VectorHelper.h"
+#include "MantidHistogramData/VectorArithmetic.h"
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
+using namespace Mantid::HistogramData;
 
 namespace Mantid {
 namespace Algorithms {
@@ -25,10 +26,10 @@ void Minus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
                                    const MantidVec &rhsE, MantidVec &YOut,
                                    MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
-  std::transform(lhsY.begin(), lhsY.end(), rhsY.begin(), YOut.begin(),
-                 std::minus<double>());
-  std::transform(lhsE.begin(), lhsE.end(), rhsE.begin(), EOut.begin(),
-                 VectorHelper::SumGaussError<double>());
+  VectorArithmetic::subtract(lhsY.data(), rhsY.data(), YOut.data(),
+                             lhsY.size());
+  VectorArithmetic::addErrors(lhsE.data(), rhsE.data(), EOut.data(),
+                              lhsE.size());
 }
 
 void Minus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
@@ -40,8 +41,7 @@ void Minus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
                  std::bind2nd(std::minus<double>(), rhsY));
   // Only do E if non-zero, otherwise just copy
   if (rhsE != 0)
-    std::transform(lhsE.begin(), lhsE.end(), EOut.begin(),
-                   std::bind2nd(VectorHelper::SumGaussError<double>(), rhsE));
+    VectorArithmetic::addErrors(lhsE.data(), rhsE, EOut.data(), lhsE.size());
   else
     EOut = lhsE;
 }
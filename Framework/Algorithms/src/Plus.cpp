@@ -8,11 +8,12 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAlgorithms/Plus.h"
-#include "MantidKernel/VectorHelper.h"
+#include "MantidHistogramData/VectorArithmetic.h"
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
 using namespace Mantid::DataObjects;
+using namespace Mantid::HistogramData;
 
 namespace Mantid {
 namespace Algorithms {
@@ -27,10 +28,9 @@ void Plus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
                                   const MantidVec &rhsE, MantidVec &YOut,
                                   MantidVec &EOut) {
   (void)lhsX; // Avoid compiler warning
-  std::transform(lhsY.begin(), lhsY.end(), rhsY.begin(), YOut.begin(),
-                 std::plus<double>());
-  std::transform(lhsE.begin(), lhsE.end(), rhsE.begin(), EOut.begin(),
-                 VectorHelper::SumGaussError<double>());
+  VectorArithmetic::add(lhsY.data(), rhsY.data(), YOut.data(), lhsY.size());
+  VectorArithmetic::addErrors(lhsE.data(), rhsE.data(), EOut.data(),
+                              lhsE.size());
 }
 
 //---------------------------------------------------------------------------------------------
@@ -43,8 +43,7 @@ void Plus::performBinaryOperation(const MantidVec &lhsX, const MantidVec &lhsY,
                  std::bind2nd(std::plus<double>(), rhsY));
   // Only do E if non-zero, otherwise just copy
   if (rhsE != 0)
-    std::transform(lhsE.begin(), lhsE.end(), EOut.begin(),
-                   std::bind2nd(VectorHelper::SumGaussError<double>(), rhsE));
+    VectorArithmetic::addErrors(lhsE.data(), rhsE, EOut.data(), lhsE.size());
   else
     EOut = lhsE;
 }
@@ -9,11 +9,7 @@
 #include "MantidAPI/TextAxis.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidKernel/Exception.h"
-
-#include <boost/shared_array.hpp>
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_fft_halfcomplex.h>
-#include <gsl/gsl_fft_real.h>
+#include "MantidKernel/FFTService.h"
 
 #define REAL(z, i) ((z)[2 * (i)])
 #define IMAG(z, i) ((z)[2 * (i) + 1])
@@ -108,18 +104,9 @@ void RealFFT::exec() {
     tAxis->setLabel(2, "Modulus");
     outWS->replaceAxis(1, tAxis);
 
-    gsl_fft_real_workspace *workspace = gsl_fft_real_workspace_alloc(ySize);
-    boost::shared_array<double> data(new double[2 * ySize]);
-
-    auto &yData = inWS->mutableY(spec);
-    for (int i = 0; i < ySize; i++) {
-      data[i] = yData[i];
-    }
-
-    gsl_fft_real_wavetable *wavetable = gsl_fft_real_wavetable_alloc(ySize);
-    gsl_fft_real_transform(data.get(), 1, ySize, wavetable, workspace);
-    gsl_fft_real_wavetable_free(wavetable);
-    gsl_fft_real_workspace_free(workspace);
+    auto &yData = inWS->y(spec);
+    std::vector<double> data(yData.cbegin(), yData.cend());
+    FFTService::plan(ySize)->forward(data.data());
 
     auto &x = outWS->mutableX(0);
     auto &y1 = outWS->mutableY(0);
@@ -159,8 +146,6 @@ void RealFFT::exec() {
     tAxis->setLabel(0, "Real");
     outWS->replaceAxis(1, tAxis);
 
-    gsl_fft_real_workspace *workspace = gsl_fft_real_workspace_alloc(yOutSize);
-
     auto &xData = outWS->mutableX(0);
     auto &yData = outWS->mutableY(0);
     auto &y0 = inWS->mutableY(0);
@@ -178,13 +163,7 @@ void RealFFT::exec() {
       }
     }
 
-    gsl_fft_halfcomplex_wavetable *wavetable =
-        gsl_fft_halfcomplex_wavetable_alloc(yOutSize);
-
-    // &(yData[0]) because gsl func wants non const double data[]
-    gsl_fft_halfcomplex_inverse(&(yData[0]), 1, yOutSize, wavetable, workspace);
-    gsl_fft_halfcomplex_wavetable_free(wavetable);
-    gsl_fft_real_workspace_free(workspace);
+    FFTService::plan(yOutSize)->inverse(&(yData[0]));
 
     std::generate(xData.begin(), xData.end(),
                   HistogramData::LinearGenerator(0, df));
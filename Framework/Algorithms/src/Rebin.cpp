@@ -250,6 +250,14 @@ void Rebin::exec() {
       outputWS->replaceAxis(1, inputWS->getAxis(1)->clone(outputWS.get()));
     bool ignoreBinErrors = getProperty("IgnoreBinErrors");
 
+    // With common input bins the overlaps with the new bins are computed once
+    boost::shared_ptr<const HistogramData::RebinOperator> rebinOperator;
+    try {
+      rebinOperator = inputWS->rebinOperator(XValues_new);
+    } catch (InvalidBinEdgesError &) {
+      // Handled for each spectrum below
+    }
+
     Progress prog(this, 0.0, 1.0, histnumber);
     PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
     for (int hist = 0; hist < histnumber; ++hist) {
@@ -257,7 +265,10 @@ void Rebin::exec() {
 
       try {
         outputWS->setHistogram(
-            hist, HistogramData::rebin(inputWS->histogram(hist), XValues_new));
+            hist, rebinOperator
+                      ? rebinOperator->apply(inputWS->histogram(hist))
+                      : HistogramData::rebin(inputWS->histogram(hist),
+                                             XValues_new));
       } catch (InvalidBinEdgesError &) {
         if (ignoreBinErrors)
           outputWS->setBinEdges(hist, XValues_new);
@@ -10,6 +10,7 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidHistogramData/Exception.h"
 #include "MantidHistogramData/Rebin.h"
 
 namespace Mantid {
@@ -130,6 +131,17 @@ void RebinToWorkspace::rebin(MatrixWorkspace_sptr &toRebin,
   const bool matchingX =
       (toRebin->getNumberHistograms() != toMatch->getNumberHistograms());
 
+  // If all spectra are rebinned to the same bins and the input bins are
+  // common too, the overlaps of the bins are computed once
+  boost::shared_ptr<const HistogramData::RebinOperator> rebinOperator;
+  if (!m_isEvents && (matchingX || toMatch->commonX())) {
+    try {
+      rebinOperator = toRebin->rebinOperator(toMatch->binEdges(0));
+    } catch (HistogramData::Exception::InvalidBinEdgesError &) {
+      // Reported by rebin() for the failing spectrum
+    }
+  }
+
   // rebin
   PARALLEL_FOR_IF(Kernel::threadSafe(*toMatch, *outputWS))
   for (int i = 0; i < numHist; ++i) {
@@ -138,6 +150,8 @@ void RebinToWorkspace::rebin(MatrixWorkspace_sptr &toRebin,
                                   : toMatch->histogram(i).binEdges();
     if (m_isEvents) {
       outputWSEvents->getSpectrum(i).setHistogram(edges);
+    } else if (rebinOperator) {
+      outputWS->setHistogram(i, rebinOperator->apply(toRebin->histogram(i)));
     } else {
       outputWS->setHistogram(
           i, HistogramData::rebin(toRebin->histogram(i), edges));
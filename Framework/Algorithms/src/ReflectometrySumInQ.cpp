@@ -531,7 +531,7 @@ API::MatrixWorkspace_sptr
 ReflectometrySumInQ::sumInQ(const API::MatrixWorkspace &detectorWS,
                             const Indexing::SpectrumIndexSet &indices) {
 
-  const auto spectrumInfo = detectorWS.spectrumInfo();
+  const auto &spectrumInfo = detectorWS.spectrumInfo();
   const auto refAngles = referenceAngles(spectrumInfo);
   // Construct the output workspace in virtual lambda
   API::MatrixWorkspace_sptr IvsLam =
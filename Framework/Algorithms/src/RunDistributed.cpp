@@ -0,0 +1,267 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/RunDistributed.h"
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidIndexing/GlobalSpectrumIndex.h"
+#include "MantidIndexing/IndexInfo.h"
+#include "MantidIndexing/Scatter.h"
+#include "MantidIndexing/SpectrumNumber.h"
+#include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/Exception.h"
+#include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/ThreadBudget.h"
+#include "MantidParallel/Communicator.h"
+#include "MantidTypes/SpectrumDefinition.h"
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+namespace Mantid {
+namespace Algorithms {
+
+using namespace API;
+using namespace Kernel;
+using Indexing::GlobalSpectrumIndex;
+using Indexing::IndexInfo;
+
+// Register the algorithm into the AlgorithmFactory
+DECLARE_ALGORITHM(RunDistributed)
+
+namespace {
+namespace PropertyNames {
+const static std::string INPUT_WORKSPACE("InputWorkspace");
+const static std::string OUTPUT_WORKSPACE("OutputWorkspace");
+const static std::string ALGORITHM("Algorithm");
+const static std::string VERSION("Version");
+const static std::string ALGORITHM_PROPERTIES("AlgorithmProperties");
+const static std::string NUMBER_OF_RANKS("NumberOfRanks");
+} // namespace PropertyNames
+
+/** Create a workspace of the same type as `parent` with the given spectra,
+ * copying the experiment information and units but none of the data.
+ *
+ * WorkspaceCreation's create() cannot be used here: it copies the storage
+ * mode of the parent if both have the same number of spectra, which happens
+ * when one rank holds all the spectra of a workspace.
+ * @param parent :: the workspace to copy the metadata from
+ * @param indexInfo :: the spectra of the new workspace
+ * @param histogram :: the histogram every spectrum is initialized with
+ * @return the new workspace
+ */
+MatrixWorkspace_sptr createLike(const MatrixWorkspace &parent,
+                                const IndexInfo &indexInfo,
+                                const HistogramData::Histogram &histogram) {
+  MatrixWorkspace_sptr ws = parent.cloneEmpty();
+  // The instrument must be known before the spectrum definitions are set.
+  ws->setInstrument(parent.getInstrument());
+  ws->initialize(indexInfo, histogram);
+  ws->copyExperimentInfoFrom(&parent);
+  ws->setTitle(parent.getTitle());
+  ws->setComment(parent.getComment());
+  ws->setYUnit(parent.YUnit());
+  ws->setYUnitLabel(parent.YUnitLabel());
+  ws->setDistribution(parent.isDistribution());
+  ws->getAxis(0)->unit() = parent.getAxis(0)->unit();
+  return ws;
+}
+
+/// Copy the data and bin masks of spectrum `from` of `source` to spectrum `to`
+/// of `target`.
+void copySpectrum(const MatrixWorkspace &source, const size_t from,
+                  MatrixWorkspace &target, const size_t to) {
+  target.getSpectrum(to).copyDataFrom(source.getSpectrum(from));
+  if (source.hasMaskedBins(from))
+    target.setMaskedBins(to, source.maskedBins(from));
+}
+
+/** Create the part of `input` owned by the rank of `communicator`.
+ * @param input :: the full workspace
+ * @param globalIndexInfo :: the spectrum numbers and definitions of input
+ * @param communicator :: the communicator of the rank
+ * @return a workspace with storage mode Distributed
+ */
+MatrixWorkspace_sptr scatter(const MatrixWorkspace &input,
+                             const IndexInfo &globalIndexInfo,
+                             const Parallel::Communicator &communicator) {
+  std::vector<Indexing::SpectrumNumber> spectrumNumbers;
+  spectrumNumbers.reserve(globalIndexInfo.size());
+  for (size_t i = 0; i < globalIndexInfo.size(); ++i)
+    spectrumNumbers.push_back(globalIndexInfo.spectrumNumber(i));
+  IndexInfo indexInfo(std::move(spectrumNumbers),
+                      Parallel::StorageMode::Cloned, communicator);
+  indexInfo.setSpectrumDefinitions(globalIndexInfo.spectrumDefinitions());
+  const auto localIndexInfo = Indexing::scatter(indexInfo);
+
+  auto local = createLike(input, localIndexInfo, input.histogram(0));
+  size_t localIndex = 0;
+  for (size_t i = 0; i < globalIndexInfo.size(); ++i)
+    if (localIndexInfo.isOnThisPartition(static_cast<GlobalSpectrumIndex>(i)))
+      copySpectrum(input, i, *local, localIndex++);
+  return local;
+}
+
+/** Combine the Distributed outputs of all ranks into one workspace.
+ * @param parts :: the output of each rank
+ * @return a workspace with storage mode Cloned holding all spectra
+ */
+MatrixWorkspace_sptr gather(const std::vector<MatrixWorkspace_sptr> &parts) {
+  const size_t globalSize = parts.front()->indexInfo().globalSize();
+  if (globalSize == 0)
+    throw std::runtime_error("The algorithm produced no spectra.");
+  // Rank and local index of every global spectrum
+  std::vector<std::pair<size_t, size_t>> owners(globalSize);
+  for (size_t rank = 0; rank < parts.size(); ++rank) {
+    const auto &indexInfo = parts[rank]->indexInfo();
+    size_t localIndex = 0;
+    for (size_t i = 0; i < globalSize; ++i)
+      if (indexInfo.isOnThisPartition(static_cast<GlobalSpectrumIndex>(i)))
+        owners[i] = {rank, localIndex++};
+  }
+
+  std::vector<Indexing::SpectrumNumber> spectrumNumbers;
+  std::vector<SpectrumDefinition> spectrumDefinitions;
+  spectrumNumbers.reserve(globalSize);
+  spectrumDefinitions.reserve(globalSize);
+  for (const auto &owner : owners) {
+    const auto &indexInfo = parts[owner.first]->indexInfo();
+    spectrumNumbers.push_back(indexInfo.spectrumNumber(owner.second));
+    spectrumDefinitions.push_back(
+        (*indexInfo.spectrumDefinitions())[owner.second]);
+  }
+  IndexInfo indexInfo(std::move(spectrumNumbers));
+  indexInfo.setSpectrumDefinitions(std::move(spectrumDefinitions));
+
+  const auto &first = *parts[owners.front().first];
+  auto output =
+      createLike(first, indexInfo, first.histogram(owners.front().second));
+  for (size_t i = 0; i < globalSize; ++i)
+    copySpectrum(*parts[owners[i].first], owners[i].second, *output, i);
+  return output;
+}
+} // namespace
+
+void RunDistributed::init() {
+  declareProperty(make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      PropertyNames::INPUT_WORKSPACE, "", Direction::Input),
+                  "The workspace whose spectra are split between the ranks.");
+  declareProperty(make_unique<WorkspaceProperty<MatrixWorkspace>>(
+                      PropertyNames::OUTPUT_WORKSPACE, "", Direction::Output),
+                  "The combined output of all ranks.");
+  declareProperty(PropertyNames::ALGORITHM, "",
+                  boost::make_shared<MandatoryValidator<std::string>>(),
+                  "Name of the algorithm to run. It must have InputWorkspace "
+                  "and OutputWorkspace properties and support distributed "
+                  "execution.");
+  declareProperty(PropertyNames::VERSION, -1,
+                  "Version of the algorithm, -1 for the latest.");
+  declareProperty(PropertyNames::ALGORITHM_PROPERTIES, "",
+                  "The other properties of the algorithm as a list of "
+                  "name=value pairs separated by semicolons.");
+  auto nonNegative = boost::make_shared<BoundedValidator<int>>();
+  nonNegative->setLower(0);
+  declareProperty(PropertyNames::NUMBER_OF_RANKS, 0, nonNegative,
+                  "Number of ranks to run. 0 uses one rank per available "
+                  "thread. Never more ranks than spectra are used.");
+}
+
+std::map<std::string, std::string> RunDistributed::validateInputs() {
+  std::map<std::string, std::string> issues;
+  const std::string name = getProperty(PropertyNames::ALGORITHM);
+  const int version = getProperty(PropertyNames::VERSION);
+  try {
+    auto alg = AlgorithmManager::Instance().createUnmanaged(name, version);
+    alg->initialize();
+    for (const auto &property :
+         {PropertyNames::INPUT_WORKSPACE, PropertyNames::OUTPUT_WORKSPACE})
+      if (!alg->existsProperty(property))
+        issues[PropertyNames::ALGORITHM] =
+            name + " has no " + property + " property.";
+  } catch (Exception::NotFoundError &) {
+    issues[PropertyNames::ALGORITHM] = "No algorithm called " + name + ".";
+  }
+  MatrixWorkspace_const_sptr input =
+      getProperty(PropertyNames::INPUT_WORKSPACE);
+  if (input && input->getNumberHistograms() == 0)
+    issues[PropertyNames::INPUT_WORKSPACE] = "The workspace has no spectra.";
+  return issues;
+}
+
+void RunDistributed::exec() {
+  MatrixWorkspace_sptr input = getProperty(PropertyNames::INPUT_WORKSPACE);
+  const std::string name = getProperty(PropertyNames::ALGORITHM);
+  const int version = getProperty(PropertyNames::VERSION);
+  const std::string properties =
+      getProperty(PropertyNames::ALGORITHM_PROPERTIES);
+  int numRanks = getProperty(PropertyNames::NUMBER_OF_RANKS);
+  if (numRanks == 0)
+    numRanks = static_cast<int>(ThreadBudget::capacity());
+  numRanks = std::max(
+      1, std::min(numRanks, static_cast<int>(input->getNumberHistograms())));
+  g_log.information() << "Running " << name << " on " << numRanks
+                      << " ranks\n";
+
+  // The lazily updated IndexInfo must not be built concurrently by the ranks.
+  const auto &globalIndexInfo = input->indexInfo();
+  auto backend =
+      boost::make_shared<Parallel::detail::ThreadingBackend>(numRanks);
+  std::vector<MatrixWorkspace_sptr> outputs(numRanks);
+  std::vector<std::exception_ptr> errors(numRanks);
+  auto runRank = [&](const int rank) {
+    try {
+      Parallel::Communicator communicator(backend, rank);
+      const auto local = numRanks == 1
+                             ? input
+                             : scatter(*input, globalIndexInfo, communicator);
+      auto alg = AlgorithmManager::Instance().createUnmanaged(name, version);
+      alg->initialize();
+      alg->setChild(true);
+      alg->setRethrows(true);
+      alg->setCommunicator(communicator);
+      alg->setPropertiesWithString(properties,
+                                   {PropertyNames::INPUT_WORKSPACE,
+                                    PropertyNames::OUTPUT_WORKSPACE});
+      alg->setProperty(PropertyNames::INPUT_WORKSPACE, local);
+      alg->setPropertyValue(PropertyNames::OUTPUT_WORKSPACE,
+                            "__RunDistributed_rank" + std::to_string(rank));
+      alg->execute();
+      outputs[rank] = alg->getProperty(PropertyNames::OUTPUT_WORKSPACE);
+    } catch (...) {
+      errors[rank] = std::current_exception();
+    }
+  };
+
+  {
+    // Parallel loops inside the ranks share the remaining threads.
+    ThreadBudget::Reservation reservation(static_cast<size_t>(numRanks), true);
+    std::vector<std::thread> threads;
+    for (int rank = 1; rank < numRanks; ++rank)
+      threads.emplace_back(runRank, rank);
+    runRank(0);
+    for (auto &thread : threads)
+      thread.join();
+  }
+  for (const auto &error : errors)
+    if (error)
+      std::rethrow_exception(error);
+
+  progress(0.9, "Gathering results");
+  MatrixWorkspace_sptr output;
+  if (outputs.front()->storageMode() == Parallel::StorageMode::Distributed)
+    output = gather(outputs);
+  else
+    output = outputs.front();
+  setProperty(PropertyNames::OUTPUT_WORKSPACE, output);
+}
+
+} // namespace Algorithms
+} // namespace Mantid
@@ -12,11 +12,13 @@
 #include "MantidGeometry/IComponent.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/UnitFactory.h"
 
 #include <cfloat>
+#include <cmath>
 
 namespace Mantid {
 namespace Algorithms {
@@ -91,6 +93,12 @@ void SolidAngle::exec() {
   const auto &detectorInfo = inputWS->detectorInfo();
   const Kernel::V3D samplePos = spectrumInfo.samplePosition();
   g_log.debug() << "Sample position is " << samplePos << '\n';
+  // Solid angles of all detectors, cached alongside the instrument such that
+  // repeated calls do not need to recompute them.
+  boost::shared_ptr<const std::vector<double>> detectorSolidAngles;
+  if (!detectorInfo.isScanning())
+    detectorSolidAngles =
+        inputWS->componentInfo().detectorSolidAngles(samplePos);
 
   const int loopIterations = m_MaxSpec - m_MinSpec;
   int failCount = 0;
@@ -107,7 +115,11 @@ void SolidAngle::exec() {
       double solidAngle = 0.0;
       for (const auto detID : inputWS->getSpectrum(i).getDetectorIDs()) {
         const auto index = detectorInfo.indexOf(detID);
-        if (!detectorInfo.isMasked(index))
+        if (detectorInfo.isMasked(index))
+          continue;
+        if (detectorSolidAngles && !std::isnan((*detectorSolidAngles)[index]))
+          solidAngle += (*detectorSolidAngles)[index];
+        else
           solidAngle += detectorInfo.detector(index).solidAngle(samplePos);
       }
 
@@ -17,8 +17,12 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/ParallelReduce.h"
 
+#include <cmath>
 #include <functional>
+#include <list>
+#include <vector>
 
 namespace Mantid {
 namespace Algorithms {
@@ -419,81 +423,172 @@ bool useSpectrum(const SpectrumInfo &spectrumInfo, const size_t wsIndex,
   }
   return true;
 }
+
+/// The minimum number of spectra summed by one thread before the partial sums
+/// are merged.
+constexpr size_t SPECTRA_PER_CHUNK = 1000;
+
+/// Partial sums over a range of the spectra, merged by parallelReduce.
+struct PartialSum {
+  PartialSum(const size_t yLength, const bool weighted)
+      : y(yLength), e2(yLength), fraction(yLength),
+        weight(weighted ? yLength : 0), nZeros(weighted ? yLength : 0) {}
+
+  PartialSum &operator+=(const PartialSum &other) {
+    for (size_t i = 0; i < y.size(); ++i) {
+      y[i] += other.y[i];
+      e2[i] += other.e2[i];
+      fraction[i] += other.fraction[i];
+    }
+    for (size_t i = 0; i < weight.size(); ++i) {
+      weight[i] += other.weight[i];
+      nZeros[i] += other.nZeros[i];
+    }
+    numSpectra += other.numSpectra;
+    numMasked += other.numMasked;
+    return *this;
+  }
+
+  /** Adds a spectrum whose bins have the given fractional areas, which are
+   * all 1 unless the input is a RebinnedOutput workspace.
+   */
+  void add(const HistogramData::HistogramY &yValues,
+           const HistogramData::HistogramE &yErrors,
+           const std::vector<double> *fracArea) {
+    ++numSpectra;
+    const bool weighted = !weight.empty();
+    for (size_t yIndex = 0; yIndex < y.size(); ++yIndex) {
+      const double area = fracArea ? (*fracArea)[yIndex] : 1.;
+      fraction[yIndex] += area;
+      const double errsq = yErrors[yIndex] * yErrors[yIndex] * area * area;
+      if (!weighted) {
+        y[yIndex] += yValues[yIndex] * area;
+        e2[yIndex] += errsq;
+      } else if (std::isnormal(yErrors[yIndex])) {
+        // is non-zero, nan, or infinity
+        e2[yIndex] += errsq;
+        weight[yIndex] += 1. / errsq;
+        y[yIndex] += yValues[yIndex] * area / errsq;
+      } else {
+        nZeros[yIndex]++;
+      }
+    }
+  }
+
+  std::vector<Kernel::CompensatedSum> y;
+  std::vector<Kernel::CompensatedSum> e2;
+  std::vector<Kernel::CompensatedSum> fraction;
+  std::vector<Kernel::CompensatedSum> weight;
+  std::vector<size_t> nZeros;
+  size_t numSpectra{0};
+  size_t numMasked{0};
+};
+
+/// Partial event lists over a range of the spectra, merged by parallelReduce.
+struct PartialEventSum {
+  PartialEventSum &operator+=(PartialEventSum &other) {
+    events.splice(events.end(), other.events);
+    numSpectra += other.numSpectra;
+    numMasked += other.numMasked;
+    numZeros += other.numZeros;
+    return *this;
+  }
+
+  /// Events of consecutive ranges, in order. Merging splices the lists, so
+  /// the events are only copied once, into the output.
+  std::list<EventList> events;
+  size_t numSpectra{0};
+  size_t numMasked{0};
+  size_t numZeros{0};
+};
 } // anonymous namespace
 
 /**
- * This function deals with the logic necessary for summing a Workspace2D.
+ * Sums the spectra to sum in parallel. Each thread accumulates a range of
+ * spectra into its own partial sums, which are then merged.
+ * @param localworkspace the workspace with the spectra to sum
  * @param outputWorkspace the workspace to hold the summed input
  * @param progress the progress indicator
  * @param numSpectra The number of spectra contributed to the sum.
  * @param numMasked The spectra dropped from the summations because they are
  * masked.
- * @param numZeros The number of zero bins in histogram workspace or empty
- * spectra for event workspace.
+ * @param numZeros The number of zero bins in histogram workspace.
+ * @return the fractional areas of the summed bins
  */
-void SumSpectra::doSimpleSum(MatrixWorkspace_sptr outputWorkspace,
-                             Progress &progress, size_t &numSpectra,
-                             size_t &numMasked, size_t &numZeros) {
-  // Clean workspace of any NANs or Inf values
-  auto localworkspace = replaceSpecialValues();
-
-  // Get references to the output workspaces's data vectors
+std::vector<double>
+SumSpectra::parallelSum(MatrixWorkspace_const_sptr localworkspace,
+                        MatrixWorkspace_sptr outputWorkspace,
+                        Progress &progress, size_t &numSpectra,
+                        size_t &numMasked, size_t &numZeros) {
+  auto rebinnedWS =
+      boost::dynamic_pointer_cast<const RebinnedOutput>(localworkspace);
+  const auto &spectrumInfo = localworkspace->spectrumInfo();
+  const std::vector<size_t> indices(m_indices.begin(), m_indices.end());
+  // Written by one thread per element, std::vector<bool> would not allow that
+  std::vector<char> used(indices.size(), false);
+
+  const auto sum = Kernel::parallelReduce(
+      indices.size(), PartialSum(m_yLength, m_calculateWeightedSum),
+      [&](PartialSum &partial, const size_t i) {
+        const auto wsIndex = indices[i];
+        if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors,
+                         partial.numMasked))
+          return;
+        used[i] = true;
+        partial.add(localworkspace->y(wsIndex), localworkspace->e(wsIndex),
+                    rebinnedWS ? &rebinnedWS->readF(wsIndex) : nullptr);
+        progress.report();
+      },
+      [](PartialSum &partial, PartialSum &other) { partial += other; },
+      SPECTRA_PER_CHUNK, Kernel::threadSafe(*localworkspace));
+  numSpectra += sum.numSpectra;
+  numMasked += sum.numMasked;
+
+  // Map all the detectors onto the spectrum of the output
   auto &outSpec = outputWorkspace->getSpectrum(0);
+  for (size_t i = 0; i < indices.size(); ++i)
+    if (used[i])
+      outSpec.addDetectorIDs(
+          localworkspace->getSpectrum(indices[i]).getDetectorIDs());
+
   auto &YSum = outSpec.mutableY();
   auto &YErrorSum = outSpec.mutableE();
-
-  std::vector<double> Weight;
-  std::vector<size_t> nZeros;
-  if (m_calculateWeightedSum) {
-    Weight.assign(YSum.size(), 0.);
-    nZeros.assign(YSum.size(), 0);
-  }
-
-  const auto &spectrumInfo = localworkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto wsIndex : m_indices) {
-    if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
-      continue;
-    numSpectra++;
-
-    const auto &YValues = localworkspace->y(wsIndex);
-    const auto &YErrors = localworkspace->e(wsIndex);
-
-    if (m_calculateWeightedSum) {
-      // Retrieve the spectrum into a vector
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double yErrorsVal = YErrors[yIndex];
-        if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
-          const double errsq = yErrorsVal * yErrorsVal;
-          YErrorSum[yIndex] += errsq;
-          Weight[yIndex] += 1. / errsq;
-          YSum[yIndex] += YValues[yIndex] / errsq;
-        } else {
-          nZeros[yIndex]++;
-        }
-      }
-    } else {
-      YSum += YValues;
-      std::transform(YErrorSum.begin(), YErrorSum.end(), YErrors.begin(),
-                     YErrorSum.begin(),
-                     [](const double accum, const double yerrorSpec) {
-                       return accum + yerrorSpec * yerrorSpec;
-                     });
-    }
-
-    // Map all the detectors onto the spectrum of the output
-    outSpec.addDetectorIDs(
-        localworkspace->getSpectrum(wsIndex).getDetectorIDs());
-
-    progress.report();
+  std::vector<double> fraction(m_yLength);
+  for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
+    YSum[yIndex] = sum.y[yIndex].value();
+    YErrorSum[yIndex] = sum.e2[yIndex].value();
+    fraction[yIndex] = sum.fraction[yIndex].value();
   }
 
   if (m_calculateWeightedSum) {
+    std::vector<double> Weight(m_yLength);
+    for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex)
+      Weight[yIndex] = sum.weight[yIndex].value();
     numZeros =
-        applyWeight(numSpectra, YSum, Weight, nZeros, m_multiplyByNumSpec);
+        applyWeight(numSpectra, YSum, Weight, sum.nZeros, m_multiplyByNumSpec);
   } else {
     numZeros = 0;
   }
+  return fraction;
+}
+
+/**
+ * This function deals with the logic necessary for summing a Workspace2D.
+ * @param outputWorkspace the workspace to hold the summed input
+ * @param progress the progress indicator
+ * @param numSpectra The number of spectra contributed to the sum.
+ * @param numMasked The spectra dropped from the summations because they are
+ * masked.
+ * @param numZeros The number of zero bins in histogram workspace or empty
+ * spectra for event workspace.
+ */
+void SumSpectra::doSimpleSum(MatrixWorkspace_sptr outputWorkspace,
+                             Progress &progress, size_t &numSpectra,
+                             size_t &numMasked, size_t &numZeros) {
+  // Clean workspace of any NANs or Inf values
+  auto localworkspace = replaceSpecialValues();
+  parallelSum(localworkspace, outputWorkspace, progress, numSpectra, numMasked,
+              numZeros);
 }
 
 /**
@@ -514,74 +609,11 @@ void SumSpectra::doFractionalSum(MatrixWorkspace_sptr outputWorkspace,
   // workspace that will be retrieved as mutable.
   auto localworkspace = replaceSpecialValues();
 
-  // Transform to real workspace types
-  RebinnedOutput_sptr inWS =
-      boost::dynamic_pointer_cast<RebinnedOutput>(localworkspace);
   RebinnedOutput_sptr outWS =
       boost::dynamic_pointer_cast<RebinnedOutput>(outputWorkspace);
-
-  // Get references to the output workspaces's data vectors
-  auto &outSpec = outputWorkspace->getSpectrum(0);
-  auto &YSum = outSpec.mutableY();
-  auto &YErrorSum = outSpec.mutableE();
-  auto &FracSum = outWS->dataF(0);
-
-  std::vector<double> Weight;
-  std::vector<size_t> nZeros;
-  if (m_calculateWeightedSum) {
-    Weight.assign(YSum.size(), 0);
-    nZeros.assign(YSum.size(), 0);
-  }
-
-  const auto &spectrumInfo = localworkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto wsIndex : m_indices) {
-    if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
-      continue;
-    numSpectra++;
-
-    // Retrieve the spectrum into a vector
-    const auto &YValues = localworkspace->y(wsIndex);
-    const auto &YErrors = localworkspace->e(wsIndex);
-    const auto &FracArea = inWS->readF(wsIndex);
-
-    if (m_calculateWeightedSum) {
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double yErrorsVal = YErrors[yIndex];
-        if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
-          const double errsq =
-              yErrorsVal * yErrorsVal * FracArea[yIndex] * FracArea[yIndex];
-          YErrorSum[yIndex] += errsq;
-          Weight[yIndex] += 1. / errsq;
-          YSum[yIndex] += YValues[yIndex] * FracArea[yIndex] / errsq;
-        } else {
-          nZeros[yIndex]++;
-        }
-      }
-    } else {
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        YSum[yIndex] += YValues[yIndex] * FracArea[yIndex];
-        YErrorSum[yIndex] += YErrors[yIndex] * YErrors[yIndex] *
-                             FracArea[yIndex] * FracArea[yIndex];
-      }
-    }
-    // accumulation of fractional weight is the same
-    std::transform(FracSum.begin(), FracSum.end(), FracArea.begin(),
-                   FracSum.begin(), std::plus<double>());
-
-    // Map all the detectors onto the spectrum of the output
-    outSpec.addDetectorIDs(
-        localworkspace->getSpectrum(wsIndex).getDetectorIDs());
-
-    progress.report();
-  }
-
-  if (m_calculateWeightedSum) {
-    numZeros =
-        applyWeight(numSpectra, YSum, Weight, nZeros, m_multiplyByNumSpec);
-  } else {
-    numZeros = 0;
-  }
+  // accumulation of fractional weight is the same
+  outWS->dataF(0) = parallelSum(localworkspace, outputWorkspace, progress,
+                                numSpectra, numMasked, numZeros);
 
   // Create the correct representation
   outWS->finalize();
@@ -611,29 +643,36 @@ void SumSpectra::execEvent(MatrixWorkspace_sptr outputWorkspace,
   outputEL.clearDetectorIDs();
 
   const auto &spectrumInfo = inputWorkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto i : m_indices) {
-    if (spectrumInfo.hasDetectors(i)) {
-      // Skip monitors, if the property is set to do so
-      if (!m_keepMonitors && spectrumInfo.isMonitor(i))
-        continue;
-      // Skip masked detectors
-      if (spectrumInfo.isMasked(i)) {
-        numMasked++;
-        continue;
-      }
-    }
-    numSpectra++;
-
-    // Add the event lists with the operator
-    const EventList &inputEL = inputWorkspace->getSpectrum(i);
-    if (inputEL.empty()) {
-      ++numZeros;
-    }
-    outputEL += inputEL;
-
-    progress.report();
-  }
+  const std::vector<size_t> indices(m_indices.begin(), m_indices.end());
+  auto sum = Kernel::parallelReduce(
+      indices.size(), PartialEventSum(),
+      [&](PartialEventSum &partial, const size_t i) {
+        const auto wsIndex = indices[i];
+        if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors,
+                         partial.numMasked))
+          return;
+        partial.numSpectra++;
+
+        // Add the event lists with the operator
+        const EventList &inputEL = inputWorkspace->getSpectrum(wsIndex);
+        if (inputEL.empty()) {
+          ++partial.numZeros;
+        }
+        if (partial.events.empty())
+          partial.events.emplace_back();
+        partial.events.back() += inputEL;
+
+        progress.report();
+      },
+      [](PartialEventSum &partial, PartialEventSum &other) {
+        partial += other;
+      },
+      SPECTRA_PER_CHUNK, Kernel::threadSafe(*inputWorkspace));
+  numSpectra += sum.numSpectra;
+  numMasked += sum.numMasked;
+  numZeros += sum.numZeros;
+  for (auto &events : sum.events)
+    outputEL += std::move(events);
 }
 
 } // namespace Algorithms
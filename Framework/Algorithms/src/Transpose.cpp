@@ -13,6 +13,8 @@
 #include "MantidAPI/NumericAxis.h"
 #include "MantidDataObjects/RebinnedOutput.h"
 
+#include <algorithm>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -56,36 +58,53 @@ void Transpose::exec() {
   auto newXVector =
       Kernel::make_cow<HistogramData::HistogramX>(std::move(newXValues));
 
-  Progress progress(this, 0.0, 1.0, newNhist * newYsize);
+  // The output spectra are processed in blocks. Each input spectrum is read
+  // once per block, such that both the reads and the writes go to a small
+  // number of cache lines, instead of reading each input spectrum once for
+  // every output spectrum.
+  const size_t blockSize = 64;
+  const int64_t numBlocks =
+      static_cast<int64_t>((newNhist + blockSize - 1) / blockSize);
+  Progress progress(this, 0.0, 1.0, numBlocks);
   progress.report("Swapping data values");
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWorkspace, *outputWorkspace))
-  for (int64_t i = 0; i < static_cast<int64_t>(newNhist); ++i) {
+  for (int64_t block = 0; block < numBlocks; ++block) {
     PARALLEL_START_INTERUPT_REGION
 
-    outputWorkspace->setSharedX(i, newXVector);
-
-    auto &outY = outputWorkspace->mutableY(i);
-    auto &outE = outputWorkspace->mutableE(i);
-
-    // because setF wants a COW pointer
-    Kernel::cow_ptr<std::vector<double>> F;
-    std::vector<double> &outF = F.access();
-
-    if (outRebinWorkspace) {
-      outF.resize(newYsize);
+    const size_t begin = static_cast<size_t>(block) * blockSize;
+    const size_t end = std::min(begin + blockSize, newNhist);
+    std::vector<HistogramData::HistogramY *> outY;
+    std::vector<HistogramData::HistogramE *> outE;
+    std::vector<std::vector<double>> outF;
+    for (size_t i = begin; i < end; ++i) {
+      outputWorkspace->setSharedX(i, newXVector);
+      outY.push_back(&outputWorkspace->mutableY(i));
+      outE.push_back(&outputWorkspace->mutableE(i));
+      if (outRebinWorkspace)
+        outF.emplace_back(newYsize);
     }
 
-    for (int64_t j = 0; j < int64_t(newYsize); ++j) {
-      progress.report();
-      outY[j] = inputWorkspace->y(j)[i];
-      outE[j] = inputWorkspace->e(j)[i];
+    for (size_t j = 0; j < newYsize; ++j) {
+      const auto &inY = inputWorkspace->y(j);
+      const auto &inE = inputWorkspace->e(j);
+      for (size_t i = begin; i < end; ++i) {
+        (*outY[i - begin])[j] = inY[i];
+        (*outE[i - begin])[j] = inE[i];
+      }
       if (outRebinWorkspace) {
-        outF[j] = inRebinWorkspace->dataF(j)[i];
+        const auto &inF = inRebinWorkspace->readF(j);
+        for (size_t i = begin; i < end; ++i)
+          outF[i - begin][j] = inF[i];
       }
     }
     if (outRebinWorkspace) {
-      outRebinWorkspace->setF(i, F);
+      for (size_t i = begin; i < end; ++i) {
+        auto &values = outF[i - begin];
+        outRebinWorkspace->setF(
+            i, Kernel::make_cow<std::vector<double>>(std::move(values)));
+      }
     }
+    progress.report();
 
     PARALLEL_END_INTERUPT_REGION
   }
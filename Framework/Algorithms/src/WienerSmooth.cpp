@@ -237,7 +237,7 @@ WienerSmooth::smoothSingleSpectrum(API::MatrixWorkspace_sptr inputWS,
   API::MatrixWorkspace_sptr fitOut = fit->getProperty("OutputWorkspace");
 
   // Fourier transform the difference spectrum
-  auto fourier = createChildAlgorithm("RealFFT");
+  auto fourier = createLightweightChildAlgorithm("RealFFT");
   fourier->initialize();
   fourier->setProperty("InputWorkspace", fitOut);
   fourier->setProperty("WorkspaceIndex", 2);
@@ -351,7 +351,7 @@ WienerSmooth::smoothSingleSpectrum(API::MatrixWorkspace_sptr inputWS,
                  std::multiplies<double>());
 
   // inverse fourier transform
-  fourier = createChildAlgorithm("RealFFT");
+  fourier = createLightweightChildAlgorithm("RealFFT");
   fourier->initialize();
   fourier->setProperty("InputWorkspace", fourierOut);
   fourier->setProperty("IgnoreXBins", true);
@@ -421,7 +421,7 @@ WienerSmooth::getStartEnd(const Mantid::HistogramData::HistogramX &X,
  */
 API::MatrixWorkspace_sptr
 WienerSmooth::copyInput(API::MatrixWorkspace_sptr inputWS, size_t wsIndex) {
-  auto alg = createChildAlgorithm("ExtractSingleSpectrum");
+  auto alg = createLightweightChildAlgorithm("ExtractSingleSpectrum");
   alg->initialize();
   alg->setProperty("InputWorkspace", inputWS);
   alg->setProperty("WorkspaceIndex", static_cast<int>(wsIndex));
@@ -6,10 +6,13 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/WorkflowAlgorithmRunner.h"
 
+#include "MantidAPI/AlgorithmGraph.h"
 #include "MantidAPI/ITableWorkspace.h"
+#include "MantidAPI/IWorkspaceProperty.h"
 #include "MantidKernel/MandatoryValidator.h"
 
 #include <deque>
+#include <set>
 #include <unordered_map>
 
 using namespace Mantid::API;
@@ -87,6 +90,80 @@ void cleanPropertyTable(ITableWorkspace_sptr table, const MAP &ioMapping) {
   }
 }
 
+/** Sets the properties of an algorithm from a row of a property table.
+ * The first column of the table is the row id and is skipped.
+ * @param algorithm the algorithm to configure
+ * @param propertyTable a table containing the final property values
+ * @param row the row of `propertyTable` to use
+ * @param algorithmName the name of the algorithm, for error messages
+ * @throw std::runtime_error if a value cannot be set
+ */
+void setRowProperties(IAlgorithm &algorithm,
+                      const ITableWorkspace &propertyTable, const size_t row,
+                      const std::string &algorithmName) {
+  for (size_t col = 1; col < propertyTable.columnCount(); ++col) {
+    const auto column = propertyTable.getColumn(col);
+    const auto &propertyName = column->name();
+    const auto &valueType = column->get_type_info();
+    try {
+      if (valueType == typeid(std::string)) {
+        const auto &value = column->cell<std::string>(row);
+        algorithm.setProperty(propertyName, value);
+      } else if (valueType == typeid(int)) {
+        const auto &value = column->cell<int>(row);
+        algorithm.setProperty(propertyName, static_cast<long>(value));
+      } else if (valueType == typeid(size_t)) {
+        const auto &value = column->cell<size_t>(row);
+        algorithm.setProperty(propertyName, value);
+      } else if (valueType == typeid(float) || valueType == typeid(double)) {
+        const auto &value = column->cell<double>(row);
+        algorithm.setProperty(propertyName, value);
+      } else if (valueType == typeid(bool)) {
+        const auto &value = column->cell<bool>(row);
+        algorithm.setProperty(propertyName, value);
+      } else if (valueType == typeid(Kernel::V3D)) {
+        const auto &value = column->cell<V3D>(row);
+        algorithm.setProperty(propertyName, value);
+      } else {
+        throw std::runtime_error("Unimplemented column type in " +
+                                 PropertyNames::SETUP_TABLE + ": " +
+                                 valueType.name() + '.');
+      }
+    } catch (std::invalid_argument &e) {
+      throw std::runtime_error("While setting properties for algorithm " +
+                               algorithmName + ": " + e.what());
+    }
+  }
+}
+
+/** Collects the workspace names a row reads and writes.
+ * @param algorithm an initialized instance of the algorithm of the row
+ * @param propertyTable a table containing the final property values
+ * @param row the row of `propertyTable`
+ * @param[out] reads names of the input workspaces of the row
+ * @param[out] writes names of the output workspaces of the row
+ */
+void workspaceNames(const IAlgorithm &algorithm,
+                    const ITableWorkspace &propertyTable, const size_t row,
+                    std::vector<std::string> &reads,
+                    std::vector<std::string> &writes) {
+  for (size_t col = 1; col < propertyTable.columnCount(); ++col) {
+    const auto column = propertyTable.getColumn(col);
+    if (column->get_type_info() != typeid(std::string) ||
+        !algorithm.existsProperty(column->name())) {
+      continue;
+    }
+    const auto property = algorithm.getPointerToProperty(column->name());
+    const auto &name = column->cell<std::string>(row);
+    if (name.empty() || !dynamic_cast<const IWorkspaceProperty *>(property))
+      continue;
+    if (property->direction() != Direction::Output)
+      reads.emplace_back(name);
+    if (property->direction() != Direction::Input)
+      writes.emplace_back(name);
+  }
+}
+
 // Register the algorithm into the algorithm factory.
 DECLARE_ALGORITHM(WorkflowAlgorithmRunner)
 
@@ -140,57 +217,56 @@ void WorkflowAlgorithmRunner::exec() {
     configureRow(setupTable, propertyTable, i, queue, ioMap);
   }
 
-  // Execute the algorithm in the order specified by queue.
+  // Run the rows as an AlgorithmGraph so that independent rows run
+  // concurrently. Inputs are passed by name through the ADS, so the
+  // properties of a row are set just before it runs.
   const std::string algorithmName = getProperty(PropertyNames::ALGORITHM);
   auto &algorithmFactory = AlgorithmFactory::Instance();
-  while (!queue.empty()) {
-    const auto row = queue.front();
+  AlgorithmGraph graph;
+  // The last step writing each workspace name, and the steps reading it since
+  std::unordered_map<std::string, size_t> lastWriter;
+  std::unordered_map<std::string, std::vector<size_t>> readers;
+  for (const auto row : queue) {
     auto algorithm = algorithmFactory.create(
         algorithmName, algorithmFactory.highestVersion(algorithmName));
     algorithm->initialize();
     if (!algorithm->isInitialized()) {
       throw std::runtime_error("Workflow algorithm failed to initialise.");
     }
-    // First column in taskTable is for id.
-    for (size_t col = 1; col < propertyTable->columnCount(); ++col) {
-      const auto column = propertyTable->getColumn(col);
-      const auto &propertyName = column->name();
-      const auto &valueType = column->get_type_info();
-      try {
-        if (valueType == typeid(std::string)) {
-          const auto &value = propertyTable->cell<std::string>(row, col);
-          algorithm->setProperty(propertyName, value);
-        } else if (valueType == typeid(int)) {
-          const auto &value = propertyTable->cell<int>(row, col);
-          algorithm->setProperty(propertyName, static_cast<long>(value));
-        } else if (valueType == typeid(size_t)) {
-          const auto &value = propertyTable->cell<size_t>(row, col);
-          algorithm->setProperty(propertyName, value);
-        } else if (valueType == typeid(float) || valueType == typeid(double)) {
-          const auto &value = propertyTable->cell<double>(row, col);
-          algorithm->setProperty(propertyName, value);
-        } else if (valueType == typeid(bool)) {
-          const auto &value = propertyTable->cell<bool>(row, col);
-          algorithm->setProperty(propertyName, value);
-        } else if (valueType == typeid(Kernel::V3D)) {
-          const auto &value = propertyTable->cell<V3D>(row, col);
-          algorithm->setProperty(propertyName, value);
-        } else {
-          throw std::runtime_error("Unimplemented column type in " +
-                                   PropertyNames::SETUP_TABLE + ": " +
-                                   valueType.name() + '.');
-        }
-      } catch (std::invalid_argument &e) {
-        throw std::runtime_error("While setting properties for algorithm " +
-                                 algorithmName + ": " + e.what());
-      }
+    const auto step = graph.addStep(
+        algorithm, [propertyTable, row, &algorithmName](IAlgorithm &alg) {
+          setRowProperties(alg, *propertyTable, row, algorithmName);
+        });
+    // A row waits for the earlier rows in the queue that write a workspace
+    // it reads or writes, or that read one it writes. This covers names from
+    // the InputOutputMap as well as hard-coded ones, so the result is the
+    // same as running the rows in queue order.
+    std::vector<std::string> reads, writes;
+    workspaceNames(*algorithm, *propertyTable, row, reads, writes);
+    std::set<size_t> before;
+    for (const auto &name : reads) {
+      const auto writer = lastWriter.find(name);
+      if (writer != lastWriter.end())
+        before.insert(writer->second);
+    }
+    for (const auto &name : writes) {
+      const auto writer = lastWriter.find(name);
+      if (writer != lastWriter.end())
+        before.insert(writer->second);
+      const auto &nameReaders = readers[name];
+      before.insert(nameReaders.cbegin(), nameReaders.cend());
     }
-    algorithm->execute();
-    if (!algorithm->isExecuted()) {
-      throw std::runtime_error("Workflow algorithm failed to execute.");
+    before.erase(step);
+    for (const auto earlier : before)
+      graph.addDependency(earlier, step);
+    for (const auto &name : writes) {
+      lastWriter[name] = step;
+      readers[name].clear();
     }
-    queue.pop_front();
+    for (const auto &name : reads)
+      readers[name].push_back(step);
   }
+  graph.execute();
 }
 
 /**
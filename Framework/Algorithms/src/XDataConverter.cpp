@@ -28,7 +28,7 @@ using Mantid::MantidVecPtr;
 /**
  * Default constructor
  */
-XDataConverter::XDataConverter() : m_sharedX(false) {}
+XDataConverter::XDataConverter() {}
 
 //------------------------------------------------------------------------------
 // Private member functions
@@ -57,7 +57,11 @@ void XDataConverter::exec() {
   const int numSpectra = static_cast<int>(inputWS->getNumberHistograms());
   const size_t numYValues = getNewYSize(inputWS);
   const size_t numXValues = getNewXSize(numYValues);
-  m_sharedX = API::WorkspaceHelpers::sharedXData(*inputWS);
+  // With identical X data in all spectra the new X is computed only once and
+  // shared by all output spectra
+  const auto commonX = inputWS->commonX();
+  m_cachedX = commonX ? calculateXPoints(commonX)
+                      : Kernel::cow_ptr<HistogramData::HistogramX>(nullptr);
   // Create the new workspace
   MatrixWorkspace_sptr outputWS = WorkspaceFactory::Instance().create(
       inputWS, numSpectra, numXValues, numYValues);
@@ -103,14 +107,7 @@ XDataConverter::getNewYSize(const API::MatrixWorkspace_sptr inputWS) {
 void XDataConverter::setXData(API::MatrixWorkspace_sptr outputWS,
                               const API::MatrixWorkspace_sptr inputWS,
                               const int index) {
-  if (m_sharedX) {
-    PARALLEL_CRITICAL(XDataConverter_para) {
-      if (!m_cachedX) {
-        PARALLEL_CRITICAL(XDataConverter_parb) {
-          m_cachedX = calculateXPoints(inputWS->sharedX(index));
-        }
-      }
-    }
+  if (m_cachedX) {
     outputWS->setSharedX(index, m_cachedX);
   } else {
     outputWS->setSharedX(index, calculateXPoints(inputWS->sharedX(index)));
@@ -105,6 +105,23 @@ public:
     TS_ASSERT_EQUALS((*(outputWS->getAxis(1)))(2), 4);
   }
 
+  void test_Output_X_Is_Shared_If_Input_Bins_Are_Equal() {
+    Workspace2D_sptr testWS =
+        WorkspaceCreationHelper::create2DWorkspaceBinned(3, 10);
+    // Unshare the X data, keeping the values
+    testWS->mutableX(1);
+    TS_ASSERT_DIFFERS(&testWS->x(0), &testWS->x(1));
+
+    MatrixWorkspace_sptr outputWS = runAlgorithm(testWS);
+
+    TS_ASSERT(outputWS);
+    if (!outputWS)
+      return;
+    TS_ASSERT_EQUALS(&outputWS->x(0), &outputWS->x(1));
+    TS_ASSERT_EQUALS(&outputWS->x(0), &outputWS->x(2));
+    TS_ASSERT_EQUALS(outputWS->x(1)[0], 0.5);
+  }
+
   void test_A_Non_Uniformly_Binned_Histogram_Is_Transformed_Correctly() {
     // Creates a workspace with 2 spectra, and the given bin structure
     double xBoundaries[11] = {0.0,  1.0,  3.0,  5.0,  6.0, 7.0,
@@ -102,6 +102,60 @@ public:
     dotestEventWorkspace(false, 1, false);
   }
 
+  void test_EventWorkspace_uneven_groups_and_mixed_event_types() {
+    const std::string wsName("DiffractionFocussing2Test_mixed");
+    const int bankWidthInPixels = 4;
+    auto inputW =
+        WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(
+            3, bankWidthInPixels);
+    inputW->getAxis(0)->unit() = UnitFactory::Instance().create("dSpacing");
+    // Spectrum i gets i + 1 events, the first one is weighted
+    double expectedTotal = 0.;
+    for (size_t pix = 0; pix < inputW->getNumberHistograms(); pix++) {
+      inputW->setHistogram(pix, BinEdges{0., 1e6});
+      auto &events = inputW->getSpectrum(pix);
+      for (size_t i = 0; i <= pix; ++i)
+        events.addEventQuickly(TofEvent(1000.0 + static_cast<double>(i)));
+      expectedTotal += static_cast<double>(pix + 1);
+    }
+    inputW->getSpectrum(0).multiply(2.0, 0.0);
+    expectedTotal += 1.;
+    AnalysisDataService::Instance().addOrReplace(wsName, inputW);
+    const std::string groupWSName("DiffractionFocussing2Test_mixed_group");
+    FrameworkManager::Instance().exec(
+        "CreateGroupingWorkspace", 6, "InputWorkspace", wsName.c_str(),
+        "GroupNames", "bank1,bank2,bank3", "OutputWorkspace",
+        groupWSName.c_str());
+
+    DiffractionFocussing2 alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace", wsName);
+    alg.setPropertyValue("OutputWorkspace", wsName);
+    alg.setPropertyValue("GroupingWorkspace", groupWSName);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    auto output =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>(wsName);
+    TS_ASSERT(output);
+    if (!output)
+      return;
+    const size_t numPixels = bankWidthInPixels * bankWidthInPixels;
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 3);
+    TS_ASSERT_EQUALS(output->getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(output->getNumberEvents(),
+                     3 * numPixels * (3 * numPixels + 1) / 2);
+    double total = 0.;
+    for (size_t wi = 0; wi < output->getNumberHistograms(); wi++) {
+      const auto &events = output->getSpectrum(wi);
+      TS_ASSERT_EQUALS(events.getDetectorIDs().size(), numPixels);
+      total += events.integrate(0., 1e6, true);
+    }
+    TS_ASSERT_DELTA(total, expectedTotal, 1e-10);
+    AnalysisDataService::Instance().remove(wsName);
+    AnalysisDataService::Instance().remove(groupWSName);
+  }
+
   void dotestEventWorkspace(bool inplace, size_t numgroups,
                             bool preserveEvents = true,
                             int bankWidthInPixels = 16) {
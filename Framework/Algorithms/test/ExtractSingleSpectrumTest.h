@@ -92,6 +92,29 @@ public:
     TS_ASSERT_DELTA(outputWS->getSpectrum(0).getTofMax(), 28.5, 1e-08);
   }
 
+  void test_exec_when_initialized_from_prototype() {
+    ExtractSingleSpectrum prototype;
+    prototype.initialize();
+    ExtractSingleSpectrum extractor;
+    TS_ASSERT(extractor.supportsInitializationFromPrototype());
+    TS_ASSERT_THROWS_NOTHING(extractor.initializeFromPrototype(prototype));
+    TS_ASSERT(extractor.isInitialized());
+    TS_ASSERT_EQUALS(extractor.getProperties().size(), 3);
+    // The validators are copied too
+    TS_ASSERT_THROWS(extractor.setProperty("WorkspaceIndex", -2),
+                     std::invalid_argument);
+
+    extractor.setChild(true);
+    extractor.setProperty<MatrixWorkspace_sptr>(
+        "InputWorkspace",
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(5, 5));
+    extractor.setPropertyValue("OutputWorkspace", "child_algorithm");
+    extractor.setProperty("WorkspaceIndex", 3);
+    TS_ASSERT_THROWS_NOTHING(extractor.execute());
+    MatrixWorkspace_sptr outputWS = extractor.getProperty("OutputWorkspace");
+    do_Spectrum_Tests(outputWS, 4, 4);
+  }
+
 private:
   ExtractSingleSpectrum *createExtractSingleSpectrum() {
     return new ExtractSingleSpectrum();
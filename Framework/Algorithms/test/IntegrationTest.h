@@ -118,6 +118,25 @@ public:
     }
   }
 
+  void testOutputXIsSharedForCommonBins() {
+    Integration alg;
+    alg.setRethrows(true);
+    TS_ASSERT_THROWS_NOTHING(alg.initialize());
+    alg.setPropertyValue("InputWorkspace", "testSpace");
+    alg.setPropertyValue("OutputWorkspace", "outShared");
+    alg.setPropertyValue("RangeLower", "0.1");
+    alg.setPropertyValue("RangeUpper", "4.0");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+
+    const auto output =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+            "outShared");
+    TS_ASSERT_EQUALS(&output->x(0), &output->x(4));
+    TS_ASSERT_EQUALS(output->x(4)[0], 1.0);
+    TS_ASSERT_EQUALS(output->x(4)[1], 4.0);
+    TS_ASSERT_EQUALS(output->y(4)[0], 66.0);
+  }
+
   void testNoRangeNoPartialBins() {
     Integration alg;
     alg.setRethrows(true);
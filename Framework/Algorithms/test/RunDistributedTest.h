@@ -0,0 +1,131 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_ALGORITHMS_RUNDISTRIBUTEDTEST_H_
+#define MANTID_ALGORITHMS_RUNDISTRIBUTEDTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidAlgorithms/RunDistributed.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+using Mantid::Algorithms::RunDistributed;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+
+namespace {
+MatrixWorkspace_sptr runDistributed(const MatrixWorkspace_sptr &input,
+                                    const std::string &algorithm,
+                                    const std::string &properties,
+                                    const int numRanks) {
+  RunDistributed alg;
+  alg.setChild(true);
+  alg.setRethrows(true);
+  alg.initialize();
+  alg.setProperty("InputWorkspace", input);
+  alg.setProperty("OutputWorkspace", "unused");
+  alg.setProperty("Algorithm", algorithm);
+  alg.setProperty("AlgorithmProperties", properties);
+  alg.setProperty("NumberOfRanks", numRanks);
+  alg.execute();
+  TS_ASSERT(alg.isExecuted());
+  return alg.getProperty("OutputWorkspace");
+}
+
+MatrixWorkspace_sptr makeWorkspace(const int numSpectra) {
+  MatrixWorkspace_sptr ws =
+      WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(numSpectra,
+                                                                   3);
+  for (size_t i = 0; i < ws->getNumberHistograms(); ++i)
+    ws->mutableY(i) = static_cast<double>(i + 1);
+  return ws;
+}
+} // namespace
+
+class RunDistributedTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static RunDistributedTest *createSuite() { return new RunDistributedTest(); }
+  static void destroySuite(RunDistributedTest *suite) { delete suite; }
+
+  RunDistributedTest() { FrameworkManager::Instance(); }
+
+  void test_init() {
+    RunDistributed alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_output_is_gathered_in_input_order() {
+    const auto input = makeWorkspace(7);
+    const auto output = runDistributed(input, "Scale", "Factor=2", 3);
+    TS_ASSERT_EQUALS(output->storageMode(),
+                     Mantid::Parallel::StorageMode::Cloned);
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 7);
+    const auto &spectrumInfo = output->spectrumInfo();
+    for (size_t i = 0; i < output->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(output->y(i)[0], 2. * static_cast<double>(i + 1));
+      TS_ASSERT_EQUALS(output->x(i).rawData(), input->x(i).rawData());
+      TS_ASSERT_EQUALS(output->getSpectrum(i).getSpectrumNo(),
+                       input->getSpectrum(i).getSpectrumNo());
+      TS_ASSERT_EQUALS(spectrumInfo.detector(i).getID(),
+                       input->spectrumInfo().detector(i).getID());
+    }
+    // The input is not changed
+    TS_ASSERT_EQUALS(input->y(6)[0], 7.);
+  }
+
+  void test_more_ranks_than_spectra() {
+    const auto input = makeWorkspace(2);
+    const auto output = runDistributed(input, "Scale", "Factor=3", 5);
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 2);
+    TS_ASSERT_EQUALS(output->y(0)[0], 3.);
+    TS_ASSERT_EQUALS(output->y(1)[0], 6.);
+  }
+
+  void test_single_rank() {
+    const auto input = makeWorkspace(3);
+    const auto output = runDistributed(input, "Scale", "Factor=3", 1);
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 3);
+    TS_ASSERT_EQUALS(output->y(2)[0], 9.);
+  }
+
+  void test_events_are_kept() {
+    MatrixWorkspace_sptr input =
+        WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(1, 3,
+                                                                        false);
+    const auto output = runDistributed(
+        input, "Rebin", "Params=0,1,10;PreserveEvents=1", 4);
+    const auto events = boost::dynamic_pointer_cast<EventWorkspace>(output);
+    TS_ASSERT(events);
+    const auto inputEvents = boost::dynamic_pointer_cast<EventWorkspace>(input);
+    TS_ASSERT_EQUALS(events->getNumberHistograms(),
+                     input->getNumberHistograms());
+    TS_ASSERT_EQUALS(events->getNumberEvents(), inputEvents->getNumberEvents());
+    for (size_t i = 0; i < events->getNumberHistograms(); ++i)
+      TS_ASSERT_EQUALS(events->getSpectrum(i).getNumberEvents(),
+                       inputEvents->getSpectrum(i).getNumberEvents());
+    TS_ASSERT_EQUALS(output->x(0).size(), 11);
+  }
+
+  void test_errors_on_ranks_are_rethrown() {
+    const auto input = makeWorkspace(4);
+    TS_ASSERT_THROWS_ANYTHING(
+        runDistributed(input, "Scale", "Operation=NoSuchOperation", 2));
+  }
+
+  void test_algorithm_without_input_workspace_is_rejected() {
+    const auto input = makeWorkspace(2);
+    TS_ASSERT_THROWS(runDistributed(input, "CreateWorkspace", "", 2),
+                     std::runtime_error);
+  }
+};
+
+#endif /* MANTID_ALGORITHMS_RUNDISTRIBUTEDTEST_H_ */
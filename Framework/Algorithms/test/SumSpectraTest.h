@@ -595,6 +595,47 @@ public:
     AnalysisDataService::Instance().remove(outName);
   }
 
+  void testExecManySpectraWithMasking() {
+    // More spectra than are summed by a single thread
+    constexpr int numHist = 4500;
+    auto inWs = WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(
+        numHist, 2);
+    auto &spectrumInfo = inWs->mutableSpectrumInfo();
+    double expectedY = 0.;
+    size_t numUnmasked = 0;
+    for (size_t i = 0; i < numHist; ++i) {
+      inWs->mutableY(i) = 0.1 * static_cast<double>(i % 7);
+      inWs->mutableE(i) = 1.;
+      if (i % 10 == 0) {
+        spectrumInfo.setMasked(i, true);
+      } else {
+        expectedY += 0.1 * static_cast<double>(i % 7);
+        ++numUnmasked;
+      }
+    }
+
+    Mantid::Algorithms::SumSpectra alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setRethrows(true);
+    alg.setProperty("InputWorkspace", inWs);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr output = alg.getProperty("OutputWorkspace");
+
+    TS_ASSERT_EQUALS(output->getNumberHistograms(), 1);
+    TS_ASSERT_DELTA(output->y(0)[1], expectedY, 1e-12 * expectedY);
+    TS_ASSERT_DELTA(output->e(0)[1],
+                    std::sqrt(static_cast<double>(numUnmasked)), 1e-12);
+    TS_ASSERT_EQUALS(output->getSpectrum(0).getDetectorIDs().size(),
+                     numUnmasked);
+    TS_ASSERT_EQUALS(output->run().getPropertyValueAsType<int>("NumAllSpectra"),
+                     static_cast<int>(numUnmasked));
+    TS_ASSERT_EQUALS(
+        output->run().getPropertyValueAsType<int>("NumMaskSpectra"),
+        numHist / 10);
+  }
+
   void testRemoveSpecialValuesOn() {
     constexpr size_t numOfHistos = 2;
     auto inWs =
@@ -149,6 +149,35 @@ public:
     deleteWorkspace(inputWs);
   }
 
+  void test_HardCodedInputWaitsForTheRowWritingIt() {
+    // Data flow: input->first->"shared"->second->output, linked by name only
+    auto setupTable = createSetupTableForScale();
+    setupTable->setRowCount(2);
+    setupTable->getRef<std::string>("Id", 0) = "first";
+    setupTable->getRef<std::string>("InputWorkspace", 0) = "\"input\"";
+    setupTable->getRef<std::string>("OutputWorkspace", 0) = "\"shared\"";
+    const double scaling1 = 3;
+    setupTable->getRef<double>("Factor", 0) = scaling1;
+    setupTable->getRef<std::string>("Id", 1) = "second";
+    setupTable->getRef<std::string>("InputWorkspace", 1) = "\"shared\"";
+    setupTable->getRef<std::string>("OutputWorkspace", 1) = "\"output\"";
+    const double scaling2 = 5;
+    setupTable->getRef<double>("Factor", 1) = scaling2;
+    auto inputWs = createTestWorkspace("input");
+    WorkflowAlgorithmRunner algorithm;
+    algorithm.setRethrows(true);
+    TS_ASSERT_THROWS_NOTHING(algorithm.initialize())
+    TS_ASSERT_THROWS_NOTHING(algorithm.setProperty("Algorithm", "Scale"))
+    TS_ASSERT_THROWS_NOTHING(algorithm.setProperty("SetupTable", setupTable))
+    TS_ASSERT_THROWS_NOTHING(
+        algorithm.setProperty("InputOutputMap", m_ioMapForScale))
+    TS_ASSERT_THROWS_NOTHING(algorithm.execute())
+    TS_ASSERT(algorithm.isExecuted())
+    assertOutputWorkspace("shared", scaling1);
+    assertOutputWorkspace("output", scaling1 * scaling2);
+    deleteWorkspace(inputWs);
+  }
+
   void test_Init() {
     WorkflowAlgorithmRunner algorithm;
     algorithm.setRethrows(true);
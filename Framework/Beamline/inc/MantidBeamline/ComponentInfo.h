@@ -128,6 +128,8 @@ public:
   bool hasParent(const size_t componentIndex) const;
   bool hasDetectorInfo() const;
   void setDetectorInfo(DetectorInfo *detectorInfo);
+  size_t detectorPositionRevision() const;
+  size_t detectorRotationRevision() const;
   bool hasSource() const;
   bool hasSample() const;
   Eigen::Vector3d sourcePosition() const;
@@ -79,6 +79,8 @@ public:
   void setRotation(const size_t index, const Eigen::Quaterniond &rotation);
   void setRotation(const std::pair<size_t, size_t> &index,
                    const Eigen::Quaterniond &rotation);
+  size_t positionRevision() const;
+  size_t rotationRevision() const;
 
   size_t scanCount(const size_t index) const;
   std::pair<int64_t, int64_t>
@@ -86,6 +88,13 @@ public:
   void setScanInterval(const size_t index,
                        const std::pair<int64_t, int64_t> &interval);
   void setScanInterval(const std::pair<int64_t, int64_t> &interval);
+  void setScanTransforms(
+      const std::vector<std::pair<int64_t, int64_t>> &intervals,
+      const std::vector<std::vector<size_t>> &banks,
+      std::vector<Eigen::Quaterniond,
+                  Eigen::aligned_allocator<Eigen::Quaterniond>>
+          rotations,
+      std::vector<Eigen::Vector3d> translations);
 
   void merge(const DetectorInfo &other);
   void setComponentInfo(ComponentInfo *componentInfo);
@@ -95,6 +104,13 @@ public:
   Eigen::Vector3d samplePosition() const;
 
 private:
+  struct ScanTransforms;
+  static size_t newPositionRevision();
+  Eigen::Vector3d
+  transformedPosition(const std::pair<size_t, size_t> &index) const;
+  Eigen::Quaterniond
+  transformedRotation(const std::pair<size_t, size_t> &index) const;
+  void applyScanTransforms();
   size_t linearIndex(const std::pair<size_t, size_t> &index) const;
   void checkNoTimeDependence() const;
   void initScanCounts();
@@ -106,6 +122,10 @@ private:
   void checkIdenticalIntervals(const DetectorInfo &other, const size_t index1,
                                const size_t index2) const;
   bool m_isSyncScan{true};
+  /// Changes whenever a detector position changes, see positionRevision().
+  size_t m_positionRevision{0};
+  /// Changes whenever a detector rotation changes, see rotationRevision().
+  size_t m_rotationRevision{0};
 
   Kernel::cow_ptr<std::vector<bool>> m_isMonitor{nullptr};
   Kernel::cow_ptr<std::vector<bool>> m_isMasked{nullptr};
@@ -121,6 +141,10 @@ private:
   Kernel::cow_ptr<std::vector<std::vector<size_t>>> m_indexMap{nullptr};
   /// For linear index -> (detector index, time index) conversions
   Kernel::cow_ptr<std::vector<std::pair<size_t, size_t>>> m_indices{nullptr};
+  /// Rigid transforms per bank and time index for compact synchronous scans,
+  /// see setScanTransforms(). If set, m_positions and m_rotations only hold
+  /// the untransformed values with one entry per detector.
+  Kernel::cow_ptr<ScanTransforms> m_scanTransforms{nullptr};
   ComponentInfo *m_componentInfo = nullptr; // Geometry::ComponentInfo owner
 };
 
@@ -136,9 +160,9 @@ inline size_t DetectorInfo::size() const {
 
 /// Returns true if the beamline has scanning detectors.
 inline bool DetectorInfo::isScanning() const {
-  if (!m_positions)
+  if (!m_isMasked)
     return false;
-  return size() != m_positions->size();
+  return size() != m_isMasked->size();
 }
 
 /** Returns the position of the detector with given detector index.
@@ -153,6 +177,8 @@ inline Eigen::Vector3d DetectorInfo::position(const size_t index) const {
 /// Returns the position of the detector with given index.
 inline Eigen::Vector3d
 DetectorInfo::position(const std::pair<size_t, size_t> &index) const {
+  if (m_scanTransforms)
+    return transformedPosition(index);
   return (*m_positions)[linearIndex(index)];
 }
 
@@ -168,6 +194,8 @@ inline Eigen::Quaterniond DetectorInfo::rotation(const size_t index) const {
 /// Returns the rotation of the detector with given index.
 inline Eigen::Quaterniond
 DetectorInfo::rotation(const std::pair<size_t, size_t> &index) const {
+  if (m_scanTransforms)
+    return transformedRotation(index);
   return (*m_rotations)[linearIndex(index)];
 }
 
@@ -179,12 +207,16 @@ inline void DetectorInfo::setPosition(const size_t index,
                                       const Eigen::Vector3d &position) {
   checkNoTimeDependence();
   m_positions.access()[index] = position;
+  m_positionRevision = newPositionRevision();
 }
 
 /// Set the position of the detector with given index.
 inline void DetectorInfo::setPosition(const std::pair<size_t, size_t> &index,
                                       const Eigen::Vector3d &position) {
+  if (m_scanTransforms)
+    applyScanTransforms();
   m_positions.access()[linearIndex(index)] = position;
+  m_positionRevision = newPositionRevision();
 }
 
 /** Set the rotation of the detector with given detector index.
@@ -195,12 +227,35 @@ inline void DetectorInfo::setRotation(const size_t index,
                                       const Eigen::Quaterniond &rotation) {
   checkNoTimeDependence();
   m_rotations.access()[index] = rotation.normalized();
+  m_rotationRevision = newPositionRevision();
 }
 
 /// Set the rotation of the detector with given index.
 inline void DetectorInfo::setRotation(const std::pair<size_t, size_t> &index,
                                       const Eigen::Quaterniond &rotation) {
+  if (m_scanTransforms)
+    applyScanTransforms();
   m_rotations.access()[linearIndex(index)] = rotation.normalized();
+  m_rotationRevision = newPositionRevision();
+}
+
+/** Returns an identifier for the current state of the detector positions.
+ *
+ * The value changes whenever a detector position is set or scan points are
+ * merged, and it is unique across all DetectorInfo instances, i.e., two
+ * DetectorInfo objects return the same value only if one is a copy of the
+ * other and neither has been modified since. This allows clients to cache data
+ * derived from detector positions. */
+inline size_t DetectorInfo::positionRevision() const {
+  return m_positionRevision;
+}
+
+/** Returns an identifier for the current state of the detector rotations.
+ *
+ * Equivalent to positionRevision(), but changes whenever a detector rotation is
+ * set or scan points are merged. */
+inline size_t DetectorInfo::rotationRevision() const {
+  return m_rotationRevision;
 }
 
 /// Throws if this has time-dependent data.
@@ -463,6 +463,16 @@ bool ComponentInfo::hasDetectorInfo() const {
   return m_detectorInfo != nullptr;
 }
 
+/// Returns DetectorInfo::positionRevision(). Requires a DetectorInfo.
+size_t ComponentInfo::detectorPositionRevision() const {
+  return m_detectorInfo->positionRevision();
+}
+
+/// Returns DetectorInfo::rotationRevision(). Requires a DetectorInfo.
+size_t ComponentInfo::detectorRotationRevision() const {
+  return m_detectorInfo->rotationRevision();
+}
+
 void ComponentInfo::setDetectorInfo(DetectorInfo *detectorInfo) {
   if (detectorInfo &&
       detectorInfo->size() != m_assemblySortedDetectorIndices->size()) {
@@ -9,10 +9,33 @@
 #include "MantidKernel/make_cow.h"
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
 
 namespace Mantid {
 namespace Beamline {
 
+namespace {
+/// Source of globally unique revisions, see positionRevision().
+std::atomic<size_t> g_positionRevision{0};
+} // namespace
+
+/// Rigid transforms of banks of detectors for every time index of a
+/// synchronous scan, see DetectorInfo::setScanTransforms().
+struct DetectorInfo::ScanTransforms {
+  /// Marks detectors that are not part of any bank and thus do not move.
+  static constexpr size_t noBank = std::numeric_limits<size_t>::max();
+  /// Bank index of each detector.
+  std::vector<size_t> banks;
+  size_t bankCount;
+  /// Rotations and translations, index is timeIndex * bankCount + bank.
+  std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>
+      rotations;
+  std::vector<Eigen::Vector3d> translations;
+};
+
+constexpr size_t DetectorInfo::ScanTransforms::noBank;
+
 DetectorInfo::DetectorInfo(
     std::vector<Eigen::Vector3d> positions,
     std::vector<Eigen::Quaterniond,
@@ -29,6 +52,8 @@ DetectorInfo::DetectorInfo(
   if (m_positions->size() != m_rotations->size())
     throw std::runtime_error("DetectorInfo: Position and rotations vectors "
                              "must have identical size");
+  m_positionRevision = newPositionRevision();
+  m_rotationRevision = newPositionRevision();
 }
 
 DetectorInfo::DetectorInfo(
@@ -75,6 +100,16 @@ bool DetectorInfo::isEquivalent(const DetectorInfo &other) const {
       (*m_indices != *other.m_indices))
     return false;
 
+  // Compact scans are compared by their time-dependent positions and
+  // rotations, not by the way they are stored.
+  if (m_scanTransforms || other.m_scanTransforms) {
+    DetectorInfo expanded(*this);
+    DetectorInfo otherExpanded(other);
+    expanded.applyScanTransforms();
+    otherExpanded.applyScanTransforms();
+    return expanded.isEquivalent(otherExpanded);
+  }
+
   // Positions: Absolute difference matter, so comparison is not relative.
   // Changes below 1 nm = 1e-9 m are allowed.
   if (!(m_positions == other.m_positions) &&
@@ -111,9 +146,9 @@ bool DetectorInfo::isEquivalent(const DetectorInfo &other) const {
  * If a detector is moving, i.e., has more than one associated position, every
  *position is counted. */
 size_t DetectorInfo::scanSize() const {
-  if (!m_positions)
+  if (!m_isMasked)
     return 0;
-  return m_positions->size();
+  return m_isMasked->size();
 }
 
 /**
@@ -241,6 +276,81 @@ void DetectorInfo::setScanInterval(
   m_scanIntervals.access()[0] = interval;
 }
 
+/** Turns this into a synchronous scan where detectors move as rigid banks.
+ *
+ * Instead of storing a position and rotation for every detector and time index
+ * only the current positions and rotations are kept, together with one rigid
+ * transform per bank and time index. The position of a detector in bank `b` at
+ * time index `t` is `rotations[i] * position + translations[i]`, its rotation
+ * is `rotations[i] * rotation`, with `i = t * banks.size() + b`. Detectors that
+ * are not part of any bank do not move. This reduces the memory required for
+ * scans with many time indices by orders of magnitude. Positions and rotations
+ * are computed on access, setting the position or rotation of any detector
+ * converts back to the fully expanded representation.
+ *
+ * The number of time indices is given by the number of intervals, which must
+ * be valid and must not overlap. It is not possible to set scan transforms if
+ * the beamline has time-dependent detectors already. */
+void DetectorInfo::setScanTransforms(
+    const std::vector<std::pair<int64_t, int64_t>> &intervals,
+    const std::vector<std::vector<size_t>> &banks,
+    std::vector<Eigen::Quaterniond,
+                Eigen::aligned_allocator<Eigen::Quaterniond>>
+        rotations,
+    std::vector<Eigen::Vector3d> translations) {
+  checkNoTimeDependence();
+  if (!m_isSyncScan)
+    throw std::runtime_error(
+        "DetectorInfo has been initialized with a "
+        "asynchonous scan, cannot set synchronous scan transforms.");
+  if (intervals.empty())
+    throw std::runtime_error(
+        "DetectorInfo: scan transforms require at least one scan interval");
+  const size_t timeIndices = intervals.size();
+  if (rotations.size() != timeIndices * banks.size() ||
+      translations.size() != timeIndices * banks.size())
+    throw std::runtime_error("DetectorInfo: scan transforms require a rotation "
+                             "and translation for every bank and interval");
+  for (const auto &interval : intervals)
+    checkScanInterval(interval);
+  auto sortedIntervals(intervals);
+  std::sort(sortedIntervals.begin(), sortedIntervals.end());
+  for (size_t i = 1; i < sortedIntervals.size(); ++i)
+    if (sortedIntervals[i].first < sortedIntervals[i - 1].second)
+      throw std::runtime_error(
+          "DetectorInfo: scan intervals for scan transforms overlap");
+
+  auto transforms = Kernel::make_cow<ScanTransforms>();
+  auto &t = transforms.access();
+  t.banks.assign(size(), ScanTransforms::noBank);
+  for (size_t bank = 0; bank < banks.size(); ++bank) {
+    for (const auto detIndex : banks[bank]) {
+      if (t.banks.at(detIndex) != ScanTransforms::noBank)
+        throw std::runtime_error("DetectorInfo: detector is part of more than "
+                                 "one bank of scan transforms");
+      t.banks[detIndex] = bank;
+    }
+  }
+  t.bankCount = banks.size();
+  for (auto &rotation : rotations)
+    rotation.normalize();
+  t.rotations = std::move(rotations);
+  t.translations = std::move(translations);
+
+  // Mask flags are time dependent and cheap, so they are stored in full.
+  auto &isMasked = m_isMasked.access();
+  const std::vector<bool> masks(isMasked);
+  isMasked.reserve(timeIndices * size());
+  for (size_t timeIndex = 1; timeIndex < timeIndices; ++timeIndex)
+    isMasked.insert(isMasked.end(), masks.begin(), masks.end());
+  m_scanCounts = Kernel::make_cow<std::vector<size_t>>(1, timeIndices);
+  m_scanIntervals =
+      Kernel::make_cow<std::vector<std::pair<int64_t, int64_t>>>(intervals);
+  m_scanTransforms = std::move(transforms);
+  m_positionRevision = newPositionRevision();
+  m_rotationRevision = newPositionRevision();
+}
+
 namespace {
 void failMerge(const std::string &what) {
   throw std::runtime_error(std::string("Cannot merge DetectorInfo: ") + what);
@@ -267,8 +377,17 @@ getIndex(const Kernel::cow_ptr<std::vector<std::pair<size_t, size_t>>> &indices,
  * index in `other` is identical to a corresponding interval in `this`, it is
  * ignored, i.e., no time index is added. */
 void DetectorInfo::merge(const DetectorInfo &other) {
+  if (other.m_scanTransforms) {
+    DetectorInfo expanded(other);
+    expanded.applyScanTransforms();
+    merge(expanded);
+    return;
+  }
+  applyScanTransforms();
   if (!m_scanCounts)
     initScanCounts();
+  m_positionRevision = newPositionRevision();
+  m_rotationRevision = newPositionRevision();
   if (m_isSyncScan) {
     const auto &merge = buildMergeSyncScanIndices(other);
     for (size_t timeIndex = 0; timeIndex < other.m_scanIntervals->size();
@@ -315,6 +434,55 @@ void DetectorInfo::merge(const DetectorInfo &other) {
   m_scanCounts = std::move(scanCounts);
 }
 
+/// Returns a new, globally unique, position revision. Thread safe.
+size_t DetectorInfo::newPositionRevision() { return ++g_positionRevision; }
+
+Eigen::Vector3d DetectorInfo::transformedPosition(
+    const std::pair<size_t, size_t> &index) const {
+  const auto &transforms = *m_scanTransforms;
+  const auto bank = transforms.banks[index.first];
+  if (bank == ScanTransforms::noBank)
+    return (*m_positions)[index.first];
+  const size_t i = index.second * transforms.bankCount + bank;
+  return transforms.rotations[i] * (*m_positions)[index.first] +
+         transforms.translations[i];
+}
+
+Eigen::Quaterniond DetectorInfo::transformedRotation(
+    const std::pair<size_t, size_t> &index) const {
+  const auto &transforms = *m_scanTransforms;
+  const auto bank = transforms.banks[index.first];
+  if (bank == ScanTransforms::noBank)
+    return (*m_rotations)[index.first];
+  const size_t i = index.second * transforms.bankCount + bank;
+  return (transforms.rotations[i] * (*m_rotations)[index.first]).normalized();
+}
+
+/// Replaces scan transforms, if any, by positions and rotations for every
+/// detector and time index.
+void DetectorInfo::applyScanTransforms() {
+  if (!m_scanTransforms)
+    return;
+  const size_t timeIndices = (*m_scanCounts)[0];
+  std::vector<Eigen::Vector3d> positions;
+  std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>
+      rotations;
+  positions.reserve(timeIndices * size());
+  rotations.reserve(timeIndices * size());
+  for (size_t timeIndex = 0; timeIndex < timeIndices; ++timeIndex) {
+    for (size_t detIndex = 0; detIndex < size(); ++detIndex) {
+      positions.emplace_back(transformedPosition({detIndex, timeIndex}));
+      rotations.emplace_back(transformedRotation({detIndex, timeIndex}));
+    }
+  }
+  m_positions =
+      Kernel::make_cow<std::vector<Eigen::Vector3d>>(std::move(positions));
+  m_rotations = Kernel::make_cow<std::vector<
+      Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>>(
+      std::move(rotations));
+  m_scanTransforms = Kernel::cow_ptr<ScanTransforms>(nullptr);
+}
+
 void DetectorInfo::setComponentInfo(ComponentInfo *componentInfo) {
   m_componentInfo = componentInfo;
 }
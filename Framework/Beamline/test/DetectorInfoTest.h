@@ -277,6 +277,48 @@ public:
     TS_ASSERT_EQUALS(info.rotation(0).coeffs(), rot.normalized().coeffs());
   }
 
+  void test_positionRevision_unique() {
+    DetectorInfo info1(PosVec(1), RotVec(1));
+    DetectorInfo info2(PosVec(1), RotVec(1));
+    TS_ASSERT_DIFFERS(info1.positionRevision(), info2.positionRevision());
+  }
+
+  void test_positionRevision_copy() {
+    DetectorInfo info(PosVec(1), RotVec(1));
+    auto copy(info);
+    TS_ASSERT_EQUALS(copy.positionRevision(), info.positionRevision());
+    copy.setPosition(0, {1, 2, 3});
+    TS_ASSERT_DIFFERS(copy.positionRevision(), info.positionRevision());
+  }
+
+  void test_positionRevision_changes_with_setPosition() {
+    DetectorInfo info(PosVec(1), RotVec(1));
+    const auto revision = info.positionRevision();
+    info.setPosition({0, 0}, {1, 2, 3});
+    TS_ASSERT_DIFFERS(info.positionRevision(), revision);
+  }
+
+  void test_positionRevision_unchanged_by_setRotation_and_setMasked() {
+    DetectorInfo info(PosVec(1), RotVec(1));
+    const auto revision = info.positionRevision();
+    info.setRotation(0, {1, 2, 3, 4});
+    info.setMasked(0, true);
+    TS_ASSERT_EQUALS(info.positionRevision(), revision);
+  }
+
+  void test_rotationRevision_changes_with_setRotation() {
+    DetectorInfo info(PosVec(1), RotVec(1));
+    const auto positionRevision = info.positionRevision();
+    const auto revision = info.rotationRevision();
+    TS_ASSERT_DIFFERS(revision, positionRevision);
+    info.setRotation(0, {1, 2, 3, 4});
+    TS_ASSERT_DIFFERS(info.rotationRevision(), revision);
+    TS_ASSERT_EQUALS(info.positionRevision(), positionRevision);
+    const auto rotated = info.rotationRevision();
+    info.setPosition(0, {1, 2, 3});
+    TS_ASSERT_EQUALS(info.rotationRevision(), rotated);
+  }
+
   void test_scanCount() {
     DetectorInfo info(PosVec(1), RotVec(1));
     TS_ASSERT_EQUALS(info.scanCount(0), 1);
@@ -755,6 +797,138 @@ public:
     TS_ASSERT_THROWS_NOTHING(a2.merge(b));
     TS_ASSERT(a1.isEquivalent(a2));
   }
+  void test_setScanTransforms() {
+    const Eigen::Vector3d pos(1, 0, 0);
+    DetectorInfo info(PosVec(3, pos), RotVec(3, Eigen::Quaterniond::Identity()),
+                      {2});
+    const auto rot90 =
+        Eigen::Quaterniond(Eigen::AngleAxisd(M_PI / 2, Eigen::Vector3d::UnitY()));
+    RotVec rotations{Eigen::Quaterniond::Identity(), rot90};
+    PosVec translations{Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(0, 1, 0)};
+    std::pair<int64_t, int64_t> interval1(0, 1);
+    std::pair<int64_t, int64_t> interval2(1, 2);
+    TS_ASSERT_THROWS_NOTHING(info.setScanTransforms(
+        {interval1, interval2}, {{0, 1}}, rotations, translations));
+
+    TS_ASSERT(info.isScanning());
+    TS_ASSERT(info.isSyncScan());
+    TS_ASSERT_EQUALS(info.size(), 3);
+    TS_ASSERT_EQUALS(info.scanSize(), 6);
+    TS_ASSERT_EQUALS(info.scanCount(0), 2);
+    TS_ASSERT_EQUALS(info.scanInterval({0, 0}), interval1);
+    TS_ASSERT_EQUALS(info.scanInterval({1, 1}), interval2);
+    TS_ASSERT_EQUALS(info.position({0, 0}), pos);
+    TS_ASSERT((info.position({1, 1}) - Eigen::Vector3d(0, 1, -1)).norm() <
+              1e-12);
+    TS_ASSERT(info.rotation({1, 1}).isApprox(rot90));
+    // Monitor is not part of any bank and does not move
+    TS_ASSERT_EQUALS(info.position({2, 1}), pos);
+    TS_ASSERT(info.rotation({2, 1}).isApprox(Eigen::Quaterniond::Identity()));
+  }
+
+  void test_setScanTransforms_equivalent_to_merge() {
+    DetectorInfo a(PosVec{Eigen::Vector3d(1, 0, 0), Eigen::Vector3d(0, 1, 0)},
+                   RotVec(2, Eigen::Quaterniond::Identity()));
+    auto transformed(a);
+    auto b(a);
+    const Eigen::Vector3d shift(0, 0, 2);
+    b.setPosition(0, a.position(0) + shift);
+    b.setPosition(1, a.position(1) + shift);
+    std::pair<int64_t, int64_t> interval1(0, 1);
+    std::pair<int64_t, int64_t> interval2(1, 2);
+    a.setScanInterval(interval1);
+    b.setScanInterval(interval2);
+    a.merge(b);
+
+    transformed.setScanTransforms(
+        {interval1, interval2}, {{0, 1}},
+        RotVec(2, Eigen::Quaterniond::Identity()),
+        PosVec{Eigen::Vector3d(0, 0, 0), shift});
+    TS_ASSERT(transformed.isEquivalent(a));
+    TS_ASSERT(a.isEquivalent(transformed));
+  }
+
+  void test_setScanTransforms_setPosition_expands() {
+    DetectorInfo info(PosVec(2, Eigen::Vector3d(0, 0, 0)),
+                      RotVec(2, Eigen::Quaterniond::Identity()));
+    const Eigen::Vector3d shift(0, 0, 2);
+    info.setScanTransforms({{0, 1}, {1, 2}}, {{0, 1}},
+                           RotVec(2, Eigen::Quaterniond::Identity()),
+                           PosVec{Eigen::Vector3d(0, 0, 0), shift});
+    const auto revision = info.positionRevision();
+    const Eigen::Vector3d pos(3, 0, 0);
+    info.setPosition({1, 1}, pos);
+    TS_ASSERT_DIFFERS(info.positionRevision(), revision);
+    TS_ASSERT_EQUALS(info.position({1, 1}), pos);
+    TS_ASSERT_EQUALS(info.position({0, 1}), shift);
+    TS_ASSERT_EQUALS(info.position({1, 0}), Eigen::Vector3d(0, 0, 0));
+    TS_ASSERT_EQUALS(info.scanSize(), 4);
+  }
+
+  void test_setScanTransforms_masking() {
+    DetectorInfo info(PosVec(2), RotVec(2));
+    info.setMasked(1, true);
+    info.setScanTransforms({{0, 1}, {1, 2}}, {},
+                           RotVec(), PosVec());
+    TS_ASSERT(!info.isMasked({0, 0}));
+    TS_ASSERT(info.isMasked({1, 0}));
+    TS_ASSERT(info.isMasked({1, 1}));
+    info.setMasked({0, 1}, true);
+    TS_ASSERT(!info.isMasked({0, 0}));
+    TS_ASSERT(info.isMasked({0, 1}));
+  }
+
+  void test_setScanTransforms_merge() {
+    DetectorInfo a(PosVec(1, Eigen::Vector3d(0, 0, 0)),
+                   RotVec(1, Eigen::Quaterniond::Identity()));
+    auto b(a);
+    const Eigen::Vector3d shift(0, 0, 2);
+    a.setScanTransforms({{0, 1}, {1, 2}}, {{0}},
+                        RotVec(2, Eigen::Quaterniond::Identity()),
+                        PosVec{Eigen::Vector3d(0, 0, 0), shift});
+    b.setScanTransforms({{2, 3}}, {{0}}, RotVec(1, Eigen::Quaterniond::Identity()),
+                        PosVec{2 * shift});
+    TS_ASSERT_THROWS_NOTHING(a.merge(b));
+    TS_ASSERT_EQUALS(a.scanCount(0), 3);
+    TS_ASSERT_EQUALS(a.position({0, 1}), shift);
+    TS_ASSERT_EQUALS(a.position({0, 2}), 2 * shift);
+  }
+
+  void test_setScanTransforms_failures() {
+    DetectorInfo info(PosVec(2), RotVec(2));
+    const RotVec rotations(2, Eigen::Quaterniond::Identity());
+    const PosVec translations(2);
+    TS_ASSERT_THROWS(info.setScanTransforms({}, {}, RotVec(), PosVec()),
+                     std::runtime_error);
+    TS_ASSERT_THROWS(
+        info.setScanTransforms({{0, 1}, {1, 2}}, {{0}}, RotVec(1), PosVec(1)),
+        std::runtime_error);
+    TS_ASSERT_THROWS(info.setScanTransforms({{0, 1}, {1, 1}}, {{0}},
+                                            rotations, translations),
+                     std::runtime_error);
+    TS_ASSERT_THROWS(info.setScanTransforms({{0, 2}, {1, 3}}, {{0}},
+                                            rotations, translations),
+                     std::runtime_error);
+    TS_ASSERT_THROWS(info.setScanTransforms({{0, 1}}, {{0}, {0}}, rotations,
+                                            translations),
+                     std::runtime_error);
+    TS_ASSERT_THROWS(info.setScanTransforms({{0, 1}, {1, 2}}, {{2}},
+                                            rotations, translations),
+                     std::out_of_range);
+    TS_ASSERT(!info.isScanning());
+
+    TS_ASSERT_THROWS_NOTHING(info.setScanTransforms({{0, 1}, {1, 2}}, {{0}},
+                                                    rotations, translations));
+    TS_ASSERT_THROWS(info.setScanTransforms({{0, 1}, {1, 2}}, {{0}},
+                                            rotations, translations),
+                     std::runtime_error);
+
+    DetectorInfo async(PosVec(2), RotVec(2));
+    async.setScanInterval(0, {0, 1});
+    TS_ASSERT_THROWS(async.setScanTransforms({{0, 1}, {1, 2}}, {{0}},
+                                             rotations, translations),
+                     std::runtime_error);
+  }
 };
 
 #endif /* MANTID_BEAMLINE_DETECTORINFOTEST_H_ */
@@ -13,15 +13,12 @@
 #include "MantidAPI/FunctionValues.h"
 #include "MantidAPI/IFunction1D.h"
 #include "MantidCurveFitting/Functions/DeltaFunction.h"
+#include "MantidKernel/FFTService.h"
 
 #include <algorithm>
 #include <cmath>
 #include <functional>
 
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_fft_halfcomplex.h>
-#include <gsl/gsl_fft_real.h>
-
 #include <fstream>
 #include <sstream>
 
@@ -72,23 +69,6 @@ void Convolution::setAttribute(const std::string &attName,
   CompositeFunction::setAttribute(attName, att);
 }
 
-namespace {
-// anonymous namespace for local definitions
-
-// A struct incapsulating workspaces for real fft
-struct RealFFTWorkspace {
-  explicit RealFFTWorkspace(size_t nData)
-      : workspace(gsl_fft_real_workspace_alloc(nData)),
-        wavetable(gsl_fft_real_wavetable_alloc(nData)) {}
-  ~RealFFTWorkspace() {
-    gsl_fft_real_wavetable_free(wavetable);
-    gsl_fft_real_workspace_free(workspace);
-  }
-  gsl_fft_real_workspace *workspace;
-  gsl_fft_real_wavetable *wavetable;
-};
-} // namespace
-
 /**
  * Calculates convolution of the two member functions. Switches from FFT mode
  * to direct mode if the domain is not symmetric with respect to the
@@ -135,7 +115,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
   size_t nData = domain.size();
   const double *xValues = d1d.getPointerAt(0);
   refreshResolution();
-  RealFFTWorkspace workspace(nData);
+  const auto plan = FFTService::plan(nData);
   int n2 = static_cast<int>(nData) / 2;
   bool odd = n2 * 2 != static_cast<int>(nData);
   if (m_resolution.empty()) {
@@ -179,8 +159,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
         m_resolution[n2 + i] = tmp;
       }
     }
-    gsl_fft_real_transform(m_resolution.data(), 1, nData, workspace.wavetable,
-                           workspace.workspace);
+    plan->forward(m_resolution.data());
     std::transform(m_resolution.begin(), m_resolution.end(),
                    m_resolution.begin(),
                    std::bind2nd(std::multiplies<double>(), dx));
@@ -240,8 +219,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
   if (!deltaFunctionsOnly) {
     // Transform the model function
     getFunction(1)->function(domain, values);
-    gsl_fft_real_transform(out, 1, nData, workspace.wavetable,
-                           workspace.workspace);
+    plan->forward(out);
 
     // Fourier transform is integration - multiply by the step in the
     // integration variable
@@ -251,26 +229,12 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
 
     // now out contains fourier transform of the model function
 
-    HalfComplex res(m_resolution.data(), nData);
-    HalfComplex fun(out, nData);
-
     // Multiply transforms of the resolution and model functions
-    // Result is stored in fun
-    for (size_t i = 0; i <= res.size(); i++) {
-      // complex multiplication
-      double res_r = res.real(i);
-      double res_i = res.imag(i);
-      double fun_r = fun.real(i);
-      double fun_i = fun.imag(i);
-      fun.set(i, res_r * fun_r - res_i * fun_i, res_r * fun_i + res_i * fun_r);
-    }
+    // Result is stored in out
+    FFTService::multiply(m_resolution.data(), out, out, nData);
 
-    // Inverse fourier transform of fun
-    gsl_fft_halfcomplex_wavetable *wavetable_r =
-        gsl_fft_halfcomplex_wavetable_alloc(nData);
-    gsl_fft_halfcomplex_inverse(out, 1, nData, wavetable_r,
-                                workspace.workspace);
-    gsl_fft_halfcomplex_wavetable_free(wavetable_r);
+    // Inverse fourier transform of out
+    plan->inverse(out);
 
     // Inverse fourier transform is integration - multiply by the step in the
     // integration variable
@@ -20,6 +20,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/ParallelReduce.h"
 #include "MantidKernel/StringTokenizer.h"
 #include "MantidKernel/Strings.h"
 #include "MantidTypes/SpectrumDefinition.h"
@@ -29,6 +30,9 @@
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/regex.hpp>
 
+#include <cmath>
+#include <list>
+
 namespace Mantid {
 namespace DataHandling {
 // Register the algorithm into the algorithm factory
@@ -88,6 +92,59 @@ void forceSpectraAxis(MatrixWorkspace &ws) {
   ws.replaceAxis(1, new SpectraAxis(&ws));
 }
 
+/// The minimum number of spectra of a group summed by one thread before the
+/// partial sums are merged. Smaller groups are summed by a single thread.
+constexpr size_t SPECTRA_PER_CHUNK = 1000;
+
+/// Partial sums of the counts and variances of some spectra of a group.
+struct PartialGroupSum {
+  explicit PartialGroupSum(const size_t size) : y(size), e2(size) {}
+
+  /// Adds a spectrum, which must be compatible with the group's histogram.
+  void add(const HistogramData::Histogram &group,
+           const HistogramData::Histogram &spectrum) {
+    if (group.xMode() != spectrum.xMode() || group.yMode() != spectrum.yMode())
+      throw std::runtime_error(
+          "Invalid operation: Histogram::XModes and YModes must match");
+    if (!(group.sharedX() == spectrum.sharedX()) &&
+        group.x().rawData() != spectrum.x().rawData())
+      throw std::runtime_error(
+          "Invalid operation: Histogram X data must match");
+    const auto &values = spectrum.y();
+    const auto &errors = spectrum.e();
+    for (size_t i = 0; i < y.size(); ++i) {
+      y[i] += values[i];
+      e2[i] += errors[i] * errors[i];
+    }
+  }
+
+  PartialGroupSum &operator+=(const PartialGroupSum &other) {
+    for (size_t i = 0; i < y.size(); ++i) {
+      y[i] += other.y[i];
+      e2[i] += other.e2[i];
+    }
+    nonMaskedSpectra += other.nonMaskedSpectra;
+    return *this;
+  }
+
+  std::vector<CompensatedSum> y;
+  std::vector<CompensatedSum> e2;
+  size_t nonMaskedSpectra{0};
+};
+
+/// Partial event lists of some spectra of a group.
+struct PartialGroupEvents {
+  PartialGroupEvents &operator+=(PartialGroupEvents &other) {
+    events.splice(events.end(), other.events);
+    nonMaskedSpectra += other.nonMaskedSpectra;
+    return *this;
+  }
+
+  /// Events of consecutive members, in order. Merging splices the lists, so
+  /// the events are only copied once, into the output.
+  std::list<EventList> events;
+  size_t nonMaskedSpectra{0};
+};
 } // anonymous namespace
 
 // progress estimates
@@ -996,24 +1053,35 @@ size_t GroupDetectors2::formGroups(API::MatrixWorkspace_const_sptr inputWS,
     outSpec.setSharedX(inputWS->sharedX(0));
     auto outputHistogram = outSpec.histogram();
 
-    // Keep track of number of detectors required for masking
-    size_t nonMaskedSpectra(0);
-    auto spectrumGroup = std::vector<size_t>();
-
-    for (auto originalWI : it->second) {
-      // detectors to add to firstSpecNum
-      const auto &inputSpectrum = inputWS->getSpectrum(originalWI);
-
-      outputHistogram += inputSpectrum.histogram();
-      outSpec.addDetectorIDs(inputSpectrum.getDetectorIDs());
-
-      if (!isMaskedDetector(spectrumInfo, originalWI))
-        ++nonMaskedSpectra;
-
-      spectrumGroup.push_back(originalWI);
+    // Sum the spectra of large groups in parallel, keeping track of number of
+    // detectors required for masking
+    const auto &members = it->second;
+    const auto sum = parallelReduce(
+        members.size(), PartialGroupSum(outputHistogram.size()),
+        [&](PartialGroupSum &partial, const size_t i) {
+          const auto originalWI = members[i];
+          partial.add(outputHistogram, inputWS->histogram(originalWI));
+          if (!isMaskedDetector(spectrumInfo, originalWI))
+            ++partial.nonMaskedSpectra;
+        },
+        [](PartialGroupSum &partial, PartialGroupSum &other) {
+          partial += other;
+        },
+        SPECTRA_PER_CHUNK, threadSafe(*inputWS));
+    size_t nonMaskedSpectra = sum.nonMaskedSpectra;
+
+    auto &outputY = outputHistogram.mutableY();
+    auto &outputE = outputHistogram.mutableE();
+    for (size_t i = 0; i < outputY.size(); ++i) {
+      outputY[i] += sum.y[i].value();
+      outputE[i] = std::sqrt(outputE[i] * outputE[i] + sum.e2[i].value());
     }
 
-    spectrumGroups.push_back(spectrumGroup);
+    // detectors to add to firstSpecNum
+    for (auto originalWI : members)
+      outSpec.addDetectorIDs(inputWS->getSpectrum(originalWI).getDetectorIDs());
+
+    spectrumGroups.push_back(members);
 
     outSpec.setHistogram(outputHistogram);
 
@@ -1116,20 +1184,28 @@ GroupDetectors2::formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
     // the Y values and errors from spectra being grouped are combined in the
     // output spectrum
     // Keep track of number of detectors required for masking
-    size_t nonMaskedSpectra(0);
     beh->mutableX(outIndex)[0] = 0.0;
     beh->mutableE(outIndex)[0] = 0.0;
-    for (auto originalWI : it->second) {
-      const EventList &fromEL = inputWS->getSpectrum(originalWI);
-      // Add the event lists with the operator
-      outEL += fromEL;
-
-      // detectors to add to the output spectrum
-      outEL.addDetectorIDs(fromEL.getDetectorIDs());
-      if (!isMaskedDetector(spectrumInfo, originalWI)) {
-        ++nonMaskedSpectra;
-      }
-    }
+    const auto &members = it->second;
+    auto sum = parallelReduce(
+        members.size(), PartialGroupEvents(),
+        [&](PartialGroupEvents &partial, const size_t i) {
+          const auto originalWI = members[i];
+          // Add the event lists with the operator, this also adds the
+          // detectors to the output spectrum
+          if (partial.events.empty())
+            partial.events.emplace_back();
+          partial.events.back() += inputWS->getSpectrum(originalWI);
+          if (!isMaskedDetector(spectrumInfo, originalWI))
+            ++partial.nonMaskedSpectra;
+        },
+        [](PartialGroupEvents &partial, PartialGroupEvents &other) {
+          partial += other;
+        },
+        SPECTRA_PER_CHUNK, threadSafe(*inputWS));
+    for (auto &events : sum.events)
+      outEL += std::move(events);
+    size_t nonMaskedSpectra = sum.nonMaskedSpectra;
     if (nonMaskedSpectra == 0)
       ++nonMaskedSpectra; // Avoid possible divide by zero
     if (!requireDivide)
@@ -975,6 +975,43 @@ public:
     TS_ASSERT_THROWS_ANYTHING(spectrumInfo.detector(1));
   }
 
+  void test_large_group_is_summed_in_parallel() {
+    // More spectra than are summed by a single thread
+    const int numBanks{2};
+    const int bankWidthInPixels{40};
+    const bool clearEvents{false};
+    auto ws = WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(
+        numBanks, bankWidthInPixels, clearEvents);
+    const size_t numEvents{200};
+    const size_t groupSize{3000};
+    for (const bool preserveEvents : {true, false}) {
+      GroupDetectors2 group;
+      group.initialize();
+      group.setChild(true);
+      group.setRethrows(true);
+      group.setProperty("InputWorkspace", ws);
+      group.setPropertyValue("OutputWorkspace", "unused_for_child");
+      group.setPropertyValue("GroupingPattern", "0-2999");
+      group.setProperty("PreserveEvents", preserveEvents);
+      TS_ASSERT_THROWS_NOTHING(group.execute());
+      MatrixWorkspace_sptr output = group.getProperty("OutputWorkspace");
+      TS_ASSERT_EQUALS(output->getNumberHistograms(), 1);
+      TS_ASSERT_EQUALS(output->getSpectrum(0).getDetectorIDs().size(),
+                       groupSize);
+      double expected{0.};
+      for (size_t i = 0; i < groupSize; ++i)
+        expected += ws->y(i)[0];
+      TS_ASSERT_DELTA(output->y(0)[0], expected, 1e-9);
+      if (preserveEvents) {
+        auto events = boost::dynamic_pointer_cast<EventWorkspace>(output);
+        TS_ASSERT(events);
+        TS_ASSERT_EQUALS(events->getNumberEvents(), groupSize * numEvents);
+      } else {
+        TS_ASSERT_DELTA(output->e(0)[0], std::sqrt(expected), 1e-9);
+      }
+    }
+  }
+
   void test_GroupingPattern_event_workspace_without_SpectraAxis_works() {
     const int numBanks{1};
     const int bankWidthInPixels{3};
@@ -227,7 +227,7 @@ private:
     TS_ASSERT_THROWS_NOTHING(
         output = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
             wsName));
-    auto spectrumInfo = output->spectrumInfo();
+    const auto &spectrumInfo = output->spectrumInfo();
     auto det4Position = spectrumInfo.position(3); // spectrum 4 = ws index 3
 
     double r(-1.0), theta(-1.0), phi(-1.0);
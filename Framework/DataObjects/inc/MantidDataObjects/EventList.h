@@ -90,6 +90,8 @@ public:
 
   EventList &operator+=(const EventList &more_events);
 
+  EventList &operator+=(EventList &&more_events);
+
   EventList &operator-=(const EventList &more_events);
 
   bool operator==(const EventList &rhs) const;
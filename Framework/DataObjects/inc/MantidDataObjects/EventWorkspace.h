@@ -11,7 +11,9 @@
 #include "MantidAPI/ISpectrum.h"
 #include "MantidDataObjects/EventList.h"
 #include "MantidKernel/System.h"
+#include "MantidKernel/cow_ptr.h"
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <memory>
 #include <string>
 
 namespace Mantid {
@@ -42,7 +44,10 @@ public:
   // Destructor
   ~EventWorkspace() override;
 
-  /// Returns a clone of the workspace
+  /// Returns a clone of the workspace, sharing the event lists until either
+  /// workspace modifies them. References returned by the non-const
+  /// getSpectrum before cloning are invalidated: writing through them would
+  /// modify the clone too, so get them again after cloning.
   std::unique_ptr<EventWorkspace> clone() const {
     return std::unique_ptr<EventWorkspace>(doClone());
   }
@@ -161,13 +166,18 @@ private:
     return new EventWorkspace(storageMode());
   }
 
+  EventList &mutableEventList(const size_t index);
+
   /** A vector that holds the event list for each spectrum; the key is
-   * the workspace index, which is not necessarily the pixelid.
+   * the workspace index, which is not necessarily the pixelid. Clones share
+   * the event lists until they are modified.
    */
-  std::vector<EventList *> data;
+  std::vector<Kernel::cow_ptr<EventList>> data;
 
-  /// Container for the MRU lists of the event lists contained.
-  mutable EventWorkspaceMRU *mru;
+  /// Container for the MRU lists of the event lists contained. Shared with
+  /// clones, since they may hold the same event lists, so clearMRU() on one
+  /// of them drops the cached histograms of all.
+  std::shared_ptr<EventWorkspaceMRU> mru;
 };
 
 /// shared pointer to the EventWorkspace class
@@ -88,8 +88,6 @@ private:
 
   void buildPositions(Geometry::DetectorInfo &outputDetectorInfo) const;
   void buildRotations(Geometry::DetectorInfo &outputDetectorInfo) const;
-  void buildRelativeRotationsForScans(
-      Geometry::DetectorInfo &outputDetectorInfo) const;
 
   void createTimeOrientedIndexInfo(API::MatrixWorkspace &ws) const;
   void createDetectorOrientedIndexInfo(API::MatrixWorkspace &ws) const;
@@ -92,8 +92,8 @@ protected:
   /// a vector holding workspace index of monitors in the workspace
   std::vector<specnum_t> m_monitorList;
 
-  /// A vector that holds the 1D histograms
-  std::vector<Histogram1D *> data;
+  /// The 1D histograms, held by value in one array
+  std::vector<Histogram1D> data;
 
 private:
   Workspace2D *doClone() const override;
@@ -13,6 +13,7 @@
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/Unit.h"
+#include "MantidKernel/UnitConversion.h"
 
 #ifdef _MSC_VER
 // qualifier applied to function type has no meaning; ignored
@@ -23,6 +24,8 @@
 #pragma warning(default : 4180)
 #endif
 
+#include <algorithm>
+#include <array>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -523,6 +526,34 @@ EventList &EventList::operator+=(const EventList &more_events) {
   return *this;
 }
 
+// --------------------------------------------------------------------------
+/** Append another EventList to this event list and clear it.
+ * If this list has no events, the events of the other list are taken over
+ * instead of copied. Otherwise this is the same as appending a copy.
+ *
+ * @param more_events :: Another EventList, left without events.
+ * @return reference to this
+ * */
+EventList &EventList::operator+=(EventList &&more_events) {
+  if (this->empty()) {
+    // The type appending would have given
+    const auto type = std::max(this->eventType, more_events.eventType);
+    if (mru)
+      mru->deleteIndex(this);
+    this->events.swap(more_events.events);
+    this->weightedEvents.swap(more_events.weightedEvents);
+    this->weightedEventsNoTime.swap(more_events.weightedEventsNoTime);
+    this->eventType = more_events.eventType;
+    this->switchTo(type);
+    this->order = UNSORTED;
+    addDetectorIDs(more_events.getDetectorIDs());
+  } else {
+    this->operator+=(static_cast<const EventList &>(more_events));
+  }
+  more_events.clear(false);
+  return *this;
+}
+
 // --------------------------------------------------------------------------
 /** SUBTRACT another EventList from this event list.
  * The event lists are concatenated, but the weights of the incoming
@@ -4677,13 +4708,18 @@ template <class T>
 void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events,
                                          Mantid::Kernel::Unit *fromUnit,
                                          Mantid::Kernel::Unit *toUnit) {
-  auto itev = events.begin();
-  auto itev_end = events.end();
-  for (; itev != itev_end; itev++) {
-    // Conver to TOF
-    double tof = fromUnit->singleToTOF(itev->m_tof);
-    // And back from TOF to whatever
-    itev->m_tof = toUnit->singleFromTOF(tof);
+  // The events are converted in blocks, so the units can use their batch
+  // conversions on contiguous arrays
+  constexpr size_t blockSize = 512;
+  std::array<double, blockSize> block;
+  for (size_t start = 0; start < events.size(); start += blockSize) {
+    const size_t size = std::min(blockSize, events.size() - start);
+    for (size_t i = 0; i < size; ++i)
+      block[i] = events[start + i].m_tof;
+    Kernel::UnitConversion::run(*fromUnit, *toUnit, block.data(), block.data(),
+                                size);
+    for (size_t i = 0; i < size; ++i)
+      events[start + i].m_tof = block[i];
   }
 }
 
@@ -23,6 +23,7 @@
 #include "MantidKernel/IPropertyManager.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
+#include "MantidKernel/make_cow.h"
 
 #include "tbb/parallel_for.h"
 #include <limits>
@@ -45,23 +46,22 @@ using std::size_t;
 using namespace Mantid::Kernel;
 
 EventWorkspace::EventWorkspace(const Parallel::StorageMode storageMode)
-    : IEventWorkspace(storageMode), mru(new EventWorkspaceMRU) {}
-
+    : IEventWorkspace(storageMode),
+      mru(std::make_shared<EventWorkspaceMRU>()) {}
+
+/** Copy constructor. The event lists are not copied but shared with other:
+ * a list is only copied when either workspace asks for write access to it,
+ * so cloning costs O(number of spectra) and only modified spectra use more
+ * memory. References to event lists of other obtained before the copy must
+ * therefore not be used for writing afterwards. The MRU is shared too.
+ * @param other :: the workspace to copy
+ */
 EventWorkspace::EventWorkspace(const EventWorkspace &other)
-    : IEventWorkspace(other), mru(new EventWorkspaceMRU) {
-  for (const auto &el : other.data) {
-    // Create a new event list, copying over the events
-    auto newel = new EventList(*el);
-    // Make sure to update the MRU to point to THIS event workspace.
-    newel->setMRU(this->mru);
-    this->data.push_back(newel);
-  }
-}
+    : IEventWorkspace(other), data(other.data), mru(other.mru) {}
 
 EventWorkspace::~EventWorkspace() {
-  for (auto &eventList : data)
-    delete eventList;
-  delete mru;
+  // Event lists remove themselves from the MRU, so release them first
+  data.clear();
 }
 
 /** Returns true if the EventWorkspace is safe for multithreaded operations.
@@ -105,9 +105,10 @@ void EventWorkspace::init(const std::size_t &NVectors,
   EventList el;
   el.setHistogram(edges);
   for (size_t i = 0; i < NVectors; i++) {
-    data[i] = new EventList(el);
-    data[i]->setMRU(mru);
-    data[i]->setSpectrumNo(specnum_t(i));
+    data[i] = Kernel::make_cow<EventList>(el);
+    auto &eventList = data[i].access();
+    eventList.setMRU(mru.get());
+    eventList.setSpectrumNo(specnum_t(i));
   }
 
   // Create axes.
@@ -129,9 +130,10 @@ void EventWorkspace::init(const HistogramData::Histogram &histogram) {
   EventList el;
   el.setHistogram(histogram);
   for (size_t i = 0; i < data.size(); i++) {
-    data[i] = new EventList(el);
-    data[i]->setMRU(mru);
-    data[i]->setSpectrumNo(specnum_t(i));
+    data[i] = Kernel::make_cow<EventList>(el);
+    auto &eventList = data[i].access();
+    eventList.setMRU(mru.get());
+    eventList.setSpectrumNo(specnum_t(i));
   }
 
   m_axes.resize(2);
@@ -143,7 +145,7 @@ void EventWorkspace::init(const HistogramData::Histogram &histogram) {
 /// @returns the number of single indexable items in the workspace
 size_t EventWorkspace::size() const {
   return std::accumulate(data.begin(), data.end(), static_cast<size_t>(0),
-                         [](size_t value, EventList *histo) {
+                         [](size_t value, const auto &histo) {
                            return value + histo->histogram_size();
                          });
 }
@@ -156,7 +158,7 @@ size_t EventWorkspace::blocksize() const {
                            "therefore cannot determine blocksize (# of bins).");
   } else {
     size_t numBins = data[0]->histogram_size();
-    for (const auto *iter : data)
+    for (const auto &iter : data)
       if (numBins != iter->histogram_size())
         throw std::length_error(
             "blocksize undefined because size of histograms is not equal");
@@ -170,11 +172,15 @@ size_t EventWorkspace::blocksize() const {
  */
 size_t EventWorkspace::getNumberHistograms() const { return this->data.size(); }
 
-/// Return const reference to EventList at the given workspace index.
+/// Return reference to EventList at the given workspace index. If the list is
+/// shared with a clone of this workspace it is copied first. The reference is
+/// invalidated by cloning the workspace.
 EventList &EventWorkspace::getSpectrum(const size_t index) {
+  if (index >= data.size())
+    throw std::range_error(
+        "EventWorkspace::getSpectrum, workspace index out of range");
   invalidateCommonBinsFlag();
-  auto &spec = const_cast<EventList &>(
-      static_cast<const EventWorkspace &>(*this).getSpectrum(index));
+  auto &spec = mutableEventList(index);
   spec.setMatrixWorkspace(this, index);
   return spec;
 }
@@ -399,7 +405,7 @@ void EventWorkspace::getEventXMinMax(double &xmin, double &xmax) const {
 /// @returns The total number of events
 size_t EventWorkspace::getNumberEvents() const {
   return std::accumulate(data.begin(), data.end(), size_t{0},
-                         [](size_t total, EventList *list) {
+                         [](size_t total, const auto &list) {
                            return total + list->getNumberEvents();
                          });
 }
@@ -410,7 +416,7 @@ size_t EventWorkspace::getNumberEvents() const {
  */
 Mantid::API::EventType EventWorkspace::getEventType() const {
   Mantid::API::EventType out = Mantid::API::TOF;
-  for (auto list : this->data) {
+  for (const auto &list : this->data) {
     Mantid::API::EventType thisType = list->getEventType();
     if (static_cast<int>(out) < static_cast<int>(thisType)) {
       out = thisType;
@@ -427,8 +433,8 @@ Mantid::API::EventType EventWorkspace::getEventType() const {
  * @param type :: EventType to switch to
  */
 void EventWorkspace::switchEventType(const Mantid::API::EventType type) {
-  for (auto &eventList : this->data)
-    eventList->switchTo(type);
+  for (size_t i = 0; i < data.size(); ++i)
+    mutableEventList(i).switchTo(type);
 }
 
 /// Returns true always - an EventWorkspace always represents histogramm-able
@@ -451,7 +457,7 @@ size_t EventWorkspace::getMemorySize() const {
 
   // Add the memory from all the event lists
   size_t total = std::accumulate(data.begin(), data.end(), size_t{0},
-                                 [](size_t total, EventList *list) {
+                                 [](size_t total, const auto &list) {
                                    return total + list->getMemorySize();
                                  });
 
@@ -579,8 +585,8 @@ void EventWorkspace::setAllX(const HistogramData::BinEdges &x) {
   // This is an EventWorkspace, so changing X size is ok as long as we clear
   // the MRU below, i.e., we avoid the size check of Histogram::setBinEdges and
   // just reset the whole Histogram.
-  for (auto &eventList : this->data)
-    eventList->setHistogram(x);
+  for (size_t i = 0; i < data.size(); ++i)
+    mutableEventList(i).setHistogram(x);
 
   // Clear MRU lists now, free up memory
   this->clearMRU();
@@ -688,13 +694,26 @@ void EventWorkspace::getIntegratedSpectra(std::vector<double> &out,
   for (int wksp_index = 0; wksp_index < int(this->getNumberHistograms());
        wksp_index++) {
     // Get Handle to data
-    EventList *el = this->data[wksp_index];
+    const EventList *el = this->data[wksp_index].get();
 
     // Let the eventList do the integration
     out[wksp_index] = el->integrate(minX, maxX, entireRange);
   }
 }
 
+/** Get write access to an event list without invalidating any flags of the
+ * workspace.
+ * @param index :: the workspace index
+ * @return the event list, copied first if it is shared with a clone of this
+ * workspace
+ */
+EventList &EventWorkspace::mutableEventList(const size_t index) {
+  auto &eventList = data[index].access();
+  // A copy has no MRU yet
+  eventList.setMRU(mru.get());
+  return eventList;
+}
+
 } // namespace DataObjects
 } // namespace Mantid
 
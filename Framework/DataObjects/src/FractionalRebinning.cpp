@@ -12,8 +12,11 @@
 #include "MantidGeometry/Math/Quadrilateral.h"
 #include "MantidKernel/V2D.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
+#include <tuple>
 
 namespace Mantid {
 
@@ -442,6 +445,154 @@ void calcTrapezoidYIntersections(
   }
 }
 
+namespace {
+/// A polygon clipped from a quadrilateral by at most four axis-aligned edges.
+/// Each edge adds at most one vertex to a convex quad and two to a concave one,
+/// so the vertices fit on the stack. Vertices beyond the capacity (only
+/// possible for a self-intersecting quad) are dropped and flag an overflow.
+struct ClippedPolygon {
+  static constexpr size_t MAX_VERTICES = 4 + 2 * 4;
+  std::array<double, MAX_VERTICES> x;
+  std::array<double, MAX_VERTICES> y;
+  size_t size{0};
+  bool overflow{false};
+
+  void add(const double vx, const double vy) {
+    if (size == MAX_VERTICES) {
+      overflow = true;
+      return;
+    }
+    x[size] = vx;
+    y[size] = vy;
+    ++size;
+  }
+  /// Area with the shoelace formula, independent of the winding
+  double area() const {
+    double twiceArea(0.);
+    for (size_t i = 0, prev = size - 1; i < size; prev = i++)
+      twiceArea += x[prev] * y[i] - x[i] * y[prev];
+    return 0.5 * std::abs(twiceArea);
+  }
+  double minX() const {
+    return *std::min_element(x.cbegin(), x.cbegin() + size);
+  }
+  double maxX() const {
+    return *std::max_element(x.cbegin(), x.cbegin() + size);
+  }
+};
+
+/**
+ * One Sutherland-Hodgman step: clip a polygon by an axis-aligned line
+ * @param input The polygon to clip
+ * @param bound The position of the line
+ * @param output The part of input with x (or y) above or below bound
+ */
+template <bool ClipX, bool KeepAbove>
+void clipPolygon(const ClippedPolygon &input, const double bound,
+                 ClippedPolygon &output) {
+  output.size = 0;
+  output.overflow = input.overflow;
+  if (input.size == 0)
+    return;
+  const auto &coord = ClipX ? input.x : input.y;
+  size_t prev = input.size - 1;
+  bool prevInside = KeepAbove ? coord[prev] >= bound : coord[prev] <= bound;
+  for (size_t cur = 0; cur < input.size; prev = cur++) {
+    const bool curInside =
+        KeepAbove ? coord[cur] >= bound : coord[cur] <= bound;
+    if (curInside != prevInside) {
+      const double t = (bound - coord[prev]) / (coord[cur] - coord[prev]);
+      if (ClipX)
+        output.add(bound, input.y[prev] + t * (input.y[cur] - input.y[prev]));
+      else
+        output.add(input.x[prev] + t * (input.x[cur] - input.x[prev]), bound);
+    }
+    if (curInside)
+      output.add(input.x[cur], input.y[cur]);
+    prevInside = curInside;
+  }
+}
+
+/**
+ * Intersect the input quadrilateral with one output bin using the general
+ * ConvexPolygon routine. Used when clipping overflows a ClippedPolygon.
+ * @param xAxis A vector containing the output horizontal axis edges
+ * @param yAxis The output data vertical axis
+ * @param inputQ The input quadrilateral
+ * @param xi The x-axis index of the bin
+ * @param yi The y-axis index of the bin
+ * @param overlap The intersection of the bin and inputQ
+ */
+void intersectBin(const std::vector<double> &xAxis,
+                  const std::vector<double> &yAxis, const Quadrilateral &inputQ,
+                  const size_t xi, const size_t yi, ClippedPolygon &overlap) {
+  overlap.size = 0;
+  overlap.overflow = false;
+  const Quadrilateral outputQ(xAxis[xi], xAxis[xi + 1], yAxis[yi],
+                              yAxis[yi + 1]);
+  ConvexPolygon intersectOverlap;
+  if (!intersection(outputQ, inputQ, intersectOverlap))
+    return;
+  for (size_t v = 0; v < intersectOverlap.npoints(); ++v)
+    overlap.add(intersectOverlap[v].X(), intersectOverlap[v].Y());
+}
+
+/**
+ * Clip the input quadrilateral by each output bin it may overlap and call
+ * func(xi, yi, overlap, area) for the bins with a non-zero overlap. The quad is
+ * clipped by an output row first, only the bins spanned by the resulting
+ * slab are then clipped individually. Nothing is allocated on the heap unless
+ * a clipped polygon overflows, the bin is then intersected as a ConvexPolygon.
+ * @param xAxis A vector containing the output horizontal axis edges
+ * @param yAxis The output data vertical axis
+ * @param inputQ The input quadrilateral
+ * @param qstart The starting y-axis index
+ * @param qend The ending y-axis index
+ * @param x_start The starting x-axis index
+ * @param x_end The ending x-axis index
+ * @param func The callable to pass each overlap to
+ */
+template <class Func>
+void forEachOverlap(const std::vector<double> &xAxis,
+                    const std::vector<double> &yAxis,
+                    const Quadrilateral &inputQ, const size_t qstart,
+                    const size_t qend, const size_t x_start, const size_t x_end,
+                    Func &&func) {
+  ClippedPolygon quad, above, slab, right, overlap;
+  for (size_t v = 0; v < 4; ++v)
+    quad.add(inputQ[v].X(), inputQ[v].Y());
+  const auto xBegin = xAxis.cbegin() + x_start;
+  const auto xEnd = xAxis.cbegin() + x_end + 1;
+  for (size_t yi = qstart; yi < qend; ++yi) {
+    clipPolygon<false, true>(quad, yAxis[yi], above);
+    clipPolygon<false, false>(above, yAxis[yi + 1], slab);
+    if (slab.size < 3 && !slab.overflow)
+      continue;
+    // Candidate bins: those overlapping the x range of this row's slab, all
+    // of them if the slab lost vertices
+    size_t first(x_start), last(x_end);
+    if (!slab.overflow) {
+      const auto lowEdge = std::upper_bound(xBegin, xEnd, slab.minX());
+      const auto highEdge = std::lower_bound(lowEdge, xEnd, slab.maxX());
+      if (lowEdge != xBegin)
+        first += static_cast<size_t>(lowEdge - xBegin - 1);
+      last = std::min(x_end, x_start + static_cast<size_t>(highEdge - xBegin));
+    }
+    for (size_t xi = first; xi < last; ++xi) {
+      clipPolygon<true, true>(slab, xAxis[xi], right);
+      clipPolygon<true, false>(right, xAxis[xi + 1], overlap);
+      if (overlap.overflow)
+        intersectBin(xAxis, yAxis, inputQ, xi, yi, overlap);
+      if (overlap.size < 3)
+        continue;
+      const double area = overlap.area();
+      if (area > 0.)
+        func(xi, yi, overlap, area);
+    }
+  }
+}
+} // namespace
+
 /**
  * Computes the output grid bins which intersect the input quad and their
  * overlapping areas for arbitrary shaped input grids
@@ -459,22 +610,11 @@ void calcGeneralIntersections(
     const Quadrilateral &inputQ, const size_t qstart, const size_t qend,
     const size_t x_start, const size_t x_end,
     std::vector<std::tuple<size_t, size_t, double>> &areaInfo) {
-  ConvexPolygon intersectOverlap;
-  for (size_t yi = qstart; yi < qend; ++yi) {
-    const double vlo = yAxis[yi];
-    const double vhi = yAxis[yi + 1];
-    for (size_t xi = x_start; xi < x_end; ++xi) {
-      const V2D ll(xAxis[xi], vlo);
-      const V2D lr(xAxis[xi + 1], vlo);
-      const V2D ur(xAxis[xi + 1], vhi);
-      const V2D ul(xAxis[xi], vhi);
-      const Quadrilateral outputQ(ll, lr, ur, ul);
-      intersectOverlap.clear();
-      if (intersection(outputQ, inputQ, intersectOverlap)) {
-        areaInfo.emplace_back(xi, yi, intersectOverlap.area());
-      }
-    }
-  }
+  forEachOverlap(xAxis, yAxis, inputQ, qstart, qend, x_start, x_end,
+                 [&areaInfo](const size_t xi, const size_t yi,
+                             const ClippedPolygon &, const double area) {
+                   areaInfo.emplace_back(xi, yi, area);
+                 });
 }
 
 /**
@@ -533,40 +673,41 @@ void rebinToOutput(const Quadrilateral &inputQ,
 
   const auto &inY = inputWS->y(i);
   const auto &inE = inputWS->e(i);
-  // It seems to be more efficient to construct this once and clear it before
-  // each calculation in the loop
-  ConvexPolygon intersectOverlap;
-  for (size_t y = qstart; y < qend; ++y) {
-    const double vlo = verticalAxis[y];
-    const double vhi = verticalAxis[y + 1];
-    for (size_t xi = x_start; xi < x_end; ++xi) {
-      const V2D ll(X[xi], vlo);
-      const V2D lr(X[xi + 1], vlo);
-      const V2D ur(X[xi + 1], vhi);
-      const V2D ul(X[xi], vhi);
-      const Quadrilateral outputQ(ll, lr, ur, ul);
-
-      double yValue = inY[j];
-      if (std::isnan(yValue)) {
-        continue;
-      }
-      intersectOverlap.clear();
-      if (intersection(outputQ, inputQ, intersectOverlap)) {
-        const double weight = intersectOverlap.area() / inputQ.area();
-        yValue *= weight;
-        double eValue = inE[j];
-        if (inputWS->isDistribution()) {
-          const double overlapWidth =
-              intersectOverlap.maxX() - intersectOverlap.minX();
-          yValue *= overlapWidth;
-          eValue *= overlapWidth;
-        }
-        eValue = eValue * eValue * weight;
-        PARALLEL_CRITICAL(overlap_sum) {
-          outputWS.mutableY(y)[xi] += yValue;
-          outputWS.mutableE(y)[xi] += eValue;
-        }
-      }
+  const double signal = inY[j];
+  if (std::isnan(signal))
+    return;
+  const double error = inE[j];
+  const double inputQArea = inputQ.area();
+  const bool isDistribution = inputWS->isDistribution();
+
+  // The overlaps are collected per thread and added to the output in a single
+  // critical section, the buffer keeps its capacity between calls
+  thread_local std::vector<std::tuple<size_t, size_t, double, double>>
+      contributions;
+  contributions.clear();
+  forEachOverlap(X, verticalAxis, inputQ, qstart, qend, x_start, x_end,
+                 [&](const size_t xi, const size_t yi,
+                     const ClippedPolygon &overlap, const double area) {
+                   const double weight = area / inputQArea;
+                   double yValue = signal * weight;
+                   double eValue = error;
+                   if (isDistribution) {
+                     const double overlapWidth =
+                         overlap.maxX() - overlap.minX();
+                     yValue *= overlapWidth;
+                     eValue *= overlapWidth;
+                   }
+                   contributions.emplace_back(xi, yi, yValue,
+                                              eValue * eValue * weight);
+                 });
+  if (contributions.empty())
+    return;
+  PARALLEL_CRITICAL(overlap_sum) {
+    for (const auto &contribution : contributions) {
+      const size_t xi = std::get<0>(contribution);
+      const size_t yi = std::get<1>(contribution);
+      outputWS.mutableY(yi)[xi] += std::get<2>(contribution);
+      outputWS.mutableE(yi)[xi] += std::get<3>(contribution);
     }
   }
 }
@@ -625,7 +766,9 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
   // defined as rectangular. If the inputQ is is also rectangular or
   // trapezoidal, a simpler/faster way of calculating the intersection area
   // of all or some bins can be used.
-  std::vector<std::tuple<size_t, size_t, double>> areaInfo;
+  // Reused by each thread, to not allocate for every input quad
+  thread_local std::vector<std::tuple<size_t, size_t, double>> areaInfo;
+  areaInfo.clear();
   const double inputQArea = inputQ.area();
   const QuadrilateralType inputQType = getQuadrilateralType(inputQ);
   if (inputQType == QuadrilateralType::Rectangle) {
@@ -652,12 +795,14 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ,
     }
   }
 
+  if (areaInfo.empty())
+    return;
   const double variance = error * error;
-  for (const auto &ai : areaInfo) {
-    const size_t xi = std::get<0>(ai);
-    const size_t yi = std::get<1>(ai);
-    const double weight = std::get<2>(ai) / inputQArea;
-    PARALLEL_CRITICAL(overlap) {
+  PARALLEL_CRITICAL(overlap) {
+    for (const auto &ai : areaInfo) {
+      const size_t xi = std::get<0>(ai);
+      const size_t yi = std::get<1>(ai);
+      const double weight = std::get<2>(ai) / inputQArea;
       outputWS.mutableY(yi)[xi] += signal * weight;
       outputWS.mutableE(yi)[xi] += variance * weight;
       outputWS.dataF(yi)[xi] += weight * inputWeight;
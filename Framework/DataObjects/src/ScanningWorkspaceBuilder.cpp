@@ -200,8 +200,6 @@ MatrixWorkspace_sptr ScanningWorkspaceBuilder::buildWorkspace() const {
       m_instrument, m_nDetectors * m_nTimeIndexes, m_histogram);
 
   auto &outputDetectorInfo = outputWorkspace->mutableDetectorInfo();
-  outputDetectorInfo.setScanInterval(m_timeRanges[0]);
-
   buildOutputDetectorInfo(outputDetectorInfo);
 
   if (!m_positions.empty())
@@ -210,9 +208,6 @@ MatrixWorkspace_sptr ScanningWorkspaceBuilder::buildWorkspace() const {
   if (!m_rotations.empty())
     buildRotations(outputDetectorInfo);
 
-  if (!m_instrumentAngles.empty())
-    buildRelativeRotationsForScans(outputDetectorInfo);
-
   switch (m_indexingType) {
   case IndexingType::Default:
     outputWorkspace->setIndexInfo(
@@ -229,15 +224,37 @@ MatrixWorkspace_sptr ScanningWorkspaceBuilder::buildWorkspace() const {
   return boost::shared_ptr<MatrixWorkspace>(std::move(outputWorkspace));
 }
 
+/**
+ * Set up the time indexes of the output DetectorInfo. Relative rotations are
+ *stored as a single rigid transform of all non-monitor detectors per time index,
+ *rather than as a position and rotation for every detector and time index.
+ *
+ * @param outputDetectorInfo The DetectorInfo of the output workspace
+ */
 void ScanningWorkspaceBuilder::buildOutputDetectorInfo(
     Geometry::DetectorInfo &outputDetectorInfo) const {
-  auto mergeWorkspace =
-      create<Workspace2D>(m_instrument, m_nDetectors, m_histogram.binEdges());
-  for (size_t i = 1; i < m_nTimeIndexes; ++i) {
-    auto &mergeDetectorInfo = mergeWorkspace->mutableDetectorInfo();
-    mergeDetectorInfo.setScanInterval(m_timeRanges[i]);
-    outputDetectorInfo.merge(mergeDetectorInfo);
+  std::vector<std::vector<size_t>> banks;
+  std::vector<Kernel::Quat> rotations;
+  std::vector<Kernel::V3D> translations;
+  if (!m_instrumentAngles.empty()) {
+    banks.emplace_back();
+    for (size_t i = 0; i < outputDetectorInfo.size(); ++i)
+      if (!outputDetectorInfo.isMonitor(i))
+        banks.front().push_back(i);
+    rotations.reserve(m_nTimeIndexes);
+    translations.reserve(m_nTimeIndexes);
+    for (const auto angle : m_instrumentAngles) {
+      // Rotating around the rotation position is a rotation around the origin
+      // followed by a translation.
+      const auto rotation = Kernel::Quat(angle, m_rotationAxis);
+      auto rotatedPosition = m_rotationPosition;
+      rotation.rotate(rotatedPosition);
+      rotations.push_back(rotation);
+      translations.push_back(m_rotationPosition - rotatedPosition);
+    }
   }
+  outputDetectorInfo.setScanTransforms(m_timeRanges, banks, rotations,
+                                       translations);
 }
 
 void ScanningWorkspaceBuilder::buildRotations(
@@ -258,24 +275,6 @@ void ScanningWorkspaceBuilder::buildPositions(
   }
 }
 
-void ScanningWorkspaceBuilder::buildRelativeRotationsForScans(
-    Geometry::DetectorInfo &outputDetectorInfo) const {
-  for (size_t i = 0; i < outputDetectorInfo.size(); ++i) {
-    for (size_t j = 0; j < outputDetectorInfo.scanCount(i); ++j) {
-      if (outputDetectorInfo.isMonitor({i, j}))
-        continue;
-      auto position = outputDetectorInfo.position({i, j});
-      const auto rotation = Kernel::Quat(m_instrumentAngles[j], m_rotationAxis);
-      position -= m_rotationPosition;
-      rotation.rotate(position);
-      position += m_rotationPosition;
-      outputDetectorInfo.setPosition({i, j}, position);
-      const auto &oldRotation = outputDetectorInfo.rotation({i, j});
-      outputDetectorInfo.setRotation({i, j}, rotation * oldRotation);
-    }
-  }
-}
-
 void ScanningWorkspaceBuilder::createTimeOrientedIndexInfo(
     MatrixWorkspace &ws) const {
   auto indexInfo = ws.indexInfo();
@@ -261,6 +261,37 @@ public:
     TS_ASSERT_EQUALS(rel[5].tof(), 50);
   }
 
+  void test_PlusOperator_moving_takes_over_the_events() {
+    EventList target;
+    target.addDetectorID(1);
+    EventList source(el);
+    source.addDetectorID(2);
+    const auto data = source.getEvents().data();
+    target += std::move(source);
+    TS_ASSERT_EQUALS(target.getEvents().data(), data);
+    TS_ASSERT_EQUALS(target.getNumberEvents(), 3);
+    TS_ASSERT(target.hasDetectorID(1));
+    TS_ASSERT(target.hasDetectorID(2));
+    TS_ASSERT(source.empty());
+  }
+
+  void test_PlusOperator_moving_keeps_the_type_of_the_target() {
+    EventList target;
+    target.switchTo(WEIGHTED_NOTIME);
+    target += EventList(el);
+    TS_ASSERT_EQUALS(target.getEventType(), WEIGHTED_NOTIME);
+    TS_ASSERT_EQUALS(target.getNumberEvents(), 3);
+  }
+
+  void test_PlusOperator_moving_into_non_empty_list_appends() {
+    EventList source(el);
+    el += std::move(source);
+    const auto &events = el.getEvents();
+    TS_ASSERT_EQUALS(events.size(), 6);
+    TS_ASSERT_EQUALS(events[3].tof(), 100);
+    TS_ASSERT(source.empty());
+  }
+
   void test_DetectorIDs() {
     EventList el1;
     el1.addDetectorID(14);
@@ -835,6 +835,72 @@ public:
     // Placement-new to put ws back into valid state (avoid double-destruct)
     static_cast<void>(new (memory) EventList());
   }
+
+  void test_clone_shares_event_lists_until_modified() {
+    auto clone = ew->clone();
+    const EventWorkspace &original = *ew;
+    const EventWorkspace &copy = *clone;
+    TS_ASSERT_EQUALS(&original.getSpectrum(1), &copy.getSpectrum(1));
+
+    clone->getSpectrum(1) += TofEvent(0.5, 0);
+    // Only the modified spectrum is copied
+    TS_ASSERT_DIFFERS(&original.getSpectrum(1), &copy.getSpectrum(1));
+    TS_ASSERT_EQUALS(&original.getSpectrum(2), &copy.getSpectrum(2));
+    TS_ASSERT_EQUALS(original.getSpectrum(1).getNumberEvents(),
+                     2 * (NUMBINS - 1));
+    TS_ASSERT_EQUALS(copy.getSpectrum(1).getNumberEvents(),
+                     2 * (NUMBINS - 1) + 1);
+    TS_ASSERT_EQUALS(copy.getSpectrum(1).getSpectrumNo(), 1);
+    TS_ASSERT_EQUALS(copy.y(1)[0], original.y(1)[0] + 1.);
+
+    ew->getSpectrum(2).clear();
+    TS_ASSERT_EQUALS(original.getSpectrum(2).getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(copy.getSpectrum(2).getNumberEvents(),
+                     2 * (NUMBINS - 1));
+  }
+
+  void test_getSpectrum_after_clone_detaches_from_the_clone() {
+    auto &before = ew->getSpectrum(1);
+    auto clone = ew->clone();
+    const EventWorkspace &copy = *clone;
+    // The reference taken before cloning refers to the shared list
+    TS_ASSERT_EQUALS(&before, &copy.getSpectrum(1));
+
+    auto &after = ew->getSpectrum(1);
+    TS_ASSERT_DIFFERS(&after, &copy.getSpectrum(1));
+    after += TofEvent(0.5, 0);
+    TS_ASSERT_EQUALS(after.getNumberEvents(), 2 * (NUMBINS - 1) + 1);
+    TS_ASSERT_EQUALS(copy.getSpectrum(1).getNumberEvents(),
+                     2 * (NUMBINS - 1));
+  }
+
+  void test_clones_share_the_MRU() {
+    ew->clearMRU();
+    auto clone = ew->clone();
+    const EventWorkspace &original = *ew;
+    const EventWorkspace &copy = *clone;
+    TS_ASSERT_EQUALS(original.dataY(0).size(), NUMBINS - 1);
+    TS_ASSERT_EQUALS(copy.MRUSize(), 1);
+    clone->clearMRU();
+    TS_ASSERT_EQUALS(original.MRUSize(), 0);
+  }
+
+  void test_clone_can_outlive_original() {
+    auto clone = ew->clone();
+    const auto y = ew->y(3);
+    ew.reset();
+    TS_ASSERT_EQUALS(clone->y(3), y);
+    clone->getSpectrum(3).clear();
+    TS_ASSERT_EQUALS(clone->y(3)[0], 0.);
+  }
+
+  void test_setAllX_on_clone_does_not_change_original() {
+    auto clone = ew->clone();
+    clone->setAllX(BinEdges{0., 1e9});
+    TS_ASSERT_EQUALS(clone->blocksize(), 1);
+    TS_ASSERT_EQUALS(ew->blocksize(), NUMBINS - 1);
+    TS_ASSERT_EQUALS(clone->y(0)[0], 2. * (NUMBINS - 1));
+  }
 };
 
 #endif /* EVENTWORKSPACETEST_H_ */
@@ -0,0 +1,133 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAOBJECTS_FRACTIONALREBINNINGTEST_H_
+#define MANTID_DATAOBJECTS_FRACTIONALREBINNINGTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/FractionalRebinning.h"
+#include "MantidDataObjects/RebinnedOutput.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidHistogramData/LinearGenerator.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <boost/make_shared.hpp>
+
+using namespace Mantid::DataObjects;
+using Mantid::Geometry::Quadrilateral;
+using Mantid::HistogramData::BinEdges;
+using Mantid::HistogramData::LinearGenerator;
+using Mantid::Kernel::V2D;
+
+class FractionalRebinningTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FractionalRebinningTest *createSuite() {
+    return new FractionalRebinningTest();
+  }
+  static void destroySuite(FractionalRebinningTest *suite) { delete suite; }
+
+  void test_rebinToOutput_splits_a_diamond_over_four_bins() {
+    // Lower left, lower right, upper right and upper left are the left,
+    // bottom, right and top vertex
+    const Quadrilateral diamond(V2D(0., 1.), V2D(1., 0.), V2D(2., 1.),
+                                V2D(1., 2.));
+    auto outputWS = createOutput<Workspace2D>(2, 2, 1.);
+    FractionalRebinning::rebinToOutput(diamond, createInput(), 0, 0, *outputWS,
+                                       {0., 1., 2.});
+    for (size_t i = 0; i < 2; ++i) {
+      for (size_t j = 0; j < 2; ++j) {
+        TS_ASSERT_DELTA(outputWS->y(i)[j], 0.5, 1e-12);
+        // Variances
+        TS_ASSERT_DELTA(outputWS->e(i)[j], 0.5, 1e-12);
+      }
+    }
+  }
+
+  void test_rebinToOutput_ignores_the_part_outside_the_grid() {
+    const Quadrilateral diamond(V2D(-1., 1.), V2D(0., 0.), V2D(1., 1.),
+                                V2D(0., 2.));
+    auto outputWS = createOutput<Workspace2D>(2, 2, 1.);
+    FractionalRebinning::rebinToOutput(diamond, createInput(), 0, 0, *outputWS,
+                                       {0., 1., 2.});
+    TS_ASSERT_DELTA(outputWS->y(0)[0], 0.5, 1e-12);
+    TS_ASSERT_DELTA(outputWS->y(1)[0], 0.5, 1e-12);
+    TS_ASSERT_EQUALS(outputWS->y(0)[1], 0.);
+    TS_ASSERT_EQUALS(outputWS->y(1)[1], 0.);
+  }
+
+  void test_rebinToOutput_concave_quad_keeps_the_signal() {
+    // The lower right vertex is reflex, clipping a row or bin by an edge can
+    // add two vertices
+    const Quadrilateral chevron(V2D(0., 0.), V2D(2., 1.5), V2D(4., 0.),
+                                V2D(2., 4.));
+    TS_ASSERT_DELTA(chevron.area(), 5., 1e-12);
+    auto outputWS = createOutput<Workspace2D>(4, 4, 1.);
+    FractionalRebinning::rebinToOutput(chevron, createInput(), 0, 0,
+                                       *outputWS, {0., 1., 2., 3., 4.});
+    double signal(0.);
+    for (size_t i = 0; i < outputWS->getNumberHistograms(); ++i)
+      for (size_t j = 0; j < outputWS->blocksize(); ++j)
+        signal += outputWS->y(i)[j];
+    TS_ASSERT_DELTA(signal, 2., 1e-12);
+    // 5/6 of the bin lies inside, between the edges y = 0.75x and y = 2x
+    TS_ASSERT_DELTA(outputWS->y(1)[1], 2. * (5. / 6.) / 5., 1e-12);
+  }
+
+  void test_rebinToFractionalOutput_general_quad_keeps_the_signal() {
+    // Neither pair of opposite edges is parallel to an axis
+    const Quadrilateral quad(V2D(0.3, 0.4), V2D(2.9, 0.2), V2D(3.7, 3.1),
+                             V2D(0.1, 2.6));
+    auto outputWS = createOutput<RebinnedOutput>(8, 8, 0.5);
+    std::vector<double> verticalAxis(9);
+    for (size_t i = 0; i < verticalAxis.size(); ++i)
+      verticalAxis[i] = 0.5 * static_cast<double>(i);
+    FractionalRebinning::rebinToFractionalOutput(quad, createInput(), 0, 0,
+                                                 *outputWS, verticalAxis);
+    double signal(0.), variance(0.), fraction(0.);
+    size_t overlapping(0);
+    for (size_t i = 0; i < outputWS->getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < outputWS->blocksize(); ++j) {
+        signal += outputWS->y(i)[j];
+        variance += outputWS->e(i)[j];
+        fraction += outputWS->dataF(i)[j];
+        if (outputWS->dataF(i)[j] > 0.)
+          ++overlapping;
+      }
+    }
+    TS_ASSERT_DELTA(signal, 2., 1e-12);
+    TS_ASSERT_DELTA(variance, 2., 1e-12);
+    TS_ASSERT_DELTA(fraction, 1., 1e-12);
+    // Bins fully inside the quad get the fraction of their area
+    TS_ASSERT_DELTA(outputWS->dataF(2)[2], 0.25 / quad.area(), 1e-12);
+    // The quad misses 5 bins in each of the upper left and lower right
+    // corners of its bounding box of 8 x 7 bins
+    TS_ASSERT_EQUALS(overlapping, 8 * 7 - 10);
+    TS_ASSERT_EQUALS(outputWS->dataF(7)[0], 0.);
+  }
+
+private:
+  /// An input workspace with a signal of 2 and an error of sqrt(2)
+  Mantid::API::MatrixWorkspace_const_sptr createInput() {
+    return WorkspaceCreationHelper::create2DWorkspaceBinned(1, 1);
+  }
+
+  /// An output workspace initialised to zeros, with bins starting at 0
+  template <class T>
+  boost::shared_ptr<T> createOutput(const size_t nhist, const size_t nbins,
+                                    const double width) {
+    auto ws = boost::make_shared<T>();
+    ws->initialize(nhist, nbins + 1, nbins);
+    const BinEdges edges(nbins + 1, LinearGenerator(0., width));
+    for (size_t i = 0; i < nhist; ++i)
+      ws->setBinEdges(i, edges);
+    return ws;
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_FRACTIONALREBINNINGTEST_H_ */
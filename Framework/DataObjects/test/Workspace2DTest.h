@@ -62,6 +62,19 @@ public:
     ws.swap(cloned);
   }
 
+  void test_spectra_are_stored_contiguously() {
+    TS_ASSERT_EQUALS(&ws->getSpectrum(nhist - 1),
+                     &ws->getSpectrum(0) + (nhist - 1));
+  }
+
+  void test_clone_shares_data() {
+    auto cloned = ws->clone();
+    TS_ASSERT_EQUALS(&cloned->y(3), &ws->y(3));
+    cloned->mutableY(3)[0] = 42.0;
+    TS_ASSERT_DIFFERS(ws->y(3)[0], 42.0);
+    TS_ASSERT_EQUALS(&cloned->y(4), &ws->y(4));
+  }
+
   void testInit() {
     ws->setTitle("testInit");
     TS_ASSERT_EQUALS(ws->getNumberHistograms(), nhist);
@@ -299,6 +312,12 @@ public:
     }
   }
 
+  void test_create() {
+    WorkspaceCreationHelper::create2DWorkspaceBinned(nhist, 5);
+  }
+
+  void test_clone() { ws1->clone(); }
+
   void test_ISpectrum_getDetectorIDs() {
     CPUTimer tim;
     for (size_t i = 0; i < ws1->getNumberHistograms(); i++) {
@@ -50,6 +50,16 @@ private:
   boost::shared_ptr<std::vector<boost::shared_ptr<const Geometry::IObject>>>
       m_shapes;
 
+  struct DetectorShapeCache;
+  struct DetectorShapeTable;
+  /// Cached solid angles and path lengths of detectors, shared between copies
+  boost::shared_ptr<DetectorShapeCache> m_detectorShapeCache;
+  bool isValid(const DetectorShapeTable &table,
+               const Kernel::V3D &observer) const;
+  boost::shared_ptr<const DetectorShapeTable>
+  buildDetectorShapeTable(const Kernel::V3D &observer,
+                          const bool solidAngles) const;
+
   BoundingBox componentBoundingBox(const size_t index,
                                    const BoundingBox *reference) const;
 
@@ -132,6 +142,12 @@ public:
 
   double solidAngle(const size_t componentIndex,
                     const Kernel::V3D &observer) const;
+  boost::shared_ptr<const std::vector<double>>
+  detectorSolidAngles(const Kernel::V3D &observer) const;
+  double pathLength(const size_t componentIndex,
+                    const Kernel::V3D &observer) const;
+  boost::shared_ptr<const std::vector<double>>
+  detectorPathLengths(const Kernel::V3D &observer) const;
   BoundingBox boundingBox(const size_t componentIndex,
                           const BoundingBox *reference = nullptr) const;
   Beamline::ComponentType componentType(const size_t componentIndex) const;
@@ -112,6 +112,12 @@ public:
                                        Types::Core::DateAndTime> &interval);
   void setScanInterval(const std::pair<Types::Core::DateAndTime,
                                        Types::Core::DateAndTime> &interval);
+  void setScanTransforms(
+      const std::vector<std::pair<Types::Core::DateAndTime,
+                                  Types::Core::DateAndTime>> &intervals,
+      const std::vector<std::vector<size_t>> &banks,
+      const std::vector<Kernel::Quat> &rotations,
+      const std::vector<Kernel::V3D> &translations);
 
   void merge(const DetectorInfo &other);
 
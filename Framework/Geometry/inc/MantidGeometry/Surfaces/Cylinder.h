@@ -83,9 +83,9 @@ public:
                       double &ymin, double &zmin) override;
 
   /// The number of slices to approximate a cylinder
-  static int g_nslices;
+  static constexpr int g_nslices = 10;
   /// The number of stacks to approximate a cylinder
-  static int g_nstacks;
+  static constexpr int g_nstacks = 1;
 #ifdef ENABLE_OPENCASCADE
   TopoDS_Shape createShape() override;
 #endif
@@ -10,12 +10,19 @@
 #include "MantidGeometry/IComponent.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
 #include "MantidGeometry/Objects/IObject.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidGeometry/Rendering/ShapeInfo.h"
 #include "MantidKernel/EigenConversionHelpers.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/make_unique.h"
 #include <Eigen/Geometry>
+#include <boost/make_shared.hpp>
+#include <algorithm>
 #include <exception>
 #include <iterator>
+#include <limits>
+#include <mutex>
 #include <string>
 
 namespace Mantid {
@@ -47,8 +54,131 @@ const Kernel::V3D toShapeFrame(const Kernel::V3D &point,
                                     compInfo, componentIndex));
 }
 
+/**
+ * Clip the parameter range [tMin, tMax] of the line origin + t * direction to
+ * the part with lower <= point . normal <= upper.
+ * @return false if the clipped range is empty
+ */
+bool clipToSlab(const Kernel::V3D &origin, const Kernel::V3D &direction,
+                const Kernel::V3D &normal, const double lower,
+                const double upper, double &tMin, double &tMax) {
+  const double o = origin.scalar_prod(normal);
+  const double d = direction.scalar_prod(normal);
+  if (d == 0.0)
+    return o >= lower && o <= upper;
+  double t0 = (lower - o) / d;
+  double t1 = (upper - o) / d;
+  if (t0 > t1)
+    std::swap(t0, t1);
+  tMin = std::max(tMin, t0);
+  tMax = std::min(tMax, t1);
+  return tMin < tMax;
+}
+
+/**
+ * Clip the parameter range [tMin, tMax] of the line origin + t * direction to
+ * the part inside a cylinder.
+ * @param origin :: Origin of the line
+ * @param direction :: Direction of the line
+ * @param centre :: Centre of the base of the cylinder
+ * @param axis :: Unit vector along the cylinder axis
+ * @param radius :: Radius of the cylinder
+ * @param height :: Height of the cylinder
+ * @param tMin :: Lower end of the range, clipped on output
+ * @param tMax :: Upper end of the range, clipped on output
+ * @return false if the clipped range is empty
+ */
+bool clipToCylinder(const Kernel::V3D &origin, const Kernel::V3D &direction,
+                    const Kernel::V3D &centre, const Kernel::V3D &axis,
+                    const double radius, const double height, double &tMin,
+                    double &tMax) {
+  const Kernel::V3D w = origin - centre;
+  if (!clipToSlab(w, direction, axis, 0.0, height, tMin, tMax))
+    return false;
+  // Components perpendicular to the axis
+  const Kernel::V3D wPerp = w - axis * w.scalar_prod(axis);
+  const Kernel::V3D dPerp = direction - axis * direction.scalar_prod(axis);
+  const double a = dPerp.scalar_prod(dPerp);
+  const double c = wPerp.scalar_prod(wPerp) - radius * radius;
+  if (a == 0.0)
+    return c <= 0.0;
+  const double b = wPerp.scalar_prod(dPerp);
+  const double discriminant = b * b - a * c;
+  if (discriminant <= 0.0)
+    return false;
+  const double root = std::sqrt(discriminant);
+  tMin = std::max(tMin, (-b - root) / a);
+  tMax = std::min(tMax, (-b + root) / a);
+  return tMin < tMax;
+}
+
+/**
+ * Length of the path of a ray through a shape. Cylinders and cuboids are
+ * handled analytically, other shapes by tracking the ray through the object.
+ * @param shape :: The shape
+ * @param origin :: Start of the ray in the frame of the shape
+ * @param direction :: Direction of the ray in the frame of the shape, with
+ * scaling factored out. The path length is given in units of its length.
+ */
+double shapePathLength(const IObject &shape, const Kernel::V3D &origin,
+                       const Kernel::V3D &direction) {
+  detail::ShapeInfo::GeometryShape type;
+  std::vector<Kernel::V3D> vectors;
+  double radius(0.0), height(0.0);
+  shape.GetObjectGeom(type, vectors, radius, height);
+  double tMin = 0.0;
+  double tMax = std::numeric_limits<double>::max();
+  switch (type) {
+  case detail::ShapeInfo::GeometryShape::CYLINDER: {
+    auto axis = vectors[1];
+    axis.normalize();
+    if (!clipToCylinder(origin, direction, vectors[0], axis, radius, height,
+                        tMin, tMax))
+      return 0.0;
+    return tMax - tMin;
+  }
+  case detail::ShapeInfo::GeometryShape::CUBOID:
+    // Cuboid edges are orthogonal, so the cuboid is the intersection of three
+    // slabs.
+    for (size_t i = 1; i < 4; ++i) {
+      const auto edge = vectors[i] - vectors[0];
+      const double start = vectors[0].scalar_prod(edge);
+      if (!clipToSlab(origin, direction, edge, start,
+                      start + edge.scalar_prod(edge), tMin, tMax))
+        return 0.0;
+    }
+    return tMax - tMin;
+  default: {
+    const double norm = direction.norm();
+    Track track(origin, direction / norm);
+    shape.interceptSurface(track);
+    double length = 0.0;
+    for (const auto &link : track)
+      length += link.distInsideObject;
+    return length / norm;
+  }
+  }
+}
 } // namespace
 
+/// Per-detector values computed from the detector shapes, with the state of
+/// the beamline they were computed for.
+struct ComponentInfo::DetectorShapeTable {
+  const void *shapes;
+  size_t positionRevision;
+  size_t rotationRevision;
+  Kernel::V3D observer;
+  std::vector<Kernel::V3D> scaleFactors;
+  std::vector<double> values;
+};
+
+/// The most recent tables of detector solid angles and path lengths.
+struct ComponentInfo::DetectorShapeCache {
+  std::mutex mutex;
+  boost::shared_ptr<const DetectorShapeTable> solidAngles;
+  boost::shared_ptr<const DetectorShapeTable> pathLengths;
+};
+
 /**
  * Constructor.
  * @param componentInfo : Internal Beamline ComponentInfo
@@ -67,7 +197,8 @@ ComponentInfo::ComponentInfo(
     : m_componentInfo(std::move(componentInfo)),
       m_componentIds(std::move(componentIds)),
       m_compIDToIndex(std::move(componentIdToIndexMap)),
-      m_shapes(std::move(shapes)) {
+      m_shapes(std::move(shapes)),
+      m_detectorShapeCache(boost::make_shared<DetectorShapeCache>()) {
 
   if (m_componentIds->size() != m_compIDToIndex->size()) {
     throw std::invalid_argument("Inconsistent ID and Mapping input containers "
@@ -98,7 +229,8 @@ ComponentInfo::cloneWithoutDetectorInfo() const {
 ComponentInfo::ComponentInfo(const ComponentInfo &other)
     : m_componentInfo(other.m_componentInfo->cloneWithoutDetectorInfo()),
       m_componentIds(other.m_componentIds),
-      m_compIDToIndex(other.m_compIDToIndex), m_shapes(other.m_shapes) {}
+      m_compIDToIndex(other.m_compIDToIndex), m_shapes(other.m_shapes),
+      m_detectorShapeCache(other.m_detectorShapeCache) {}
 
 // Defined as default in source for forward declaration with std::unique_ptr.
 ComponentInfo::~ComponentInfo() = default;
@@ -278,6 +410,114 @@ double ComponentInfo::solidAngle(const size_t componentIndex,
   }
 }
 
+/**
+ * Returns the solid angle of all detectors as seen from the observer, see
+ * solidAngle(). Entries for detectors without a valid shape are NaN.
+ *
+ * The values are computed in parallel and cached. The cache is shared with
+ * copies of this object and is reused until the observer or the position,
+ * rotation or scale factor of any detector changes.
+ */
+boost::shared_ptr<const std::vector<double>>
+ComponentInfo::detectorSolidAngles(const Kernel::V3D &observer) const {
+  std::lock_guard<std::mutex> lock(m_detectorShapeCache->mutex);
+  auto &table = m_detectorShapeCache->solidAngles;
+  if (!table || !isValid(*table, observer))
+    table = buildDetectorShapeTable(observer, true);
+  return boost::shared_ptr<const std::vector<double>>(table, &table->values);
+}
+
+/**
+ * Returns the length of the straight path from the observer through the
+ * component position within the shape of the component. Throws if the
+ * component does not have a valid shape.
+ *
+ * For example, this is the path of a neutron scattered from the sample
+ * position through a detector tube. The path is computed analytically for
+ * cylinders and cuboids.
+ */
+double ComponentInfo::pathLength(const size_t componentIndex,
+                                 const Kernel::V3D &observer) const {
+  if (!hasValidShape(componentIndex))
+    throw Kernel::Exception::NullPointerException("ComponentInfo::pathLength",
+                                                  "shape");
+  const Kernel::V3D relativeObserver =
+      toShapeFrame(observer, *m_componentInfo, componentIndex);
+  const double distance = relativeObserver.norm();
+  if (distance == 0.0)
+    return 0.0;
+  // The path is computed in the frame of the unscaled shape, a unit of the
+  // line parameter corresponds to unit length in the scaled frame.
+  const Kernel::V3D scaleFactor = this->scaleFactor(componentIndex);
+  return shapePathLength(shape(componentIndex), relativeObserver / scaleFactor,
+                         relativeObserver / (-distance) / scaleFactor);
+}
+
+/**
+ * Returns the path length for all detectors, see pathLength(). Entries for
+ * detectors without a valid shape are NaN. Cached in the same way as
+ * detectorSolidAngles().
+ */
+boost::shared_ptr<const std::vector<double>>
+ComponentInfo::detectorPathLengths(const Kernel::V3D &observer) const {
+  std::lock_guard<std::mutex> lock(m_detectorShapeCache->mutex);
+  auto &table = m_detectorShapeCache->pathLengths;
+  if (!table || !isValid(*table, observer))
+    table = buildDetectorShapeTable(observer, false);
+  return boost::shared_ptr<const std::vector<double>>(table, &table->values);
+}
+
+/// Returns true if table was computed for the observer and the current
+/// detector shapes, positions, rotations, and scale factors.
+bool ComponentInfo::isValid(const DetectorShapeTable &table,
+                            const Kernel::V3D &observer) const {
+  if (table.shapes != m_shapes.get() || table.observer != observer ||
+      table.positionRevision != m_componentInfo->detectorPositionRevision() ||
+      table.rotationRevision != m_componentInfo->detectorRotationRevision())
+    return false;
+  for (size_t i = 0; i < table.scaleFactors.size(); ++i)
+    if (table.scaleFactors[i] != scaleFactor(i))
+      return false;
+  return true;
+}
+
+/// Computes the solid angle (or path length) of all detectors in parallel.
+boost::shared_ptr<const ComponentInfo::DetectorShapeTable>
+ComponentInfo::buildDetectorShapeTable(const Kernel::V3D &observer,
+                                       const bool solidAngles) const {
+  if (!m_componentInfo->hasDetectorInfo())
+    throw std::runtime_error("ComponentInfo: No detectors to compute the "
+                             "solid angle or path length of");
+  if (m_componentInfo->isScanning())
+    throw std::runtime_error("ComponentInfo: Solid angles and path lengths "
+                             "are not supported for scanning detectors");
+  auto table = boost::make_shared<DetectorShapeTable>();
+  table->shapes = m_shapes.get();
+  table->positionRevision = m_componentInfo->detectorPositionRevision();
+  table->rotationRevision = m_componentInfo->detectorRotationRevision();
+  table->observer = observer;
+  const auto count = m_componentInfo->numberOfDetectorsInSubtree(root());
+  table->scaleFactors.resize(count);
+  table->values.resize(count, std::numeric_limits<double>::quiet_NaN());
+
+  std::exception_ptr error;
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(count); ++i) {
+    try {
+      table->scaleFactors[i] = scaleFactor(i);
+      if (hasValidShape(i))
+        table->values[i] =
+            solidAngles ? solidAngle(i, observer) : pathLength(i, observer);
+    } catch (...) {
+      PARALLEL_CRITICAL(ComponentInfo_buildDetectorShapeTable)
+      error = std::current_exception();
+    }
+  }
+  if (error)
+    std::rethrow_exception(error);
+  return table;
+}
+
 /**
  * Grow the bounding box on the basis that the component described by index is a
  * regular grid in a trapezoid, thus the bounding box can be fully described by
@@ -368,6 +368,37 @@ void DetectorInfo::setScanInterval(
       {interval.first.totalNanoseconds(), interval.second.totalNanoseconds()});
 }
 
+/** Turns this into a synchronous scan where detectors move as rigid banks.
+ *
+ * Only one rotation and translation per bank and time index is stored, the
+ * rotation and translation for bank `b` at time index `t` are given by the
+ * element `t * banks.size() + b`. Detectors that are not part of any bank do
+ * not move. See Beamline::DetectorInfo::setScanTransforms() for details. */
+void DetectorInfo::setScanTransforms(
+    const std::vector<std::pair<Types::Core::DateAndTime,
+                                Types::Core::DateAndTime>> &intervals,
+    const std::vector<std::vector<size_t>> &banks,
+    const std::vector<Kernel::Quat> &rotations,
+    const std::vector<Kernel::V3D> &translations) {
+  std::vector<std::pair<int64_t, int64_t>> scanIntervals;
+  scanIntervals.reserve(intervals.size());
+  for (const auto &interval : intervals)
+    scanIntervals.emplace_back(interval.first.totalNanoseconds(),
+                               interval.second.totalNanoseconds());
+  std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>
+      eigenRotations;
+  eigenRotations.reserve(rotations.size());
+  for (const auto &rotation : rotations)
+    eigenRotations.emplace_back(Kernel::toQuaterniond(rotation));
+  std::vector<Eigen::Vector3d> eigenTranslations;
+  eigenTranslations.reserve(translations.size());
+  for (const auto &translation : translations)
+    eigenTranslations.emplace_back(Kernel::toVector3d(translation));
+  m_detectorInfo->setScanTransforms(scanIntervals, banks,
+                                    std::move(eigenRotations),
+                                    std::move(eigenTranslations));
+}
+
 /** Merges the contents of other into this.
  *
  * Scan intervals in both other and this must be set. Intervals must be
@@ -18,9 +18,11 @@
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Material.h"
 #include "MantidKernel/Matrix.h"
+#include "MantidKernel/MultiThreaded.h"
 #include <algorithm>
 #include <boost/make_shared.hpp>
 #include <boost/regex.hpp>
+#include <exception>
 #include <ostream>
 #include <stdexcept>
 
@@ -458,56 +460,71 @@ V3D GridDetector::getRelativePosAtXYZ(int x, int y, int z) const {
 
 void GridDetector::createLayer(const std::string &name, CompAssembly *parent,
                                int iz, int &minDetID, int &maxDetID) {
-  // Loop and create all detectors in this layer.
+  // The x-columns are independent of each other, so they are built in
+  // parallel without a parent and attached to it afterwards in order. This
+  // keeps the component tree (and hence the component indices) identical to a
+  // sequential build.
+  const std::string zSuffix =
+      m_zpixels > 0 ? "," + std::to_string(iz) + ")" : ")";
+  std::vector<CompAssembly *> columns(m_xpixels, nullptr);
+  std::vector<int> columnMinID(m_xpixels, minDetID);
+  std::vector<int> columnMaxID(m_xpixels, maxDetID);
+  std::vector<std::exception_ptr> errors(m_xpixels);
+
+  PARALLEL_FOR_NO_WSP_CHECK()
   for (int ix = 0; ix < m_xpixels; ++ix) {
-    // Create an ICompAssembly for each x-column
-    std::ostringstream oss_col;
-    if (m_zpixels > 0)
-      oss_col << name << "(z=" << iz << ","
-              << "x=" << ix << ")";
-    else
-      oss_col << name << "(x=" << ix << ")";
-
-    auto *xColumn = new CompAssembly(oss_col.str(), parent);
-
-    for (int iy = 0; iy < m_ypixels; ++iy) {
-      // Make the name
-      std::ostringstream oss;
-      if (m_zpixels > 0)
-        oss << name << "(" << ix << "," << iy << "," << iz << ")";
-      else
-        oss << name << "(" << ix << "," << iy << ")";
-
-      // Calculate its id and set it.
-      auto id = this->getDetectorIDAtXYZ(ix, iy, iz);
-
-      // minimum grid detector id
-      if (id < minDetID) {
-        minDetID = id;
+    try {
+      // Create an ICompAssembly for each x-column
+      const std::string xIndex = std::to_string(ix);
+      auto *xColumn = new CompAssembly(
+          m_zpixels > 0 ? name + "(z=" + std::to_string(iz) + ",x=" + xIndex +
+                              ")"
+                        : name + "(x=" + xIndex + ")",
+          nullptr);
+      columns[ix] = xColumn;
+      const std::string pixelPrefix = name + "(" + xIndex + ",";
+      const double x = m_xstart + ix * m_xstep;
+      const double z = m_zstart + iz * m_zstep;
+
+      for (int iy = 0; iy < m_ypixels; ++iy) {
+        // Calculate its id and set it.
+        auto id = this->getDetectorIDAtXYZ(ix, iy, iz);
+        columnMinID[ix] = std::min(columnMinID[ix], id);
+        columnMaxID[ix] = std::max(columnMaxID[ix], id);
+
+        // Create the detector from the given id & shape and with xColumn as
+        // the parent.
+        auto *detector = new GridDetectorPixel(
+            pixelPrefix + std::to_string(iy) + zSuffix, id, m_shape, xColumn,
+            this, size_t(ix), size_t(iy), size_t(iz));
+
+        // Translate (relative to parent). This gives the un-parametrized
+        // position.
+        detector->translate(V3D(x, m_ystart + iy * m_ystep, z));
+
+        // Add it to the x-column
+        xColumn->add(detector);
       }
-      // maximum grid detector id
-      if (id > maxDetID) {
-        maxDetID = id;
-      }
-      // Create the detector from the given id & shape and with xColumn as the
-      // parent.
-      auto *detector =
-          new GridDetectorPixel(oss.str(), id, m_shape, xColumn, this,
-                                size_t(ix), size_t(iy), size_t(iz));
-
-      // Calculate the x,y,z position
-      double x = m_xstart + ix * m_xstep;
-      double y = m_ystart + iy * m_ystep;
-      double z = m_zstart + iz * m_zstep;
-      V3D pos(x, y, z);
-      // Translate (relative to parent). This gives the un-parametrized
-      // position.
-      detector->translate(pos);
-
-      // Add it to the x-column
-      xColumn->add(detector);
+    } catch (...) {
+      errors[ix] = std::current_exception();
     }
   }
+
+  const auto error = std::find_if(errors.cbegin(), errors.cend(),
+                                  [](const std::exception_ptr &e) {
+                                    return static_cast<bool>(e);
+                                  });
+  if (error != errors.cend()) {
+    for (auto column : columns)
+      delete column;
+    std::rethrow_exception(*error);
+  }
+
+  for (int ix = 0; ix < m_xpixels; ++ix) {
+    parent->add(columns[ix]);
+    minDetID = std::min(minDetID, columnMinID[ix]);
+    maxDetID = std::max(maxDetID, columnMaxID[ix]);
+  }
 }
 
 bool checkValidOrderString(const std::string &order) {
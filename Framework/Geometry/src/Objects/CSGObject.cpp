@@ -814,6 +814,14 @@ int CSGObject::calcValidType(const Kernel::V3D &point,
  * shape.
  */
 double CSGObject::solidAngle(const Kernel::V3D &observer) const {
+  // Simple shapes are handled by triangleSolidAngle without the triangulation,
+  // so avoid triangulating them just to count the triangles.
+  if (m_handler && m_handler->hasShapeInfo() &&
+      m_handler->shapeInfo().shape() !=
+          detail::ShapeInfo::GeometryShape::NOSHAPE &&
+      m_handler->shapeInfo().shape() !=
+          detail::ShapeInfo::GeometryShape::HEXAHEDRON)
+    return triangleSolidAngle(observer);
   if (this->numberOfTriangles() > 30000)
     return rayTraceSolidAngle(observer);
   return triangleSolidAngle(observer);
@@ -1018,7 +1026,6 @@ double CSGObject::triangleSolidAngle(const V3D &observer) const {
   // Maximum of 4 vectors depending on the type
   geometry_vectors.reserve(4);
   this->GetObjectGeom(type, geometry_vectors, radius, height);
-  auto nTri = this->numberOfTriangles();
   // Cylinders are by far the most frequently used
   switch (type) {
   case detail::ShapeInfo::GeometryShape::CUBOID:
@@ -1036,6 +1043,7 @@ double CSGObject::triangleSolidAngle(const V3D &observer) const {
                           radius, height);
     break;
   default:
+    const auto nTri = this->numberOfTriangles();
     if (nTri == 0) // Fall back to raytracing if there are no triangles
     {
       return rayTraceSolidAngle(observer);
@@ -1182,62 +1190,30 @@ CSGObject::CuboidSolidAngle(const V3D observer,
   // ordering of points the "away facing" triangles give -ve contributions to
   // the
   // solid angle and hence are ignored.
-  std::vector<V3D> pts;
-  pts.reserve(8);
-  Kernel::V3D dx = vectors[1] - vectors[0];
-  Kernel::V3D dz = vectors[3] - vectors[0];
-  pts.push_back(vectors[2]);
-  pts.push_back(vectors[2] + dx);
-  pts.push_back(vectors[1]);
-  pts.push_back(vectors[0]);
-  pts.push_back(vectors[2] + dz);
-  pts.push_back(vectors[2] + dz + dx);
-  pts.push_back(vectors[1] + dz);
-  pts.push_back(vectors[0] + dz);
-
-  const unsigned int ntriangles(12);
-  std::vector<std::vector<int>> triMap(ntriangles, std::vector<int>(3, 0));
-  triMap[0][0] = 1;
-  triMap[0][1] = 4;
-  triMap[0][2] = 3;
-  triMap[1][0] = 3;
-  triMap[1][1] = 2;
-  triMap[1][2] = 1;
-  triMap[2][0] = 5;
-  triMap[2][1] = 6;
-  triMap[2][2] = 7;
-  triMap[3][0] = 7;
-  triMap[3][1] = 8;
-  triMap[3][2] = 5;
-  triMap[4][0] = 1;
-  triMap[4][1] = 2;
-  triMap[4][2] = 6;
-  triMap[5][0] = 6;
-  triMap[5][1] = 5;
-  triMap[5][2] = 1;
-  triMap[6][0] = 2;
-  triMap[6][1] = 3;
-  triMap[6][2] = 7;
-  triMap[7][0] = 7;
-  triMap[7][1] = 6;
-  triMap[7][2] = 2;
-  triMap[8][0] = 3;
-  triMap[8][1] = 4;
-  triMap[8][2] = 8;
-  triMap[9][0] = 8;
-  triMap[9][1] = 7;
-  triMap[9][2] = 3;
-  triMap[10][0] = 1;
-  triMap[10][1] = 5;
-  triMap[10][2] = 8;
-  triMap[11][0] = 8;
-  triMap[11][1] = 4;
-  triMap[11][2] = 1;
+  const Kernel::V3D dx = vectors[1] - vectors[0];
+  const Kernel::V3D dz = vectors[3] - vectors[0];
+  const std::array<V3D, 8> pts{{vectors[2], vectors[2] + dx, vectors[1],
+                                vectors[0], vectors[2] + dz,
+                                vectors[2] + dz + dx, vectors[1] + dz,
+                                vectors[0] + dz}};
+
+  static constexpr std::array<std::array<size_t, 3>, 12> triMap{
+      {{{0, 3, 2}},
+       {{2, 1, 0}},
+       {{4, 5, 6}},
+       {{6, 7, 4}},
+       {{0, 1, 5}},
+       {{5, 4, 0}},
+       {{1, 2, 6}},
+       {{6, 5, 1}},
+       {{2, 3, 7}},
+       {{7, 6, 2}},
+       {{0, 4, 7}},
+       {{7, 3, 0}}}};
   double sangle = 0.0;
-  for (unsigned int i = 0; i < ntriangles; i++) {
-    double sa =
-        getTriangleSolidAngle(pts[triMap[i][0] - 1], pts[triMap[i][1] - 1],
-                              pts[triMap[i][2] - 1], observer);
+  for (const auto &triangle : triMap) {
+    double sa = getTriangleSolidAngle(pts[triangle[0]], pts[triangle[1]],
+                                      pts[triangle[2]], observer);
     if (sa > 0)
       sangle += sa;
   }
@@ -1277,38 +1253,38 @@ double CSGObject::CylinderSolidAngle(const V3D &observer,
   Kernel::V3D final_axis = axis_direction;
   Kernel::Quat transform(initial_axis, final_axis);
 
-  // Do the base cap which is a point at the centre and nslices points around it
-  const int nslices(Mantid::Geometry::Cylinder::g_nslices);
+  constexpr int nslices(Mantid::Geometry::Cylinder::g_nslices);
   const double angle_step = 2 * M_PI / static_cast<double>(nslices);
 
-  const int nstacks(Mantid::Geometry::Cylinder::g_nstacks);
+  constexpr int nstacks(Mantid::Geometry::Cylinder::g_nstacks);
   const double z_step = height / nstacks;
-  double z0(0.0), z1(z_step);
+  // The points on the circle between two stacks are shared by both, so each
+  // circle is computed (and rotated) only once.
+  using Circle = std::array<V3D, nslices>;
+  auto makeCircle = [&](const double z, Circle &circle) {
+    for (int sl = 0; sl < nslices; ++sl) {
+      Kernel::V3D pt(radius * std::cos(angle_step * sl),
+                     radius * std::sin(angle_step * sl), z);
+      transform.rotate(pt);
+      pt += centre;
+      circle[sl] = pt;
+    }
+  };
+  Circle circle0, circle1;
+  double z1(z_step);
+  makeCircle(0.0, circle0);
   double solid_angle(0.0);
   for (int st = 1; st <= nstacks; ++st) {
     if (st == nstacks)
       z1 = height;
+    makeCircle(z1, circle1);
 
     for (int sl = 0; sl < nslices; ++sl) {
-      double x = radius * std::cos(angle_step * sl);
-      double y = radius * std::sin(angle_step * sl);
-      Kernel::V3D pt1 = Kernel::V3D(x, y, z0);
-      Kernel::V3D pt2 = Kernel::V3D(x, y, z1);
-      int vertex = (sl + 1) % nslices;
-      x = radius * std::cos(angle_step * vertex);
-      y = radius * std::sin(angle_step * vertex);
-      Kernel::V3D pt3 = Kernel::V3D(x, y, z0);
-      Kernel::V3D pt4 = Kernel::V3D(x, y, z1);
-      // Rotations
-      transform.rotate(pt1);
-      transform.rotate(pt3);
-      transform.rotate(pt2);
-      transform.rotate(pt4);
-
-      pt1 += centre;
-      pt2 += centre;
-      pt3 += centre;
-      pt4 += centre;
+      const int vertex = (sl + 1) % nslices;
+      const V3D &pt1 = circle0[sl];
+      const V3D &pt2 = circle1[sl];
+      const V3D &pt3 = circle0[vertex];
+      const V3D &pt4 = circle1[vertex];
 
       double sa = getTriangleSolidAngle(pt1, pt4, pt3, observer);
       if (sa > 0.0) {
@@ -1319,7 +1295,7 @@ double CSGObject::CylinderSolidAngle(const V3D &observer,
         solid_angle += sa;
       }
     }
-    z0 = z1;
+    std::swap(circle0, circle1);
     z1 += z_step;
   }
 
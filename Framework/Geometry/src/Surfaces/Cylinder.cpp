@@ -37,10 +37,10 @@ using Kernel::Tolerance;
 using Kernel::V3D;
 
 // The number of slices to use to approximate a cylinder
-int Cylinder::g_nslices = 10;
+constexpr int Cylinder::g_nslices;
 
 // The number of slices to use to approximate a cylinder
-int Cylinder::g_nstacks = 1;
+constexpr int Cylinder::g_nstacks;
 
 Cylinder::Cylinder()
     : Quadratic(), Centre(), Normal(1, 0, 0), Nvec(0), Radius(0.0)
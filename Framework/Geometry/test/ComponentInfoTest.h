@@ -11,6 +11,8 @@
 
 #include "MantidBeamline/ComponentInfo.h"
 #include "MantidGeometry/IComponent.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/Detector.h"
 #include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/Instrument/InstrumentVisitor.h"
@@ -122,6 +124,18 @@ std::unique_ptr<Beamline::ComponentInfo> makeSingleBeamlineComponentInfo(
       parentIndices, children, positions, rotations, scaleFactors,
       componentType, names, -1, -1);
 }
+
+// Make an instrument with a single detector at (0, 0, 5) with the given shape
+Instrument_sptr makeInstrumentWithDetectorShape(IObject_sptr shape) {
+  auto instrument = boost::make_shared<Instrument>();
+  ComponentCreationHelper::addSourceToInstrument(instrument, V3D(0, 0, -10));
+  ComponentCreationHelper::addSampleToInstrument(instrument, V3D(0, 0, 0));
+  auto det = new Detector("det", 1, shape, instrument.get());
+  det->setPos(V3D(0, 0, 5));
+  instrument->add(det);
+  instrument->markAsDetector(det);
+  return instrument;
+}
 } // namespace
 
 class ComponentInfoTest : public CxxTest::TestSuite {
@@ -297,6 +311,100 @@ public:
     TS_ASSERT_DELTA(info.solidAngle(0, V3D(10, 1.7, 0)), 1.840302, satol);
   }
 
+  void test_detectorSolidAngles() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentCylindrical(1);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &componentInfo = *std::get<0>(wrappers);
+    auto &detectorInfo = *std::get<1>(wrappers);
+    const V3D observer = componentInfo.samplePosition();
+
+    const auto solidAngles = componentInfo.detectorSolidAngles(observer);
+    TS_ASSERT_EQUALS(solidAngles->size(), detectorInfo.size());
+    for (size_t i = 0; i < detectorInfo.size(); ++i)
+      TS_ASSERT_EQUALS((*solidAngles)[i],
+                       componentInfo.solidAngle(i, observer));
+    // Cached
+    TS_ASSERT_EQUALS(componentInfo.detectorSolidAngles(observer), solidAngles);
+  }
+
+  void test_detectorSolidAngles_updated_with_geometry() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentCylindrical(1);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &componentInfo = *std::get<0>(wrappers);
+    auto &detectorInfo = *std::get<1>(wrappers);
+    const V3D observer = componentInfo.samplePosition();
+    const auto solidAngles = componentInfo.detectorSolidAngles(observer);
+
+    detectorInfo.setPosition(0, detectorInfo.position(0) * 2.0);
+    auto updated = componentInfo.detectorSolidAngles(observer);
+    TS_ASSERT_DELTA((*updated)[0], (*solidAngles)[0] / 4.0, 1e-3 * (*updated)[0]);
+    TS_ASSERT_EQUALS((*updated)[1], (*solidAngles)[1]);
+
+    detectorInfo.setRotation(1, Quat(90, V3D(1, 0, 0)));
+    updated = componentInfo.detectorSolidAngles(observer);
+    TS_ASSERT_EQUALS((*updated)[1], componentInfo.solidAngle(1, observer));
+    TS_ASSERT_DIFFERS((*updated)[1], (*solidAngles)[1]);
+
+    componentInfo.setScaleFactor(2, V3D(2, 1, 1));
+    updated = componentInfo.detectorSolidAngles(observer);
+    TS_ASSERT_EQUALS((*updated)[2], componentInfo.solidAngle(2, observer));
+    TS_ASSERT_DIFFERS((*updated)[2], (*solidAngles)[2]);
+
+    updated = componentInfo.detectorSolidAngles(V3D(0, 0, 1));
+    TS_ASSERT_EQUALS((*updated)[3], componentInfo.solidAngle(3, V3D(0, 0, 1)));
+  }
+
+  void test_pathLength_cylinder() {
+    const double radius = 0.004;
+    auto instrument = ComponentCreationHelper::createTestInstrumentCylindrical(
+        1, V3D(0, 0, -10), V3D(0, 0, 0), radius);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &componentInfo = *std::get<0>(wrappers);
+    const V3D observer = componentInfo.samplePosition();
+    // Central pixel, the path crosses the tube axis
+    TS_ASSERT_DELTA(componentInfo.pathLength(4, observer), 2 * radius, 1e-12);
+    const auto pathLengths = componentInfo.detectorPathLengths(observer);
+    TS_ASSERT_EQUALS(pathLengths->size(), 9);
+    for (size_t i = 0; i < pathLengths->size(); ++i)
+      TS_ASSERT_EQUALS((*pathLengths)[i], componentInfo.pathLength(i, observer));
+  }
+
+  void test_pathLength_cuboid() {
+    auto instrument = makeInstrumentWithDetectorShape(
+        ComponentCreationHelper::createCuboid(0.01, 0.02, 0.03));
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &componentInfo = *std::get<0>(wrappers);
+    auto &detectorInfo = *std::get<1>(wrappers);
+    const V3D observer = componentInfo.samplePosition();
+    TS_ASSERT_DELTA(componentInfo.pathLength(0, observer), 0.06, 1e-12);
+    TS_ASSERT_DELTA((*componentInfo.detectorPathLengths(observer))[0], 0.06,
+                    1e-12);
+    componentInfo.setScaleFactor(0, V3D(1, 1, 2));
+    TS_ASSERT_DELTA((*componentInfo.detectorPathLengths(observer))[0], 0.12,
+                    1e-12);
+    componentInfo.setScaleFactor(0, V3D(1, 1, 1));
+    detectorInfo.setRotation(0, Quat(90, V3D(0, 1, 0)));
+    TS_ASSERT_DELTA((*componentInfo.detectorPathLengths(observer))[0], 0.02,
+                    1e-12);
+    // Observer inside the detector
+    TS_ASSERT_DELTA(componentInfo.pathLength(0, V3D(0, 0, 5.005)), 0.015,
+                    1e-12);
+  }
+
+  void test_pathLength_generic_shape() {
+    const double radius = 0.01;
+    auto instrument = makeInstrumentWithDetectorShape(
+        ComponentCreationHelper::createSphere(radius));
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &componentInfo = *std::get<0>(wrappers);
+    TS_ASSERT_DELTA(componentInfo.pathLength(0, V3D(0, 0, 0)), 2 * radius,
+                    1e-9);
+    TS_ASSERT_DELTA(componentInfo.pathLength(0, V3D(0, 1, 5)), 2 * radius,
+                    1e-9);
+  }
+
   void test_boundingBox_single_component() {
 
     const double radius = 2;
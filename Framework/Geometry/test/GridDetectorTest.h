@@ -110,6 +110,38 @@ public:
     delete parDet;
   }
 
+  void testColumnsAreAttachedInOrder() {
+    auto cuboidShape = ComponentCreationHelper::createCuboid(0.5);
+
+    GridDetector det("MyGrid");
+    det.initialize(cuboidShape, 50, -25.0, 1.0, 4, -2.0, 1.0, 2, -1.0, 1.0,
+                   1000000, "xyz", 100, 1);
+
+    TS_ASSERT_EQUALS(det.nelements(), 2);
+    for (int iz = 0; iz < 2; ++iz) {
+      auto layer = boost::dynamic_pointer_cast<ICompAssembly>(det.getChild(iz));
+      TS_ASSERT_EQUALS(layer->nelements(), 50);
+      for (int ix = 0; ix < layer->nelements(); ++ix) {
+        auto column =
+            boost::dynamic_pointer_cast<ICompAssembly>(layer->getChild(ix));
+        TS_ASSERT_EQUALS(column->getName(), "MyGrid(z=" + std::to_string(iz) +
+                                                ",x=" + std::to_string(ix) +
+                                                ")");
+        TS_ASSERT_EQUALS(column->getParent()->getComponentID(),
+                         layer->getComponentID());
+        TS_ASSERT_EQUALS(column->nelements(), 4);
+        auto pixel = column->getChild(3);
+        TS_ASSERT_EQUALS(pixel->getName(), "MyGrid(" + std::to_string(ix) +
+                                               ",3," + std::to_string(iz) +
+                                               ")");
+        TS_ASSERT_EQUALS(pixel.get()->getParent()->getComponentID(),
+                         column->getComponentID());
+      }
+    }
+    TS_ASSERT_EQUALS(det.minDetectorID(), 1000000);
+    TS_ASSERT_EQUALS(det.maxDetectorID(), 1000000 + 49 + 3 * 100 + 4 * 100);
+  }
+
   /** Create a parametrized GridDetector with a parameter that
    * resizes it.
    */
@@ -8,9 +8,8 @@
 #define MANTID_HISTOGRAMDATA_ADDABLE_H_
 
 #include "MantidHistogramData/DllConfig.h"
+#include "MantidHistogramData/VectorArithmetic.h"
 
-#include <algorithm>
-#include <functional>
 #include <stdexcept>
 #include <type_traits>
 
@@ -33,8 +32,8 @@ public:
   T &operator+=(const T &other) & {
     auto &derived = static_cast<T &>(*this);
     checkLengths(derived, other);
-    std::transform(derived.cbegin(), derived.cend(), other.begin(),
-                   derived.begin(), std::plus<double>());
+    auto data = mutableDataPointer(derived);
+    VectorArithmetic::add(data, other.rawData().data(), data, derived.size());
     return derived;
   }
 
@@ -42,8 +41,9 @@ public:
   T &operator-=(const T &other) & {
     auto &derived = static_cast<T &>(*this);
     checkLengths(derived, other);
-    std::transform(derived.cbegin(), derived.cend(), other.begin(),
-                   derived.begin(), std::minus<double>());
+    auto data = mutableDataPointer(derived);
+    VectorArithmetic::subtract(data, other.rawData().data(), data,
+                               derived.size());
     return derived;
   }
 
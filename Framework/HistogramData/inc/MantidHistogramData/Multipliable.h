@@ -8,9 +8,8 @@
 #define MANTID_HISTOGRAMDATA_MULTIPLIABLE_H_
 
 #include "MantidHistogramData/DllConfig.h"
+#include "MantidHistogramData/VectorArithmetic.h"
 
-#include <algorithm>
-#include <functional>
 #include <stdexcept>
 #include <type_traits>
 
@@ -33,8 +32,9 @@ public:
   T &operator*=(const T &other) & {
     auto &derived = static_cast<T &>(*this);
     checkLengths(derived, other);
-    std::transform(derived.cbegin(), derived.cend(), other.begin(),
-                   derived.begin(), std::multiplies<double>());
+    auto data = mutableDataPointer(derived);
+    VectorArithmetic::multiply(data, other.rawData().data(), data,
+                               derived.size());
     return derived;
   }
 
@@ -42,8 +42,9 @@ public:
   T &operator/=(const T &other) & {
     auto &derived = static_cast<T &>(*this);
     checkLengths(derived, other);
-    std::transform(derived.cbegin(), derived.cend(), other.begin(),
-                   derived.begin(), std::divides<double>());
+    auto data = mutableDataPointer(derived);
+    VectorArithmetic::divide(data, other.rawData().data(), data,
+                             derived.size());
     return derived;
   }
 
@@ -7,14 +7,53 @@
 #ifndef MANTID_HISTOGRAMDATA_HISTOGRAMREBIN_H_
 #define MANTID_HISTOGRAMDATA_HISTOGRAMREBIN_H_
 
+#include "MantidHistogramData/BinEdges.h"
 #include "MantidHistogramData/DllConfig.h"
+
+#include <vector>
+
 namespace Mantid {
 namespace HistogramData {
 class Histogram;
-class BinEdges;
 
 MANTID_HISTOGRAMDATA_DLL Histogram rebin(const Histogram &input,
                                          const BinEdges &binEdges);
+
+/** RebinOperator : rebins histograms from one set of bin edges to another.
+
+  The overlaps of the input and output bins are computed once on construction,
+  after which any number of histograms with the same input bin edges can be
+  rebinned without searching for them again. The results are identical to
+  those of rebin(). The operator is immutable, so apply() may be called from
+  several threads.
+*/
+class MANTID_HISTOGRAMDATA_DLL RebinOperator {
+public:
+  RebinOperator(const BinEdges &input, const BinEdges &output);
+
+  Histogram apply(const Histogram &input) const;
+
+  /// The bin edges of the histograms the operator applies to
+  const BinEdges &inputBinEdges() const { return m_input; }
+  /// The bin edges of the rebinned histograms
+  const BinEdges &outputBinEdges() const { return m_output; }
+
+private:
+  /// A non-zero overlap of an input bin with an output bin
+  struct Overlap {
+    size_t input;
+    size_t output;
+    double delta;
+    double inputWidth;
+  };
+
+  Histogram applyToCounts(const Histogram &input) const;
+  Histogram applyToFrequencies(const Histogram &input) const;
+
+  BinEdges m_input;
+  BinEdges m_output;
+  std::vector<Overlap> m_overlaps;
+};
 } // namespace HistogramData
 } // namespace Mantid
 
@@ -8,8 +8,8 @@
 #define MANTID_HISTOGRAMDATA_SCALABLE_H_
 
 #include "MantidHistogramData/DllConfig.h"
+#include "MantidHistogramData/VectorArithmetic.h"
 
-#include <algorithm>
 #include <type_traits>
 
 namespace Mantid {
@@ -30,8 +30,8 @@ public:
   /// Scales each element in the container by the factor given by scale.
   T &operator*=(const double scale) & {
     auto &derived = static_cast<T &>(*this);
-    std::for_each(derived.begin(), derived.end(),
-                  [=](double &value) { value *= scale; });
+    auto data = mutableDataPointer(derived);
+    VectorArithmetic::scale(data, scale, data, derived.size());
     return derived;
   }
 
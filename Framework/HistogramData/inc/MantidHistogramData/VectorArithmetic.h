@@ -0,0 +1,86 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_HISTOGRAMDATA_VECTORARITHMETIC_H_
+#define MANTID_HISTOGRAMDATA_VECTORARITHMETIC_H_
+
+#include "MantidHistogramData/DllConfig.h"
+
+#include <cstddef>
+
+namespace Mantid {
+namespace HistogramData {
+
+/** VectorArithmetic : element-wise kernels on arrays of doubles.
+
+  These are the inner loops of histogram arithmetic, including the propagation
+  of uncertainties for uncorrelated values. Where the compiler supports it
+  they are built for several instruction sets and the best one for the CPU is
+  picked when the library is loaded, so the same binary uses AVX2 where
+  available. All instruction sets give identical results.
+
+  The output may be the same array as one of the inputs, but must not
+  partially overlap an input.
+*/
+namespace VectorArithmetic {
+
+/// out = a + b
+MANTID_HISTOGRAMDATA_DLL void add(const double *a, const double *b, double *out,
+                                  const size_t size);
+/// out = a - b
+MANTID_HISTOGRAMDATA_DLL void subtract(const double *a, const double *b,
+                                       double *out, const size_t size);
+/// out = a * b
+MANTID_HISTOGRAMDATA_DLL void multiply(const double *a, const double *b,
+                                       double *out, const size_t size);
+/// out = a / b
+MANTID_HISTOGRAMDATA_DLL void divide(const double *a, const double *b,
+                                     double *out, const size_t size);
+/// out = a * factor
+MANTID_HISTOGRAMDATA_DLL void scale(const double *a, const double factor,
+                                    double *out, const size_t size);
+
+/// Uncertainty of a sum or difference: out = sqrt(ea^2 + eb^2)
+MANTID_HISTOGRAMDATA_DLL void addErrors(const double *ea, const double *eb,
+                                        double *out, const size_t size);
+/// Uncertainty of a sum or difference with a constant eb
+MANTID_HISTOGRAMDATA_DLL void addErrors(const double *ea, const double eb,
+                                        double *out, const size_t size);
+
+/// y = ya * yb, e = sqrt((ea yb)^2 + (eb ya)^2)
+MANTID_HISTOGRAMDATA_DLL void
+multiplyWithErrors(const double *ya, const double *ea, const double *yb,
+                   const double *eb, double *y, double *e, const size_t size);
+/// Multiplication by a constant yb with uncertainty eb
+MANTID_HISTOGRAMDATA_DLL void
+multiplyWithErrors(const double *ya, const double *ea, const double yb,
+                   const double eb, double *y, double *e, const size_t size);
+
+/// y = ya / yb, e = sqrt(ea^2 + (ya eb / yb)^2) / |yb|
+MANTID_HISTOGRAMDATA_DLL void
+divideWithErrors(const double *ya, const double *ea, const double *yb,
+                 const double *eb, double *y, double *e, const size_t size);
+/// Division by a constant yb with uncertainty eb
+MANTID_HISTOGRAMDATA_DLL void
+divideWithErrors(const double *ya, const double *ea, const double yb,
+                 const double eb, double *y, double *e, const size_t size);
+
+/// Name of the instruction set the kernels run with on this CPU
+MANTID_HISTOGRAMDATA_DLL const char *instructionSet();
+
+} // namespace VectorArithmetic
+
+namespace detail {
+/// Pointer to the first element of one of the HistogramData vector types, for
+/// passing it to the VectorArithmetic kernels. Copy-on-write data is unshared.
+template <class T> double *mutableDataPointer(T &vector) {
+  return vector.empty() ? nullptr : &*vector.begin();
+}
+} // namespace detail
+} // namespace HistogramData
+} // namespace Mantid
+
+#endif /* MANTID_HISTOGRAMDATA_VECTORARITHMETIC_H_ */
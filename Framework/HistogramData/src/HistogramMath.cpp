@@ -6,8 +6,8 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidHistogramData/HistogramMath.h"
 #include "MantidHistogramData/Histogram.h"
+#include "MantidHistogramData/VectorArithmetic.h"
 
-#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
@@ -83,11 +83,9 @@ Histogram &operator+=(Histogram &histogram, const Histogram &other) {
   checkSameYMode(histogram, other);
   checkSameX(histogram, other);
   histogram.mutableY() += other.y();
-  std::transform(histogram.e().cbegin(), histogram.e().cend(),
-                 other.e().begin(), histogram.mutableE().begin(),
-                 [](const double &lhs, const double &rhs) -> double {
-                   return std::sqrt(lhs * lhs + rhs * rhs);
-                 });
+  auto e = detail::mutableDataPointer(histogram.mutableE());
+  VectorArithmetic::addErrors(e, other.e().rawData().data(), e,
+                              histogram.size());
   return histogram;
 }
 
@@ -98,11 +96,9 @@ Histogram &operator-=(Histogram &histogram, const Histogram &other) {
   checkSameYMode(histogram, other);
   checkSameX(histogram, other);
   histogram.mutableY() -= other.y();
-  std::transform(histogram.e().cbegin(), histogram.e().cend(),
-                 other.e().begin(), histogram.mutableE().begin(),
-                 [](const double &lhs, const double &rhs) -> double {
-                   return std::sqrt(lhs * lhs + rhs * rhs);
-                 });
+  auto e = detail::mutableDataPointer(histogram.mutableE());
+  VectorArithmetic::addErrors(e, other.e().rawData().data(), e,
+                              histogram.size());
   return histogram;
 }
 
@@ -117,13 +113,11 @@ Histogram &operator*=(Histogram &histogram, const Histogram &other) {
   checkSameXMode(histogram, other);
   checkSameX(histogram, other);
 
-  auto &y1 = histogram.mutableY();
-  auto &e1 = histogram.mutableE();
-  const auto &y2 = other.y();
-  const auto &e2 = other.e();
-  for (size_t i = 0; i < y1.size(); ++i)
-    e1[i] = sqrt(pow(e1[i] * y2[i], 2) + pow(e2[i] * y1[i], 2));
-  y1 *= y2;
+  auto y = detail::mutableDataPointer(histogram.mutableY());
+  auto e = detail::mutableDataPointer(histogram.mutableE());
+  VectorArithmetic::multiplyWithErrors(y, e, other.y().rawData().data(),
+                                       other.e().rawData().data(), y, e,
+                                       histogram.size());
   if (other.yMode() == Histogram::YMode::Counts)
     histogram.setYMode(Histogram::YMode::Counts);
   return histogram;
@@ -141,15 +135,11 @@ Histogram &operator/=(Histogram &histogram, const Histogram &other) {
   checkSameXMode(histogram, other);
   checkSameX(histogram, other);
 
-  auto &y1 = histogram.mutableY();
-  auto &e1 = histogram.mutableE();
-  const auto &y2 = other.y();
-  const auto &e2 = other.e();
-  for (size_t i = 0; i < y1.size(); ++i) {
-    auto inv_y2 = 1.0 / y2[i];
-    e1[i] = sqrt(pow(e1[i], 2) + pow(e2[i] * y1[i] * inv_y2, 2)) * fabs(inv_y2);
-    y1[i] *= inv_y2;
-  }
+  auto y = detail::mutableDataPointer(histogram.mutableY());
+  auto e = detail::mutableDataPointer(histogram.mutableE());
+  VectorArithmetic::divideWithErrors(y, e, other.y().rawData().data(),
+                                     other.e().rawData().data(), y, e,
+                                     histogram.size());
   if (histogram.yMode() == other.yMode())
     histogram.setYMode(Histogram::YMode::Frequencies);
   return histogram;
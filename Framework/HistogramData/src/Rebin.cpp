@@ -9,7 +9,10 @@
 #include "MantidHistogramData/Exception.h"
 #include "MantidHistogramData/Histogram.h"
 #include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include <numeric>
+#include <stdexcept>
 
 using Mantid::HistogramData::BinEdges;
 using Mantid::HistogramData::CountStandardDeviations;
@@ -19,21 +22,19 @@ using Mantid::HistogramData::Exception::InvalidBinEdgesError;
 using Mantid::HistogramData::Frequencies;
 using Mantid::HistogramData::FrequencyStandardDeviations;
 using Mantid::HistogramData::Histogram;
+using Mantid::HistogramData::HistogramE;
+using Mantid::HistogramData::HistogramY;
 
 namespace {
-Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
-  auto &xold = input.x();
-  auto &yold = input.y();
-  auto &eold = input.e();
-
-  auto &xnew = binEdges.rawData();
-  Counts newCounts(xnew.size() - 1);
-  CountVariances newCountVariances(xnew.size() - 1);
-  auto &ynew = newCounts.mutableData();
-  auto &enew = newCountVariances.mutableData();
-
-  auto size_yold = yold.size();
-  auto size_ynew = ynew.size();
+/** Calls f(iold, inew, delta, owidth) for each overlap of an old bin iold with
+ * a new bin inew, delta being the width of the overlap and owidth the width of
+ * the old bin, in order of increasing x.
+ */
+template <class F>
+void forEachOverlap(const std::vector<double> &xold,
+                    const std::vector<double> &xnew, F f) {
+  auto size_yold = xold.size() - 1;
+  auto size_ynew = xnew.size() - 1;
   size_t iold = 0;
   size_t inew = 0;
 
@@ -66,8 +67,7 @@ Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
       auto delta = xo_high < xn_high ? xo_high : xn_high;
       delta -= xo_low > xn_low ? xo_low : xn_low;
 
-      ynew[inew] += yold[iold] * delta / owidth;
-      enew[inew] += eold[iold] * eold[iold] * delta / owidth;
+      f(iold, inew, delta, owidth);
 
       if (xn_high > xo_high) {
         iold++;
@@ -76,13 +76,41 @@ Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
       }
     }
   }
+}
+
+Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
+  auto &yold = input.y();
+  auto &eold = input.e();
+
+  auto &xnew = binEdges.rawData();
+  Counts newCounts(xnew.size() - 1);
+  CountVariances newCountVariances(xnew.size() - 1);
+  auto &ynew = newCounts.mutableData();
+  auto &enew = newCountVariances.mutableData();
+
+  forEachOverlap(input.x().rawData(), xnew,
+                 [&](const size_t iold, const size_t inew, const double delta,
+                     const double owidth) {
+                   ynew[inew] += yold[iold] * delta / owidth;
+                   enew[inew] += eold[iold] * eold[iold] * delta / owidth;
+                 });
 
   return Histogram(binEdges, newCounts,
                    CountStandardDeviations(std::move(newCountVariances)));
 }
 
+/// Converts the accumulated frequencies and variances weighted by the widths.
+void normaliseFrequencies(const std::vector<double> &xnew, HistogramY &ynew,
+                          HistogramE &enew) {
+  for (size_t i = 0; i < ynew.size(); ++i) {
+    auto width = xnew[i + 1] - xnew[i];
+    auto factor = 1 / width;
+    ynew[i] *= factor;
+    enew[i] = sqrt(enew[i]) * factor;
+  }
+}
+
 Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
-  auto &xold = input.x();
   auto &yold = input.y();
   auto &eold = input.e();
 
@@ -92,49 +120,13 @@ Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
   auto &ynew = newFrequencies.mutableData();
   auto &enew = newFrequencyStdDev.mutableData();
 
-  auto size_yold = yold.size();
-  auto size_ynew = ynew.size();
-  size_t iold = 0;
-  size_t inew = 0;
-
-  while ((inew < size_ynew) && (iold < size_yold)) {
-    auto xo_low = xold[iold];
-    auto xo_high = xold[iold + 1];
-    auto xn_low = xnew[inew];
-    auto xn_high = xnew[inew + 1];
-
-    auto owidth = xo_high - xo_low;
-    auto nwidth = xn_high - xn_low;
-
-    if (owidth <= 0.0 || nwidth <= 0.0)
-      throw InvalidBinEdgesError("Negative or zero bin widths not allowed.");
-
-    if (xn_high <= xo_low)
-      inew++; /* old and new bins do not overlap */
-    else if (xo_high <= xn_low)
-      iold++; /* old and new bins do not overlap */
-    else {
-      //        delta is the overlap of the bins on the x axis
-      auto delta = xo_high < xn_high ? xo_high : xn_high;
-      delta -= xo_low > xn_low ? xo_low : xn_low;
-
-      ynew[inew] += yold[iold] * delta;
-      enew[inew] += eold[iold] * eold[iold] * delta * owidth;
-
-      if (xn_high > xo_high) {
-        iold++;
-      } else {
-        inew++;
-      }
-    }
-  }
-
-  for (size_t i = 0; i < size_ynew; ++i) {
-    auto width = xnew[i + 1] - xnew[i];
-    auto factor = 1 / width;
-    ynew[i] *= factor;
-    enew[i] = sqrt(enew[i]) * factor;
-  }
+  forEachOverlap(input.x().rawData(), xnew,
+                 [&](const size_t iold, const size_t inew, const double delta,
+                     const double owidth) {
+                   ynew[inew] += yold[iold] * delta;
+                   enew[inew] += eold[iold] * eold[iold] * delta * owidth;
+                 });
+  normaliseFrequencies(xnew, ynew, enew);
 
   return Histogram(binEdges, newFrequencies, newFrequencyStdDev);
 }
@@ -162,5 +154,76 @@ Histogram rebin(const Histogram &input, const BinEdges &binEdges) {
     throw std::runtime_error("YMode must be defined for input histogram.");
 }
 
+/** Computes the overlaps of the input and output bins.
+ * @param input :: the bin edges of the histograms to rebin
+ * @param output :: the bin edges to rebin to
+ * @throws InvalidBinEdgesError for non-positive input/output bin widths
+ */
+RebinOperator::RebinOperator(const BinEdges &input, const BinEdges &output)
+    : m_input(input), m_output(output) {
+  forEachOverlap(m_input.rawData(), m_output.rawData(),
+                 [this](const size_t iold, const size_t inew,
+                        const double delta, const double owidth) {
+                   m_overlaps.push_back({iold, inew, delta, owidth});
+                 });
+}
+
+/** Rebins a histogram, giving the same result as rebin().
+ * @param input :: a histogram with the input bin edges of this operator
+ * @returns The rebinned histogram, sharing the output bin edges.
+ * @throws std::invalid_argument if the input has other bin edges
+ * @throws std::runtime_error if the input yMode is undefined
+ */
+Histogram RebinOperator::apply(const Histogram &input) const {
+  if (input.xMode() != Histogram::XMode::BinEdges)
+    throw std::runtime_error(
+        "XMode must be Histogram::XMode::BinEdges for input histogram");
+  // Comparing the address first makes this cheap for shared data
+  if (!(input.sharedX() == m_input.cowData()) &&
+      input.x().rawData() != m_input.rawData())
+    throw std::invalid_argument(
+        "RebinOperator: the histogram does not have the input bin edges");
+  if (input.yMode() == Histogram::YMode::Counts)
+    return applyToCounts(input);
+  else if (input.yMode() == Histogram::YMode::Frequencies)
+    return applyToFrequencies(input);
+  else
+    throw std::runtime_error("YMode must be defined for input histogram.");
+}
+
+Histogram RebinOperator::applyToCounts(const Histogram &input) const {
+  const auto &yold = input.y();
+  const auto &eold = input.e();
+  Counts newCounts(m_output.size() - 1);
+  CountVariances newCountVariances(m_output.size() - 1);
+  auto &ynew = newCounts.mutableData();
+  auto &enew = newCountVariances.mutableData();
+  for (const auto &overlap : m_overlaps) {
+    const auto iold = overlap.input;
+    const auto inew = overlap.output;
+    ynew[inew] += yold[iold] * overlap.delta / overlap.inputWidth;
+    enew[inew] += eold[iold] * eold[iold] * overlap.delta / overlap.inputWidth;
+  }
+  return Histogram(m_output, newCounts,
+                   CountStandardDeviations(std::move(newCountVariances)));
+}
+
+Histogram RebinOperator::applyToFrequencies(const Histogram &input) const {
+  const auto &yold = input.y();
+  const auto &eold = input.e();
+  Frequencies newFrequencies(m_output.size() - 1);
+  FrequencyStandardDeviations newFrequencyStdDev(m_output.size() - 1);
+  auto &ynew = newFrequencies.mutableData();
+  auto &enew = newFrequencyStdDev.mutableData();
+  for (const auto &overlap : m_overlaps) {
+    const auto iold = overlap.input;
+    const auto inew = overlap.output;
+    ynew[inew] += yold[iold] * overlap.delta;
+    enew[inew] += eold[iold] * eold[iold] * overlap.delta * overlap.inputWidth;
+  }
+  normaliseFrequencies(m_output.rawData(), ynew, enew);
+  return Histogram(m_output, newFrequencies, newFrequencyStdDev);
+}
+
 } // namespace HistogramData
 } // namespace Mantid
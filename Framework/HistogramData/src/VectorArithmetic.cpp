@@ -0,0 +1,135 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidHistogramData/VectorArithmetic.h"
+
+#include <cmath>
+
+// Build every kernel for AVX2 and for the baseline instruction set, the
+// dynamic loader picks the version matching the CPU. This needs ifunc support,
+// i.e., an ELF target. FMA is deliberately not enabled since contracting
+// a * b + c changes the rounding and results would depend on the machine.
+#if defined(__x86_64__) && defined(__ELF__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define MULTIVERSIONED __attribute__((target_clones("avx2", "default")))
+#define HAS_MULTIVERSIONING
+#endif
+#endif
+#ifndef MULTIVERSIONED
+#define MULTIVERSIONED
+#endif
+
+namespace Mantid {
+namespace HistogramData {
+namespace VectorArithmetic {
+
+MULTIVERSIONED void add(const double *a, const double *b, double *out,
+                        const size_t size) {
+  for (size_t i = 0; i < size; ++i)
+    out[i] = a[i] + b[i];
+}
+
+MULTIVERSIONED void subtract(const double *a, const double *b, double *out,
+                             const size_t size) {
+  for (size_t i = 0; i < size; ++i)
+    out[i] = a[i] - b[i];
+}
+
+MULTIVERSIONED void multiply(const double *a, const double *b, double *out,
+                             const size_t size) {
+  for (size_t i = 0; i < size; ++i)
+    out[i] = a[i] * b[i];
+}
+
+MULTIVERSIONED void divide(const double *a, const double *b, double *out,
+                           const size_t size) {
+  for (size_t i = 0; i < size; ++i)
+    out[i] = a[i] / b[i];
+}
+
+MULTIVERSIONED void scale(const double *a, const double factor, double *out,
+                          const size_t size) {
+  for (size_t i = 0; i < size; ++i)
+    out[i] = a[i] * factor;
+}
+
+MULTIVERSIONED void addErrors(const double *ea, const double *eb, double *out,
+                              const size_t size) {
+  for (size_t i = 0; i < size; ++i)
+    out[i] = std::sqrt(ea[i] * ea[i] + eb[i] * eb[i]);
+}
+
+MULTIVERSIONED void addErrors(const double *ea, const double eb, double *out,
+                              const size_t size) {
+  const double variance = eb * eb;
+  for (size_t i = 0; i < size; ++i)
+    out[i] = std::sqrt(ea[i] * ea[i] + variance);
+}
+
+MULTIVERSIONED void multiplyWithErrors(const double *ya, const double *ea,
+                                       const double *yb, const double *eb,
+                                       double *y, double *e,
+                                       const size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    const double a = ya[i];
+    const double b = yb[i];
+    const double sa = ea[i] * b;
+    const double sb = eb[i] * a;
+    // Write y last, it may be the same array as one of the inputs
+    e[i] = std::sqrt(sa * sa + sb * sb);
+    y[i] = a * b;
+  }
+}
+
+MULTIVERSIONED void multiplyWithErrors(const double *ya, const double *ea,
+                                       const double yb, const double eb,
+                                       double *y, double *e,
+                                       const size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    const double a = ya[i];
+    const double sa = ea[i] * yb;
+    const double sb = eb * a;
+    e[i] = std::sqrt(sa * sa + sb * sb);
+    y[i] = a * yb;
+  }
+}
+
+MULTIVERSIONED void divideWithErrors(const double *ya, const double *ea,
+                                     const double *yb, const double *eb,
+                                     double *y, double *e, const size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    const double a = ya[i];
+    const double b = yb[i];
+    // Arranged such that a == 0 does not give infinities
+    const double sb = a * eb[i] / b;
+    e[i] = std::sqrt(ea[i] * ea[i] + sb * sb) / std::abs(b);
+    y[i] = a / b;
+  }
+}
+
+MULTIVERSIONED void divideWithErrors(const double *ya, const double *ea,
+                                     const double yb, const double eb,
+                                     double *y, double *e, const size_t size) {
+  const double relativeVariance = (eb / yb) * (eb / yb);
+  const double absYb = std::abs(yb);
+  for (size_t i = 0; i < size; ++i) {
+    const double a = ya[i];
+    e[i] = std::sqrt(ea[i] * ea[i] + a * a * relativeVariance) / absYb;
+    y[i] = a / yb;
+  }
+}
+
+const char *instructionSet() {
+#ifdef HAS_MULTIVERSIONING
+  if (__builtin_cpu_supports("avx2"))
+    return "avx2";
+#endif
+  return "default";
+}
+
+} // namespace VectorArithmetic
+} // namespace HistogramData
+} // namespace Mantid
@@ -386,6 +386,46 @@ public:
     TS_ASSERT_EQUALS(outFreq.e()[2], 0);
   }
 
+  void testRebinOperatorMatchesRebin() {
+    const BinEdges edges{0.5, 1.7, 2.2, 4.9, 5., 8.3, 12.};
+    for (const auto &hist : {getCountsHistogram(), getFrequencyHistogram()}) {
+      const RebinOperator rebinOperator(hist.binEdges(), edges);
+      const auto expected = rebin(hist, edges);
+      const auto out = rebinOperator.apply(hist);
+      TS_ASSERT_EQUALS(out.yMode(), hist.yMode());
+      TS_ASSERT_EQUALS(out.x(), expected.x());
+      TS_ASSERT_EQUALS(out.y(), expected.y());
+      TS_ASSERT_EQUALS(out.e(), expected.e());
+      // The output shares the bin edges of the operator
+      TS_ASSERT_EQUALS(out.sharedX(), rebinOperator.outputBinEdges().cowData());
+    }
+  }
+
+  void testRebinOperatorAcceptsEqualBinEdges() {
+    const auto hist = getCountsHistogram();
+    const RebinOperator rebinOperator(BinEdges(10, LinearGenerator(0, 1)),
+                                      BinEdges(5, LinearGenerator(0, 2)));
+    TS_ASSERT_EQUALS(rebinOperator.apply(hist).y(),
+                     rebin(hist, BinEdges(5, LinearGenerator(0, 2))).y());
+  }
+
+  void testRebinOperatorThrowsForOtherBinEdges() {
+    const RebinOperator rebinOperator(BinEdges(10, LinearGenerator(0, 0.5)),
+                                      BinEdges(5, LinearGenerator(0, 2)));
+    TS_ASSERT_THROWS(rebinOperator.apply(getCountsHistogram()),
+                     std::invalid_argument);
+    TS_ASSERT_THROWS(
+        rebinOperator.apply(Histogram(BinEdges(10, LinearGenerator(0, 0.5)))),
+        std::runtime_error);
+  }
+
+  void testRebinOperatorFailsForInvalidBinEdges() {
+    std::vector<double> binEdges{1, 2, 3, 3, 5, 7};
+    BinEdges edges(binEdges);
+    TS_ASSERT_THROWS(RebinOperator(edges, BinEdges(5, LinearGenerator(0, 2))),
+                     InvalidBinEdgesError);
+  }
+
 private:
   Histogram getCountsHistogram() {
     return Histogram(BinEdges(10, LinearGenerator(0, 1)),
@@ -441,6 +481,18 @@ public:
       rebin(histFreq, lgBins);
   }
 
+  void testRebinOperatorCountsSmallerBins() {
+    const RebinOperator rebinOperator(hist.binEdges(), smBins);
+    for (size_t i = 0; i < nIters; i++)
+      rebinOperator.apply(hist);
+  }
+
+  void testRebinOperatorFrequenciesLargerBins() {
+    const RebinOperator rebinOperator(histFreq.binEdges(), lgBins);
+    for (size_t i = 0; i < nIters; i++)
+      rebinOperator.apply(histFreq);
+  }
+
 private:
   const size_t binSize = 10000;
   const size_t nIters = 10000;
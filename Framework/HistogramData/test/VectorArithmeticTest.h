@@ -0,0 +1,189 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_HISTOGRAMDATA_VECTORARITHMETICTEST_H_
+#define MANTID_HISTOGRAMDATA_VECTORARITHMETICTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidHistogramData/VectorArithmetic.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace Mantid::HistogramData;
+
+class VectorArithmeticTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static VectorArithmeticTest *createSuite() {
+    return new VectorArithmeticTest();
+  }
+  static void destroySuite(VectorArithmeticTest *suite) { delete suite; }
+
+  void test_instruction_set() {
+    const std::string set = VectorArithmetic::instructionSet();
+    TS_ASSERT(set == "avx2" || set == "default");
+  }
+
+  void test_element_wise_operations() {
+    // Odd length to cover the remainder of vectorised loops
+    const std::vector<double> a{1, 2, 3, 4, 5, 6, 7};
+    const std::vector<double> b{2, 2, 2, 2, 2, 2, 0.5};
+    std::vector<double> out(a.size());
+    VectorArithmetic::add(a.data(), b.data(), out.data(), a.size());
+    TS_ASSERT_EQUALS(out, std::vector<double>({3, 4, 5, 6, 7, 8, 7.5}));
+    VectorArithmetic::subtract(a.data(), b.data(), out.data(), a.size());
+    TS_ASSERT_EQUALS(out, std::vector<double>({-1, 0, 1, 2, 3, 4, 6.5}));
+    VectorArithmetic::multiply(a.data(), b.data(), out.data(), a.size());
+    TS_ASSERT_EQUALS(out, std::vector<double>({2, 4, 6, 8, 10, 12, 3.5}));
+    VectorArithmetic::divide(a.data(), b.data(), out.data(), a.size());
+    TS_ASSERT_EQUALS(out, std::vector<double>({0.5, 1, 1.5, 2, 2.5, 3, 14}));
+    VectorArithmetic::scale(a.data(), 3.0, out.data(), a.size());
+    TS_ASSERT_EQUALS(out, std::vector<double>({3, 6, 9, 12, 15, 18, 21}));
+  }
+
+  void test_in_place() {
+    std::vector<double> a{1, 2, 3};
+    VectorArithmetic::add(a.data(), a.data(), a.data(), a.size());
+    TS_ASSERT_EQUALS(a, std::vector<double>({2, 4, 6}));
+  }
+
+  void test_empty() {
+    TS_ASSERT_THROWS_NOTHING(
+        VectorArithmetic::add(nullptr, nullptr, nullptr, 0));
+  }
+
+  void test_addErrors() {
+    const std::vector<double> ea{3, 5};
+    const std::vector<double> eb{4, 12};
+    std::vector<double> out(2);
+    VectorArithmetic::addErrors(ea.data(), eb.data(), out.data(), 2);
+    TS_ASSERT_EQUALS(out, std::vector<double>({5, 13}));
+    VectorArithmetic::addErrors(ea.data(), 4.0, out.data(), 2);
+    TS_ASSERT_EQUALS(out[0], 5.0);
+    TS_ASSERT_DELTA(out[1], std::sqrt(41.0), 1e-14);
+  }
+
+  void test_multiplyWithErrors() {
+    std::vector<double> ya{2, 0};
+    std::vector<double> ea{0.5, 1};
+    const std::vector<double> yb{4, 3};
+    const std::vector<double> eb{1, 2};
+    // In place, as used by the Multiply algorithm
+    VectorArithmetic::multiplyWithErrors(ya.data(), ea.data(), yb.data(),
+                                         eb.data(), ya.data(), ea.data(), 2);
+    TS_ASSERT_EQUALS(ya, std::vector<double>({8, 0}));
+    TS_ASSERT_DELTA(ea[0], std::sqrt(2.0 * 2.0 + 2.0 * 2.0), 1e-14);
+    TS_ASSERT_DELTA(ea[1], 3.0, 1e-14);
+  }
+
+  void test_multiplyWithErrors_scalar() {
+    const std::vector<double> ya{2, 3};
+    const std::vector<double> ea{1, 0};
+    std::vector<double> y(2);
+    std::vector<double> e(2);
+    VectorArithmetic::multiplyWithErrors(ya.data(), ea.data(), 4.0, 0.5,
+                                         y.data(), e.data(), 2);
+    TS_ASSERT_EQUALS(y, std::vector<double>({8, 12}));
+    TS_ASSERT_DELTA(e[0], std::sqrt(16.0 + 1.0), 1e-14);
+    TS_ASSERT_DELTA(e[1], 1.5, 1e-14);
+  }
+
+  void test_divideWithErrors() {
+    const std::vector<double> ya{4, 0};
+    const std::vector<double> ea{2, 1};
+    const std::vector<double> yb{2, 2};
+    const std::vector<double> eb{1, 1};
+    std::vector<double> y(2);
+    std::vector<double> e(2);
+    VectorArithmetic::divideWithErrors(ya.data(), ea.data(), yb.data(),
+                                       eb.data(), y.data(), e.data(), 2);
+    TS_ASSERT_EQUALS(y, std::vector<double>({2, 0}));
+    TS_ASSERT_DELTA(e[0], std::sqrt(4.0 + 4.0) / 2.0, 1e-14);
+    // No infinity for a zero numerator
+    TS_ASSERT_DELTA(e[1], 0.5, 1e-14);
+  }
+
+  void test_divideWithErrors_scalar() {
+    const std::vector<double> ya{4, 0};
+    const std::vector<double> ea{2, 1};
+    std::vector<double> y(2);
+    std::vector<double> e(2);
+    VectorArithmetic::divideWithErrors(ya.data(), ea.data(), -2.0, 1.0,
+                                       y.data(), e.data(), 2);
+    TS_ASSERT_EQUALS(y, std::vector<double>({-2, -0.0}));
+    TS_ASSERT_DELTA(e[0], std::sqrt(4.0 + 4.0) / 2.0, 1e-14);
+    TS_ASSERT_DELTA(e[1], 0.5, 1e-14);
+  }
+};
+
+/** Microbenchmarks of the kernels, on arrays much larger than the caches,
+ * where they should be limited by memory bandwidth, and on spectra that fit
+ * into the L1 cache.
+ */
+class VectorArithmeticTestPerformance : public CxxTest::TestSuite {
+public:
+  static VectorArithmeticTestPerformance *createSuite() {
+    return new VectorArithmeticTestPerformance();
+  }
+  static void destroySuite(VectorArithmeticTestPerformance *suite) {
+    delete suite;
+  }
+
+  VectorArithmeticTestPerformance()
+      : m_ya(m_large, 2.0), m_ea(m_large, 0.5), m_yb(m_large, 4.0),
+        m_eb(m_large, 0.25), m_y(m_large), m_e(m_large) {}
+
+  void test_add_large() {
+    VectorArithmetic::add(m_ya.data(), m_yb.data(), m_y.data(), m_large);
+  }
+
+  void test_addErrors_large() {
+    VectorArithmetic::addErrors(m_ea.data(), m_eb.data(), m_e.data(), m_large);
+  }
+
+  void test_multiplyWithErrors_large() {
+    VectorArithmetic::multiplyWithErrors(m_ya.data(), m_ea.data(), m_yb.data(),
+                                         m_eb.data(), m_y.data(), m_e.data(),
+                                         m_large);
+  }
+
+  void test_divideWithErrors_large() {
+    VectorArithmetic::divideWithErrors(m_ya.data(), m_ea.data(), m_yb.data(),
+                                       m_eb.data(), m_y.data(), m_e.data(),
+                                       m_large);
+  }
+
+  void test_multiplyWithErrors_small_repeated() {
+    for (size_t i = 0; i < m_large / m_small; ++i)
+      VectorArithmetic::multiplyWithErrors(m_ya.data(), m_ea.data(),
+                                           m_yb.data(), m_eb.data(), m_y.data(),
+                                           m_e.data(), m_small);
+  }
+
+  void test_divideWithErrors_small_repeated() {
+    for (size_t i = 0; i < m_large / m_small; ++i)
+      VectorArithmetic::divideWithErrors(m_ya.data(), m_ea.data(), m_yb.data(),
+                                         m_eb.data(), m_y.data(), m_e.data(),
+                                         m_small);
+  }
+
+private:
+  // Declared first, they are used to initialize the vectors
+  const size_t m_large{4000000};
+  const size_t m_small{1000};
+  std::vector<double> m_ya;
+  std::vector<double> m_ea;
+  std::vector<double> m_yb;
+  std::vector<double> m_eb;
+  std::vector<double> m_y;
+  std::vector<double> m_e;
+};
+
+#endif /* MANTID_HISTOGRAMDATA_VECTORARITHMETICTEST_H_ */
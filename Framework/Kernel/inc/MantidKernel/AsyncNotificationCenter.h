@@ -0,0 +1,81 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_ASYNCNOTIFICATIONCENTER_H_
+#define MANTID_KERNEL_ASYNCNOTIFICATIONCENTER_H_
+
+#include "MantidKernel/DllConfig.h"
+
+#include <Poco/AutoPtr.h>
+#include <Poco/Notification.h>
+#include <Poco/NotificationCenter.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** AsyncNotificationCenter : delivers the notifications posted to a
+  Poco::NotificationCenter to its own observers from a background thread.
+
+  The thread that posts a notification only queues it, so slow observers,
+  such as GUI views, do not stall it. The dispatching thread delivers all the
+  notifications queued since it last woke up in one batch, in the order they
+  were posted. Observers are called without any lock held by the source, so
+  they may freely call back into whatever posted the notification, but the
+  object a notification refers to may have changed again by the time they
+  receive it.
+
+  Nothing is queued, and no thread is started, until the first observer is
+  added.
+*/
+class MANTID_KERNEL_DLL AsyncNotificationCenter {
+public:
+  explicit AsyncNotificationCenter(Poco::NotificationCenter &source);
+  AsyncNotificationCenter(const AsyncNotificationCenter &) = delete;
+  AsyncNotificationCenter &operator=(const AsyncNotificationCenter &) = delete;
+  ~AsyncNotificationCenter();
+
+  void addObserver(const Poco::AbstractObserver &observer);
+  void removeObserver(const Poco::AbstractObserver &observer);
+  bool hasObservers() const;
+  void flush();
+
+private:
+  void enqueue(const Poco::AutoPtr<Poco::Notification> &notification);
+  void dispatch();
+
+  /// Center whose notifications are forwarded
+  Poco::NotificationCenter &m_source;
+  /// Center the observers are registered with
+  Poco::NotificationCenter m_center;
+  /// Observer of m_source queueing its notifications, if any
+  std::unique_ptr<Poco::AbstractObserver> m_forwarder;
+  /// Guards the members below
+  std::mutex m_mutex;
+  /// Signalled when notifications are queued or the thread must stop
+  std::condition_variable m_queued;
+  /// Signalled when a batch has been delivered
+  std::condition_variable m_delivered;
+  /// Notifications waiting to be delivered
+  std::vector<Poco::AutoPtr<Poco::Notification>> m_pending;
+  /// Number of notifications queued so far
+  size_t m_numQueued{0};
+  /// Number of notifications delivered so far
+  size_t m_numDelivered{0};
+  bool m_stop{false};
+  std::thread m_thread;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_ASYNCNOTIFICATIONCENTER_H_ */
@@ -14,13 +14,19 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/shared_ptr.hpp>
 #endif
+#include "MantidKernel/AsyncNotificationCenter.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/make_unique.h"
 #include <Poco/Notification.h>
 #include <Poco/NotificationCenter.h>
+#include <Poco/RWLock.h>
 
-#include <mutex>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <memory>
 
 #ifdef _WIN32
 #define strcasecmp _stricmp
@@ -56,6 +62,12 @@ struct CaseInsensitiveCmp {
     This is the primary data service that  the users will interact with either
    through writing scripts or directly
     through the API. It is implemented as a singleton class.
+
+    The objects are spread over a fixed number of shards by a hash of their
+    name, each guarded by its own reader/writer lock. Lookups share the lock,
+    so they only wait for writers to the same shard, and writers change the
+    shard's map in place. Notifications are posted after the lock is
+    released.
 */
 template <typename T> class DLLExport DataService {
 private:
@@ -208,12 +220,13 @@ public:
     bool success = false;
     {
       // Make DataService access thread-safe
-      std::lock_guard<std::recursive_mutex> lock(m_mutex);
+      auto &shard = shardOf(name);
+      Poco::ScopedWriteRWLock lock(shard.lock);
       // At the moment, you can't overwrite an object (i.e. pass in a name
       // that's already in the map with a pointer to a different object).
       // Also, there's nothing to stop the same object from being added
       // more than once with different names.
-      success = datamap.insert(std::make_pair(name, Tobject)).second;
+      success = shard.map.emplace(name, Tobject).second;
     }
     if (!success) {
       std::string error =
@@ -238,27 +251,30 @@ public:
                             const boost::shared_ptr<T> &Tobject) {
     checkForNullPointer(Tobject);
 
-    // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
-
     // find if the Tobject already exists
-    auto it = datamap.find(name);
-    if (it != datamap.end()) {
-      lock.unlock();
+    auto &shard = shardOf(name);
+    const auto oldObject = find(name);
+    if (oldObject) {
       g_log.debug("Data Object '" + name + "' replaced in data service.\n");
 
       notificationCenter.postNotification(
-          new BeforeReplaceNotification(name, it->second, Tobject));
-
-      lock.lock();
-      it->second = Tobject;
-      lock.unlock();
+          new BeforeReplaceNotification(name, oldObject, Tobject));
+
+      {
+        // Make DataService access thread-safe
+        Poco::ScopedWriteRWLock lock(shard.lock);
+        // The object may have been removed meanwhile. The original name is
+        // kept if it differs in case.
+        auto it = shard.map.find(name);
+        if (it != shard.map.end())
+          it->second = Tobject;
+        else
+          shard.map.emplace(name, Tobject);
+      }
 
       notificationCenter.postNotification(
           new AfterReplaceNotification(name, Tobject));
     } else {
-      // Avoid double-locking
-      lock.unlock();
       DataService::add(name, Tobject);
     }
   }
@@ -267,24 +283,24 @@ public:
   /** Remove an object from the service.
    * @param name :: name of the object */
   void remove(const std::string &name) {
-    // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
-
-    auto it = datamap.find(name);
-    if (it == datamap.end()) {
-      lock.unlock();
+    boost::shared_ptr<T> data;
+    {
+      // Make DataService access thread-safe
+      auto &shard = shardOf(name);
+      Poco::ScopedWriteRWLock lock(shard.lock);
+      auto it = shard.map.find(name);
+      if (it != shard.map.end()) {
+        // The item is taken out of the map before unlocking the shard and is
+        // held in a local variable. This protects it from being modified by
+        // another thread.
+        data = std::move(it->second);
+        shard.map.erase(it);
+      }
+    }
+    if (!data) {
       g_log.debug(" remove '" + name + "' cannot be found");
       return;
     }
-    // The map is shared across threads so the item is erased from the map
-    // before unlocking the mutex and is held in a local stack variable.
-    // This protects it from being modified by another thread.
-    auto data = std::move(it->second);
-    datamap.erase(it);
-
-    // Do NOT use "it" iterator after this point. Other threads may modify the
-    // map
-    lock.unlock();
     notificationCenter.postNotification(new PreDeleteNotification(name, data));
     data.reset(); // DataService now has no references to the object
     g_log.information("Data Object '" + name + "' deleted from data service.");
@@ -304,44 +320,54 @@ public:
       return;
     }
 
-    // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
-
-    auto existingNameIter = datamap.find(oldName);
-    if (existingNameIter == datamap.end()) {
-      lock.unlock();
+    const auto existingNameObject = find(oldName);
+    if (!existingNameObject) {
       g_log.warning(" rename '" + oldName + "' cannot be found");
       return;
     }
 
-    auto existingNameObject = std::move(existingNameIter->second);
-    auto targetNameIter = datamap.find(newName);
-
-    // If we are overriding send a notification for observers
-    if (targetNameIter != datamap.end()) {
-      auto targetNameObject = targetNameIter->second;
+    // If we are overriding send a notification for observers. A new name
+    // differing only in case refers to the object being renamed.
+    const CaseInsensitiveCmp less;
+    const bool sameName = !less(oldName, newName) && !less(newName, oldName);
+    const auto targetNameObject =
+        sameName ? boost::shared_ptr<T>() : find(newName);
+    if (targetNameObject) {
       // As we are renaming the existing name turns into the new name
       notificationCenter.postNotification(new BeforeReplaceNotification(
           newName, targetNameObject, existingNameObject));
     }
 
-    datamap.erase(existingNameIter);
+    {
+      // Make DataService access thread-safe. Lock both shards in the order
+      // of the shard array, as clear() does, to avoid deadlocks.
+      auto &oldShard = shardOf(oldName);
+      auto &newShard = shardOf(newName);
+      Poco::ScopedWriteRWLock firstLock(std::min(&oldShard, &newShard)->lock);
+      std::unique_ptr<Poco::ScopedWriteRWLock> secondLock;
+      if (&oldShard != &newShard)
+        secondLock = Kernel::make_unique<Poco::ScopedWriteRWLock>(
+            std::max(&oldShard, &newShard)->lock);
+
+      auto existingNameIter = oldShard.map.find(oldName);
+      if (existingNameIter == oldShard.map.end()) {
+        // Removed by another thread in the meantime
+        g_log.warning(" rename '" + oldName + "' cannot be found");
+        return;
+      }
+      auto object = std::move(existingNameIter->second);
+      oldShard.map.erase(existingNameIter);
+      auto targetNameIter = newShard.map.find(newName);
+      if (targetNameIter != newShard.map.end())
+        targetNameIter->second = std::move(object);
+      else
+        newShard.map.emplace(newName, std::move(object));
+    }
 
-    if (targetNameIter != datamap.end()) {
-      targetNameIter->second = std::move(existingNameObject);
+    if (targetNameObject) {
       notificationCenter.postNotification(
-          new AfterReplaceNotification(newName, targetNameIter->second));
-    } else {
-      if (!(datamap.emplace(newName, std::move(existingNameObject)).second)) {
-        // should never happen
-        lock.unlock();
-        std::string error =
-            " add : Unable to insert Data Object : '" + newName + "'";
-        g_log.error(error);
-        throw std::runtime_error(error);
-      }
+          new AfterReplaceNotification(newName, existingNameObject));
     }
-    lock.unlock();
     g_log.information("Data Object '" + oldName + "' renamed to '" + newName +
                       "'");
     notificationCenter.postNotification(
@@ -351,11 +377,20 @@ public:
   //--------------------------------------------------------------------------
   /// Empty the service
   void clear() {
+    // Objects are released after unlocking, in case their destructors use
+    // the service
+    std::array<svcmap, NUM_SHARDS> oldMaps;
     {
       // Make DataService access thread-safe
-      std::lock_guard<std::recursive_mutex> lock(m_mutex);
-      datamap.clear();
+      for (auto &shard : m_shards)
+        shard.lock.writeLock();
+      for (size_t i = 0; i < NUM_SHARDS; ++i)
+        oldMaps[i].swap(m_shards[i].map);
+      for (auto &shard : m_shards)
+        shard.lock.unlock();
     }
+    for (auto &map : oldMaps)
+      map.clear();
     notificationCenter.postNotification(new ClearNotification());
     g_log.debug() << typeid(this).name() << " cleared.\n";
   }
@@ -367,12 +402,9 @@ public:
   /** Get a shared pointer to a stored data object
    * @param name :: name of the object */
   boost::shared_ptr<T> retrieve(const std::string &name) const {
-    // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
-
-    auto it = datamap.find(name);
-    if (it != datamap.end()) {
-      return it->second;
+    auto object = find(name);
+    if (object) {
+      return object;
     } else {
       throw Kernel::Exception::NotFoundError(
           "Unable to find Data Object type with name '" + name +
@@ -392,26 +424,27 @@ public:
 
   /// Check to see if a data object exists in the store
   bool doesExist(const std::string &name) const {
-    // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
-    auto it = datamap.find(name);
-    return it != datamap.end();
+    auto &shard = shardOf(name);
+    Poco::ScopedReadRWLock lock(shard.lock);
+    return shard.map.find(name) != shard.map.end();
   }
 
   /// Return the number of objects stored by the data service
   size_t size() const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
-
-    if (showingHiddenObjects()) {
-      return datamap.size();
-    } else {
-      size_t count = 0;
-      for (auto &it : datamap) {
-        if (!isHiddenDataServiceObject(it.first))
-          ++count;
+    const bool showingHidden = showingHiddenObjects();
+    size_t count = 0;
+    for (auto &shard : m_shards) {
+      Poco::ScopedReadRWLock lock(shard.lock);
+      if (showingHidden) {
+        count += shard.map.size();
+      } else {
+        for (auto &it : shard.map) {
+          if (!isHiddenDataServiceObject(it.first))
+            ++count;
+        }
       }
-      return count;
     }
+    return count;
   }
 
   /**
@@ -437,25 +470,11 @@ public:
       }
     }
 
-    // Use the scoping of an if to handle our lock for duration
-    if (hiddenState == DataServiceHidden::Include) {
-      // Getting hidden items
-      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
-      foundNames.reserve(datamap.size());
-      for (const auto &item : datamap) {
+    for (const auto &item : items()) {
+      if (hiddenState == DataServiceHidden::Include ||
+          !isHiddenDataServiceObject(item.first)) {
         foundNames.push_back(item.first);
       }
-      // Lock released at end of scope here
-    } else {
-      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
-      foundNames.reserve(datamap.size());
-      for (const auto &item : datamap) {
-        if (!isHiddenDataServiceObject(item.first)) {
-          // This item is not hidden add it
-          foundNames.push_back(item.first);
-        }
-      }
-      // Lock released at end of scope here
     }
 
     // Now sort if told to
@@ -469,8 +488,6 @@ public:
   /// Get a vector of the pointers to the data objects stored by the service
   std::vector<boost::shared_ptr<T>>
   getObjects(DataServiceHidden includeHidden = DataServiceHidden::Auto) const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
-
     const bool alwaysIncludeHidden =
         includeHidden == DataServiceHidden::Include;
     const bool usingAuto =
@@ -479,8 +496,7 @@ public:
     const bool showingHidden = alwaysIncludeHidden || usingAuto;
 
     std::vector<boost::shared_ptr<T>> objects;
-    objects.reserve(datamap.size());
-    for (const auto &it : datamap) {
+    for (const auto &it : items()) {
       if (showingHidden || !isHiddenDataServiceObject(it.first)) {
         objects.push_back(it.second);
       }
@@ -505,6 +521,9 @@ public:
   /// using Poco::NotificationCenter::addObserver(...)
   ///@return nothing
   Poco::NotificationCenter notificationCenter;
+  /// Delivers the notifications of notificationCenter from a background
+  /// thread, so that observers do not hold up the thread changing the service
+  AsyncNotificationCenter asyncNotificationCenter;
   /// Deleted copy constructor
   DataService(const DataService &) = delete;
   /// Deleted copy assignment operator
@@ -512,7 +531,9 @@ public:
 
 protected:
   /// Protected constructor (singleton)
-  DataService(const std::string &name) : svcName(name), g_log(svcName) {}
+  DataService(const std::string &name)
+      : asyncNotificationCenter(notificationCenter), svcName(name),
+        g_log(svcName) {}
   virtual ~DataService() = default;
 
 private:
@@ -532,13 +553,55 @@ private:
     }
   }
 
+  /// A part of the objects in the data service
+  struct Shard {
+    /// Shared by readers of the shard, exclusive to writers
+    Poco::RWLock lock;
+    /// The objects of the shard
+    svcmap map;
+  };
+  /// Number of shards the objects are spread over
+  static constexpr size_t NUM_SHARDS = 16;
+
+  /// Return the shard holding objects with the given name. The hash ignores
+  /// case, as the names do.
+  Shard &shardOf(const std::string &name) const {
+    size_t hash = 0;
+    for (const auto c : name)
+      hash = hash * 31 + static_cast<size_t>(std::tolower(
+                             static_cast<unsigned char>(c)));
+    return m_shards[hash % NUM_SHARDS];
+  }
+
+  /// Return the object with the given name, or null if there is none
+  boost::shared_ptr<T> find(const std::string &name) const {
+    auto &shard = shardOf(name);
+    Poco::ScopedReadRWLock lock(shard.lock);
+    auto it = shard.map.find(name);
+    return it != shard.map.end() ? it->second : boost::shared_ptr<T>();
+  }
+
+  /// Return all the stored names and objects ordered by name
+  std::vector<std::pair<std::string, boost::shared_ptr<T>>> items() const {
+    std::vector<std::pair<std::string, boost::shared_ptr<T>>> allItems;
+    for (auto &shard : m_shards) {
+      Poco::ScopedReadRWLock lock(shard.lock);
+      allItems.insert(allItems.end(), shard.map.begin(), shard.map.end());
+    }
+    const CaseInsensitiveCmp less;
+    std::sort(allItems.begin(), allItems.end(),
+              [&less](const std::pair<std::string, boost::shared_ptr<T>> &lhs,
+                      const std::pair<std::string, boost::shared_ptr<T>> &rhs) {
+                return less(lhs.first, rhs.first);
+              });
+    return allItems;
+  }
+
   /// DataService name. This is set only at construction. DataService name
   /// should be provided when construction of derived classes
   const std::string svcName;
-  /// Map of objects in the data service
-  svcmap datamap;
-  /// Recursive mutex to avoid simultaneous access or notifications
-  mutable std::recursive_mutex m_mutex;
+  /// Objects in the data service, spread over the shards by name
+  mutable std::array<Shard, NUM_SHARDS> m_shards;
   /// Logger for this DataService
   Logger g_log;
 }; // End Class Data service
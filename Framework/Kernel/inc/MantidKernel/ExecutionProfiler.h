@@ -0,0 +1,122 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_EXECUTIONPROFILER_H_
+#define MANTID_KERNEL_EXECUTIONPROFILER_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/SingletonHolder.h"
+
+#include <json/value.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ExecutionProfiler : records where the framework spends its time and
+  exports it as a Chrome trace, which can be viewed in chrome://tracing or
+  https://ui.perfetto.dev.
+
+  Recording is off by default, and then costs a single atomic load per
+  event. When it is on:
+  - every execution of an algorithm, including child algorithms, is recorded
+    with its CPU time, the growth of the peak resident memory of the process
+    and the size of its output workspaces;
+  - every ThreadPool task is recorded on the thread running it;
+  - every parallel region opened by the PARALLEL_FOR macros, other than
+    serial ones nested in another region, is recorded with the number of
+    threads it ran with and their utilisation, i.e. the CPU time of the
+    process divided by the time all of its threads were available.
+
+  Events are kept in one buffer per thread, so recording from many threads
+  at once does not contend on a single lock.
+*/
+class MANTID_KERNEL_DLL ExecutionProfilerImpl {
+public:
+  /// A recorded interval of time on one thread
+  struct Event {
+    std::string name;
+    std::string category;
+    /// Microseconds since the profiler was created
+    int64_t start;
+    /// Microseconds
+    int64_t duration;
+    /// Small number identifying the thread, in order of first recording
+    size_t thread;
+    /// Extra values shown with the event
+    std::vector<std::pair<std::string, double>> args;
+  };
+
+  /// Records an Event lasting for the lifetime of the object, if the
+  /// profiler was enabled when it was created.
+  class MANTID_KERNEL_DLL Span {
+  public:
+    Span(const char *category, std::string name);
+    Span(const Span &) = delete;
+    Span &operator=(const Span &) = delete;
+    ~Span();
+    /// @return true if this span will be recorded
+    bool active() const { return m_active; }
+    void addArg(std::string key, double value);
+
+  private:
+    Event m_event;
+    bool m_active;
+  };
+
+  ExecutionProfilerImpl(const ExecutionProfilerImpl &) = delete;
+  ExecutionProfilerImpl &operator=(const ExecutionProfilerImpl &) = delete;
+
+  void setEnabled(bool enabled);
+  /// @return true if events are being recorded
+  bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+  void record(Event event);
+  void clear();
+  int64_t now() const;
+
+  std::vector<Event> events() const;
+  ::Json::Value toChromeTrace() const;
+  void saveChromeTrace(const std::string &filename) const;
+
+  static double processCPUTime();
+
+private:
+  friend struct Mantid::Kernel::CreateUsingNew<ExecutionProfilerImpl>;
+  ExecutionProfilerImpl();
+  ~ExecutionProfilerImpl() = default;
+
+  /// The events recorded by one thread
+  struct ThreadBuffer {
+    std::mutex mutex;
+    std::vector<Event> events;
+    size_t thread;
+  };
+  ThreadBuffer &threadBuffer();
+
+  std::atomic<bool> m_enabled;
+  /// Time that Event::start is relative to
+  const std::chrono::steady_clock::time_point m_epoch;
+  /// Guards m_buffers
+  mutable std::mutex m_buffersMutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+};
+
+EXTERN_MANTID_KERNEL template class MANTID_KERNEL_DLL
+    Mantid::Kernel::SingletonHolder<ExecutionProfilerImpl>;
+using ExecutionProfiler = Mantid::Kernel::SingletonHolder<ExecutionProfilerImpl>;
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_EXECUTIONPROFILER_H_ */
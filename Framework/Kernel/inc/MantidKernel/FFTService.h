@@ -0,0 +1,80 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_FFTSERVICE_H_
+#define MANTID_KERNEL_FFTSERVICE_H_
+
+#include "MantidKernel/DllConfig.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace Mantid {
+namespace Kernel {
+
+/** RealFFTPlan : fast Fourier transforms of real data of a fixed length.
+
+  The plan holds the GSL wavetables of the forward and inverse transforms,
+  which are only read by the transforms, so one plan can be used by any
+  number of threads at once. Each thread uses its own scratch space.
+
+  The transforms are in place and use the half-complex order of GSL: for n
+  values, data[0] is the real part of the zero frequency, data[2k - 1] and
+  data[2k] are the real and imaginary parts of frequency k and, if n is even,
+  data[n - 1] is the real part of frequency n / 2. The inverse transform is
+  normalised, so it restores the data passed to the forward transform.
+*/
+class MANTID_KERNEL_DLL RealFFTPlan {
+public:
+  explicit RealFFTPlan(const size_t size);
+  ~RealFFTPlan();
+  RealFFTPlan(const RealFFTPlan &) = delete;
+  RealFFTPlan &operator=(const RealFFTPlan &) = delete;
+
+  /// The number of values of the transformed data
+  size_t size() const { return m_size; }
+
+  void forward(double *data) const;
+  void inverse(double *data) const;
+  void forward(double *data, const size_t count,
+               const bool runParallel = true) const;
+  void inverse(double *data, const size_t count,
+               const bool runParallel = true) const;
+
+private:
+  struct Wavetables;
+  size_t m_size;
+  std::unique_ptr<Wavetables> m_wavetables;
+};
+
+/** FFTService : the plans for Fourier transforms shared by all algorithms and
+  functions, and operations on transformed data.
+
+  Creating a plan computes its trigonometric tables, which takes longer than
+  a transform, so plans are cached by length.
+*/
+namespace FFTService {
+
+/// The cached plan for transforms of the given number of values
+MANTID_KERNEL_DLL std::shared_ptr<const RealFFTPlan> plan(const size_t size);
+
+/// The smallest size not below the given one with no prime factors other than
+/// 2, 3 and 5, for which the transforms are fastest
+MANTID_KERNEL_DLL size_t fastSize(const size_t size);
+
+/// out = a * b for half-complex arrays, the transform of a convolution
+MANTID_KERNEL_DLL void multiply(const double *a, const double *b, double *out,
+                                const size_t size);
+
+/// out = conj(a) * b for half-complex arrays, the transform of a correlation
+MANTID_KERNEL_DLL void multiplyConjugate(const double *a, const double *b,
+                                         double *out, const size_t size);
+
+} // namespace FFTService
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_FFTSERVICE_H_ */
@@ -8,6 +8,7 @@
 #define MANTID_KERNEL_MULTITHREADED_H_
 
 #include "MantidKernel/DataItem.h"
+#include "MantidKernel/ThreadBudget.h"
 
 #include <atomic>
 #include <mutex>
@@ -131,20 +132,41 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
 
 #include <omp.h>
 
+/** Reserves threads from the ThreadBudget for the parallel region that
+ * follows and releases them at its end, recording the region with the
+ * ExecutionProfiler if it is enabled. Expands to for statements that
+ * execute their body, the parallel region, exactly once.
+ */
+#define PARALLEL_RESERVE(condition)                                            \
+  for (Mantid::Kernel::ThreadBudget::Reservation mantidParallelReservation(    \
+           (condition), __FILE__, __LINE__);                                   \
+       mantidParallelReservation.enterOnce();)                                 \
+    for (Mantid::Kernel::ThreadBudget::InheritedLimit mantidParallelLimit;     \
+         mantidParallelLimit.enterOnce();)
+
+/// OpenMP clauses using the threads reserved by PARALLEL_RESERVE. Each thread
+/// copies the thread limit of the thread opening the region.
+#define PARALLEL_RESERVED_THREADS                                              \
+  if (mantidParallelReservation.parallel())                                    \
+      num_threads(mantidParallelReservation.numThreads())                      \
+          firstprivate(mantidParallelLimit)
+
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
  *   This includes an arbirary check: condition.
  *   "condition" must evaluate to TRUE in order for the
  *   code to be executed in parallel
  */
 #define PARALLEL_FOR_IF(condition)                                             \
-    PRAGMA(omp parallel for if (condition) )
+  PARALLEL_RESERVE(condition)                                                  \
+  PRAGMA(omp parallel for PARALLEL_RESERVED_THREADS)
 
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
  *   This includes no checks to see if workspaces are suitable
  *   and therefore should not be used in any loops that access workspaces.
  */
 #define PARALLEL_FOR_NO_WSP_CHECK()                                            \
-    PRAGMA(omp parallel for)
+  PARALLEL_RESERVE(true)                                                       \
+  PRAGMA(omp parallel for PARALLEL_RESERVED_THREADS)
 
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
  *  and declare the varialbes to be firstprivate.
@@ -152,10 +174,13 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
  *  and therefore should not be used in any loops that access workspace.
  */
 #define PARALLEL_FOR_NOWS_CHECK_FIRSTPRIVATE(variable)                         \
-  PRAGMA(omp parallel for firstprivate(variable) )
+  PARALLEL_RESERVE(true)                                                       \
+  PRAGMA(omp parallel for firstprivate(variable) PARALLEL_RESERVED_THREADS)
 
 #define PARALLEL_FOR_NO_WSP_CHECK_FIRSTPRIVATE2(variable1, variable2)          \
-  PRAGMA(omp parallel for firstprivate(variable1, variable2) )
+  PARALLEL_RESERVE(true)                                                       \
+  PRAGMA(omp parallel for firstprivate(variable1, variable2)                   \
+             PARALLEL_RESERVED_THREADS)
 
 /** Ensures that the next execution line or block is only executed if
  * there are multple threads execting in this region
@@ -192,7 +217,9 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
 
 #define PARALLEL_THREAD_NUMBER omp_get_thread_num()
 
-#define PARALLEL PRAGMA(omp parallel)
+#define PARALLEL                                                               \
+  PARALLEL_RESERVE(true)                                                       \
+  PRAGMA(omp parallel PARALLEL_RESERVED_THREADS)
 
 #define PARALLEL_SECTIONS PRAGMA(omp sections nowait)
 
@@ -0,0 +1,127 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_PARALLELREDUCE_H_
+#define MANTID_KERNEL_PARALLELREDUCE_H_
+
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** CompensatedSum : a sum of doubles with a correction term for the rounding
+  errors of the additions (Neumaier's variant of Kahan summation). Summing
+  many values this way is accurate to about the precision of a single
+  addition, independent of the number of values and of their order.
+*/
+class CompensatedSum {
+public:
+  CompensatedSum() = default;
+  explicit CompensatedSum(const double value) : m_sum(value) {}
+
+  CompensatedSum &operator+=(const double value) {
+    const double sum = m_sum + value;
+    if (std::abs(m_sum) >= std::abs(value))
+      m_correction += (m_sum - sum) + value;
+    else
+      m_correction += (value - sum) + m_sum;
+    m_sum = sum;
+    return *this;
+  }
+
+  CompensatedSum &operator+=(const CompensatedSum &other) {
+    *this += other.m_sum;
+    m_correction += other.m_correction;
+    return *this;
+  }
+
+  /// The compensated value of the sum
+  double value() const { return m_sum + m_correction; }
+
+private:
+  double m_sum{0.};
+  double m_correction{0.};
+};
+
+/** Reduces the items 0 to size - 1 in parallel.
+ *
+ * The items are split into contiguous chunks, each accumulated into its own
+ * partial result starting as a copy of identity. The partial results are then
+ * merged pairwise in a tree, again in parallel, such that the result is
+ * merge(...merge(merge(p0, p1), merge(p2, p3))...). The chunks only depend on
+ * size and grainSize, so the result does not depend on the number of threads.
+ *
+ * @param size :: the number of items
+ * @param identity :: the partial result of no items
+ * @param accumulate :: called as accumulate(T &partial, size_t item)
+ * @param merge :: called as merge(T &partial, T &other) to add other into
+ * partial. other is not used afterwards, so it may be moved from.
+ * @param grainSize :: the minimum number of items in a chunk
+ * @param runParallel :: whether to use threads, e.g. from threadSafe()
+ * @return the result of all items
+ */
+template <class T, class Accumulate, class Merge>
+T parallelReduce(const size_t size, const T &identity, Accumulate accumulate,
+                 Merge merge, const size_t grainSize = 1,
+                 const bool runParallel = true) {
+  // Fixed, not the number of threads, to keep the result reproducible
+  const size_t maxChunks = 64;
+  const size_t numChunks = std::max(
+      size_t(1), std::min(maxChunks, size / std::max(grainSize, size_t(1))));
+  std::vector<T> partials(numChunks, identity);
+  std::exception_ptr exception;
+
+  const auto chunks = static_cast<int64_t>(numChunks);
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (runParallel && chunks > 1))
+  for (int64_t chunk = 0; chunk < chunks; ++chunk) {
+    try {
+      const size_t begin = size * static_cast<size_t>(chunk) / numChunks;
+      const size_t end = size * static_cast<size_t>(chunk + 1) / numChunks;
+      for (size_t item = begin; item < end; ++item)
+        accumulate(partials[chunk], item);
+    } catch (...) {
+      PARALLEL_CRITICAL(ParallelReduce_exception) {
+        if (!exception)
+          exception = std::current_exception();
+      }
+    }
+  }
+  if (exception)
+    std::rethrow_exception(exception);
+
+  for (size_t stride = 1; stride < numChunks; stride *= 2) {
+    // Partial left + stride is merged into partial left
+    const auto pairs = static_cast<int64_t>((numChunks + stride - 1) /
+                                            (2 * stride));
+    PRAGMA_OMP(parallel for if (runParallel && pairs > 1))
+    for (int64_t pair = 0; pair < pairs; ++pair) {
+      try {
+        const size_t left = 2 * stride * pair;
+        merge(partials[left], partials[left + stride]);
+      } catch (...) {
+        PARALLEL_CRITICAL(ParallelReduce_exception) {
+          if (!exception)
+            exception = std::current_exception();
+        }
+      }
+    }
+    if (exception)
+      std::rethrow_exception(exception);
+  }
+  return std::move(partials.front());
+}
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_PARALLELREDUCE_H_ */
@@ -67,6 +67,8 @@ public:
   virtual void copyPropertiesFrom(const PropertyManagerOwner &po) {
     *this = po;
   }
+  /// Replace the properties by independent copies of the properties of po
+  void clonePropertiesFrom(const PropertyManagerOwner &po);
 
   bool existsProperty(const std::string &name) const override;
   bool validateProperties() const override;
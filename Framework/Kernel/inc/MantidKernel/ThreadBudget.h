@@ -0,0 +1,129 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_THREADBUDGET_H_
+#define MANTID_KERNEL_THREADBUDGET_H_
+
+#include "MantidKernel/DllConfig.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadBudget : the number of threads the whole framework may run at once.
+
+  Parallel regions opened with the PARALLEL_FOR macros and the threads of a
+  ThreadPool reserve their extra threads from this budget and return them when
+  they finish. A region opened while others are running, e.g. by an algorithm
+  run in another thread or a ThreadPool task, therefore only gets the threads
+  that are still idle, and runs serially if there are none, instead of
+  oversubscribing the machine. The thread that opens a region is already
+  running, so it does not count against the budget.
+
+  The OpenMP limit on active nesting levels is left as it is, normally one
+  level: per-thread buffers indexed with PARALLEL_THREAD_NUMBER would be
+  shared between the teams of nested regions otherwise. A region nested in
+  an active one reserves nothing, since OpenMP runs it in one thread.
+
+  The number of threads of regions opened by a thread can be capped further
+  with a ThreadBudget::Limit, which is what Algorithm::setMaxThreads uses.
+  The PARALLEL macros pass the limit on to the threads of their regions with
+  an InheritedLimit, and a ThreadPool passes the limit of the thread that
+  starts it on to its threads. Threads started in other ways, e.g. with
+  std::thread or Poco::Thread directly, do not inherit it.
+*/
+class MANTID_KERNEL_DLL ThreadBudget {
+public:
+  static size_t capacity();
+  static void setCapacity(size_t numThreads);
+  static size_t available();
+  static size_t threadLimit();
+
+  /// Threads reserved for one parallel region. The calling thread is one of
+  /// them, so at least one thread is always granted.
+  class MANTID_KERNEL_DLL Reservation {
+  public:
+    explicit Reservation(bool parallel = true);
+    Reservation(bool parallel, const char *file, int line);
+    Reservation(size_t numThreads, bool parallel);
+    Reservation(const Reservation &) = delete;
+    Reservation &operator=(const Reservation &) = delete;
+    ~Reservation();
+
+    /// @return the number of threads granted, including the calling one
+    int numThreads() const { return static_cast<int>(m_extraThreads + 1); }
+    /// @return true if more than one thread was granted
+    bool parallel() const { return m_extraThreads > 0; }
+    /// Returns true on the first call only, so that the PARALLEL_FOR macros
+    /// can scope a reservation to a single loop.
+    bool enterOnce() {
+      const bool first = !m_entered;
+      m_entered = true;
+      return first;
+    }
+
+  private:
+    void startProfiling(const char *file, int line);
+
+    /// Number of threads taken from the budget
+    size_t m_extraThreads;
+    bool m_entered;
+    /// Source location of the region if it is being profiled, else nullptr
+    const char *m_file = nullptr;
+    int m_line = 0;
+    /// Profiler time and process CPU time when the region was opened
+    int64_t m_start = 0;
+    double m_cpuStart = 0.;
+  };
+
+  /// Caps the number of threads of parallel regions opened by the calling
+  /// thread for the lifetime of the object. Limits nest: the smallest wins.
+  class MANTID_KERNEL_DLL Limit {
+  public:
+    explicit Limit(size_t maxThreads);
+    Limit(const Limit &) = delete;
+    Limit &operator=(const Limit &) = delete;
+    ~Limit();
+
+  private:
+    /// The limit to restore on destruction
+    size_t m_previous;
+  };
+
+  /// Passes the limit of the thread opening a parallel region on to the
+  /// threads running it. Constructing one records the limit of the calling
+  /// thread; each copy applies it in the thread making the copy until the
+  /// copy is destroyed, so the object is meant for an OpenMP firstprivate
+  /// clause.
+  class MANTID_KERNEL_DLL InheritedLimit {
+  public:
+    InheritedLimit();
+    InheritedLimit(const InheritedLimit &other);
+    InheritedLimit &operator=(const InheritedLimit &) = delete;
+    ~InheritedLimit();
+
+    /// Returns true on the first call only, see Reservation::enterOnce
+    bool enterOnce() {
+      const bool first = !m_entered;
+      m_entered = true;
+      return first;
+    }
+
+  private:
+    /// The limit passed on
+    size_t m_limit;
+    /// The limit of the calling thread to restore on destruction
+    size_t m_previous;
+    bool m_entered;
+  };
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_THREADBUDGET_H_ */
@@ -8,7 +8,9 @@
 #define THREADPOOL_H_
 
 #include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/ThreadScheduler.h"
+#include <memory>
 #include <vector>
 
 // Forward declares
@@ -68,6 +70,9 @@ protected:
   /// Progress reporter
   ProgressBase *m_prog;
 
+  /// Threads taken from the ThreadBudget while the pool is running
+  std::unique_ptr<ThreadBudget::Reservation> m_reservation;
+
 private:
   // prohibit default copy constructor as it does not work
   ThreadPool(const ThreadPool &);
@@ -25,7 +25,8 @@ class ThreadScheduler;
 class MANTID_KERNEL_DLL ThreadPoolRunnable : public Poco::Runnable {
 public:
   ThreadPoolRunnable(size_t threadnum, ThreadScheduler *scheduler,
-                     ProgressBase *prog = nullptr, double waitSec = 0.0);
+                     ProgressBase *prog = nullptr, double waitSec = 0.0,
+                     size_t threadLimit = 0);
 
   /// Return the thread number of this thread.
   size_t threadnum() { return m_threadnum; }
@@ -46,6 +47,9 @@ private:
 
   /// How many seconds you are allowed to wait with no tasks before exiting.
   double m_waitSec;
+
+  /// ThreadBudget limit applied to the regions opened by the tasks
+  size_t m_threadLimit;
 };
 
 } // namespace Kernel
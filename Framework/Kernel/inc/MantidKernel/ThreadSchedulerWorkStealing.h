@@ -0,0 +1,92 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : a ThreadScheduler that keeps one queue of
+ * tasks per thread instead of a single shared queue, so that threads running
+ * many small tasks do not all contend for the same lock.
+ *
+ * - Tasks pushed from within a running task (e.g. MDGridBox splitting) go to
+ *   the queue of the thread running that task. Tasks pushed from any other
+ *   thread are dealt out to the queues in turn.
+ * - A thread pops the most recently added task from its own queue.
+ * - A thread whose queue is empty steals the oldest tasks from the queue
+ *   with the largest total cost, taking up to half of that queue's cost
+ *   (and at most half of its tasks) in one go.
+ *
+ * No ordering between tasks is guaranteed. empty() only returns true once
+ * all queues are empty AND all popped tasks have been reported as finished,
+ * since a running task may still push more work. Code calling pop() directly
+ * must therefore call finished() for every task it gets.
+ */
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numQueues = 0);
+  ThreadSchedulerWorkStealing(const ThreadSchedulerWorkStealing &) = delete;
+  ThreadSchedulerWorkStealing &
+  operator=(const ThreadSchedulerWorkStealing &) = delete;
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(Task *newTask) override;
+  Task *pop(size_t threadnum) override;
+  void finished(Task *task, size_t threadnum) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override;
+  double totalCost() override;
+  double totalCostExecuted() override;
+
+  /// @return the number of per-thread queues
+  size_t numQueues() const { return m_queues.size(); }
+  size_t queueSize(size_t queue) const;
+
+private:
+  /// The tasks belonging to one thread
+  struct WorkQueue {
+    /// Guards tasks; the atomics are only written while holding it
+    std::mutex lock;
+    std::deque<Task *> tasks;
+    /// Number of tasks, readable without the lock
+    std::atomic<size_t> size{0};
+    /// Summed cost of the tasks, readable without the lock
+    std::atomic<double> cost{0.0};
+    /// Cost of all tasks ever pushed to this queue
+    std::atomic<double> costPushed{0.0};
+    /// Cost of the tasks finished by threads owning this queue
+    std::atomic<double> costExecuted{0.0};
+  };
+
+  void pushTo(WorkQueue &queue, Task *task);
+  Task *popLocal(WorkQueue &queue);
+  Task *steal(size_t thief);
+
+  /// One queue per thread
+  std::vector<std::unique_ptr<WorkQueue>> m_queues;
+  /// Queue receiving the next task pushed from outside a worker
+  std::atomic<size_t> m_nextQueue{0};
+  /// Number of tasks in all queues
+  std::atomic<size_t> m_numQueued{0};
+  /// Number of tasks popped but not finished yet
+  std::atomic<size_t> m_numRunning{0};
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_ */
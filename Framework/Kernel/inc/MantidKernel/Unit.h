@@ -168,6 +168,35 @@ public:
    */
   virtual double singleFromTOF(const double tof) const = 0;
 
+  /** Convert many values to TOF, like singleToTOF(). The concrete units
+   * override this with a loop that needs no virtual call per value.
+   * @param x :: the values to convert
+   * @param tof :: the array for the TOF values, may be the same as x
+   * @param size :: the number of values
+   */
+  virtual void arrayToTOF(const double *x, double *tof,
+                          const size_t size) const;
+
+  /** Convert many TOF values to this unit, like singleFromTOF().
+   * @param tof :: the TOF values to convert
+   * @param x :: the array for the values in this unit, may be the same as tof
+   * @param size :: the number of values
+   */
+  virtual void arrayFromTOF(const double *tof, double *x,
+                            const size_t size) const;
+
+  /** Get the conversion to TOF as tof = factor * x^power, if it has this form
+   * for the current initialization. singleToTOF() remains the reference for
+   * the values it handles specially, e.g., x = 0.
+   * @param factor :: set to the factor of the power law
+   * @param power :: set to the power of the power law
+   * @return true if the conversion is a power law
+   */
+  virtual bool toTOFPowerLaw(double &factor, double &power) const;
+
+  /// Get the conversion from TOF as x = factor * tof^power, @see toTOFPowerLaw
+  virtual bool fromTOFPowerLaw(double &factor, double &power) const;
+
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
@@ -288,6 +317,12 @@ public:
   void init() override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void arrayToTOF(const double *x, double *tof,
+                  const size_t size) const override;
+  void arrayFromTOF(const double *tof, double *x,
+                    const size_t size) const override;
+  bool toTOFPowerLaw(double &factor, double &power) const override;
+  bool fromTOFPowerLaw(double &factor, double &power) const override;
   Unit *clone() const override;
   ///@return -DBL_MAX as ToF convertible to TOF for in any time range
   double conversionTOFMin() const override;
@@ -305,6 +340,12 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void arrayToTOF(const double *x, double *tof,
+                  const size_t size) const override;
+  void arrayFromTOF(const double *tof, double *x,
+                    const size_t size) const override;
+  bool toTOFPowerLaw(double &factor, double &power) const override;
+  bool fromTOFPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -332,6 +373,12 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void arrayToTOF(const double *x, double *tof,
+                  const size_t size) const override;
+  void arrayFromTOF(const double *tof, double *x,
+                    const size_t size) const override;
+  bool toTOFPowerLaw(double &factor, double &power) const override;
+  bool fromTOFPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -379,6 +426,12 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void arrayToTOF(const double *x, double *tof,
+                  const size_t size) const override;
+  void arrayFromTOF(const double *tof, double *x,
+                    const size_t size) const override;
+  bool toTOFPowerLaw(double &factor, double &power) const override;
+  bool fromTOFPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -429,6 +482,12 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void arrayToTOF(const double *x, double *tof,
+                  const size_t size) const override;
+  void arrayFromTOF(const double *tof, double *x,
+                    const size_t size) const override;
+  bool toTOFPowerLaw(double &factor, double &power) const override;
+  bool fromTOFPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -451,6 +510,12 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void arrayToTOF(const double *x, double *tof,
+                  const size_t size) const override;
+  void arrayFromTOF(const double *tof, double *x,
+                    const size_t size) const override;
+  bool toTOFPowerLaw(double &factor, double &power) const override;
+  bool fromTOFPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -559,6 +624,12 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void arrayToTOF(const double *x, double *tof,
+                  const size_t size) const override;
+  void arrayFromTOF(const double *tof, double *x,
+                    const size_t size) const override;
+  bool toTOFPowerLaw(double &factor, double &power) const override;
+  bool fromTOFPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -578,6 +649,12 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void arrayToTOF(const double *x, double *tof,
+                  const size_t size) const override;
+  void arrayFromTOF(const double *tof, double *x,
+                    const size_t size) const override;
+  bool toTOFPowerLaw(double &factor, double &power) const override;
+  bool fromTOFPowerLaw(double &factor, double &power) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -9,6 +9,7 @@
 
 #include "MantidKernel/DeltaEMode.h"
 #include "MantidKernel/DllConfig.h"
+#include <cstddef>
 #include <string>
 
 namespace Mantid {
@@ -33,6 +34,11 @@ public:
                     const double l1, const double l2, const double theta,
                     const DeltaEMode::Type emode, const double efixed);
 
+  /// Convert many values between two initialized units
+  static void run(const Unit &srcUnit, const Unit &destUnit,
+                  const double *srcValues, double *destValues,
+                  const size_t size);
+
   /// Convert to ElasticQ from Energy
   static double convertToElasticQ(const double theta, const double efixed);
 
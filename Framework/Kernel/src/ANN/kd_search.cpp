@@ -85,11 +85,12 @@
 //		These are given below.
 //----------------------------------------------------------------------
 
-int ANNkdDim;           // dimension of space
-ANNpoint ANNkdQ;        // query point
-double ANNkdMaxErr;     // max tolerable squared error
-ANNpointArray ANNkdPts; // the points
-ANNmin_k *ANNkdPointMK; // set of k closest points
+// Mantid: thread_local, allowing concurrent searches in the same tree
+thread_local int ANNkdDim;           // dimension of space
+thread_local ANNpoint ANNkdQ;        // query point
+thread_local double ANNkdMaxErr;     // max tolerable squared error
+thread_local ANNpointArray ANNkdPts; // the points
+thread_local ANNmin_k *ANNkdPointMK; // set of k closest points
 
 //----------------------------------------------------------------------
 //	annkSearch - search for the k nearest neighbors
@@ -115,15 +116,18 @@ void ANNkd_tree::annkSearch(
   ANNkdMaxErr = ANN_POW(1.0 + eps);
   ANN_FLOP(2) // increment floating op count
 
-  ANNkdPointMK = new ANNmin_k(k); // create set for closest k points
-                                  // search starting at the root
+  // Mantid: the set for the closest k points is kept by each thread and
+  // reused by its later searches instead of being allocated per query
+  thread_local ANNmin_k closestPoints(k);
+  closestPoints.reset(k);
+  ANNkdPointMK = &closestPoints;
+  // search starting at the root
   root->ann_search(annBoxDistance(q, bnd_box_lo, bnd_box_hi, dim));
 
   for (int i = 0; i < k; i++) { // extract the k-th closest points
     dd[i] = ANNkdPointMK->ith_smallest_key(i);
     nn_idx[i] = ANNkdPointMK->ith_smallest_info(i);
   }
-  delete ANNkdPointMK; // deallocate closest point set
 }
 
 //----------------------------------------------------------------------
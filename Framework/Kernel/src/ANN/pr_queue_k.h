@@ -69,15 +69,17 @@ class ANNmin_k {
     PQKinfo info;  // info field (user defined)
   };
 
-  int k;       // max number of keys to store
-  int n;       // number of keys currently active
-  mk_node *mk; // the list itself
+  int k;        // max number of keys to store
+  int n;        // number of keys currently active
+  int capacity; // Mantid: max number of keys the list can hold
+  mk_node *mk;  // the list itself
 
 public:
   ANNmin_k(int max) // constructor (given max size)
   {
     n = 0;                     // initially no items
     k = max;                   // maximum number of items
+    capacity = max;            // Mantid: see reset()
     mk = new mk_node[max + 1]; // sorted array of keys
   }
 
@@ -86,6 +88,22 @@ public:
     delete[] mk;
   }
 
+  // Mantid: the list owns its array, it is neither copied nor assigned
+  ANNmin_k(const ANNmin_k &) = delete;
+  ANNmin_k &operator=(const ANNmin_k &) = delete;
+
+  // Mantid: empty the set and change its max size, the array is only
+  // reallocated if it is too small, so one set can serve many searches
+  void reset(int max) {
+    if (max > capacity) {
+      delete[] mk;
+      mk = new mk_node[max + 1];
+      capacity = max;
+    }
+    n = 0;
+    k = max;
+  }
+
   PQKkey ANNmin_key() // return minimum key
   {
     return (n > 0 ? mk[0].key : PQ_NULL_KEY);
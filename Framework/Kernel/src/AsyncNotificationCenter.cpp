@@ -0,0 +1,128 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/AsyncNotificationCenter.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/make_unique.h"
+
+#include <Poco/NObserver.h>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// static logger
+Logger g_log("AsyncNotificationCenter");
+} // namespace
+
+/**
+ * @param source :: the center whose notifications are forwarded. It must
+ * outlive this object.
+ */
+AsyncNotificationCenter::AsyncNotificationCenter(
+    Poco::NotificationCenter &source)
+    : m_source(source) {}
+
+/// Stops forwarding and drops any notifications not delivered yet
+AsyncNotificationCenter::~AsyncNotificationCenter() {
+  if (m_forwarder)
+    m_source.removeObserver(*m_forwarder);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_queued.notify_all();
+  m_delivered.notify_all();
+  if (m_thread.joinable())
+    m_thread.join();
+}
+
+/**
+ * Add an observer, e.g. a Poco::NObserver, called from the dispatching thread.
+ * Notifications posted before the first observer is added are not delivered.
+ * @param observer :: the observer to add
+ */
+void AsyncNotificationCenter::addObserver(
+    const Poco::AbstractObserver &observer) {
+  m_center.addObserver(observer);
+  Poco::AbstractObserver *forwarder(nullptr);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_forwarder) {
+      m_forwarder = Kernel::make_unique<
+          Poco::NObserver<AsyncNotificationCenter, Poco::Notification>>(
+          *this, &AsyncNotificationCenter::enqueue);
+      forwarder = m_forwarder.get();
+      m_thread = std::thread(&AsyncNotificationCenter::dispatch, this);
+    }
+  }
+  if (forwarder)
+    m_source.addObserver(*forwarder);
+}
+
+/// @param observer :: an observer previously added with addObserver
+void AsyncNotificationCenter::removeObserver(
+    const Poco::AbstractObserver &observer) {
+  m_center.removeObserver(observer);
+}
+
+/// @return true if any observers are registered
+bool AsyncNotificationCenter::hasObservers() const {
+  return m_center.hasObservers();
+}
+
+/** Wait until the notifications queued so far have been delivered. Does not
+ * wait if called by an observer.
+ */
+void AsyncNotificationCenter::flush() {
+  if (std::this_thread::get_id() == m_thread.get_id())
+    return;
+  std::unique_lock<std::mutex> lock(m_mutex);
+  const auto numQueued = m_numQueued;
+  m_delivered.wait(lock, [this, numQueued] {
+    return m_stop || m_numDelivered >= numQueued;
+  });
+}
+
+/// Queue a notification of the source for the dispatching thread
+void AsyncNotificationCenter::enqueue(
+    const Poco::AutoPtr<Poco::Notification> &notification) {
+  if (!m_center.hasObservers())
+    return;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending.push_back(notification);
+    ++m_numQueued;
+  }
+  m_queued.notify_one();
+}
+
+/// Body of the dispatching thread: deliver queued notifications in batches
+void AsyncNotificationCenter::dispatch() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_queued.wait(lock, [this] { return m_stop || !m_pending.empty(); });
+    if (m_stop)
+      return;
+    std::vector<Poco::AutoPtr<Poco::Notification>> batch;
+    batch.swap(m_pending);
+    lock.unlock();
+    for (const auto &notification : batch) {
+      try {
+        m_center.postNotification(notification);
+      } catch (std::exception &e) {
+        g_log.error() << "Observer of " << notification->name()
+                      << " failed: " << e.what() << '\n';
+      }
+    }
+    lock.lock();
+    m_numDelivered += batch.size();
+    m_delivered.notify_all();
+  }
+}
+
+} // namespace Kernel
+} // namespace Mantid
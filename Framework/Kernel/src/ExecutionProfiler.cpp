@@ -0,0 +1,176 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/ExecutionProfiler.h"
+
+#include <json/writer.h>
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// The buffer of the calling thread. There is only one profiler, so a single
+/// pointer per thread is enough.
+thread_local void *t_buffer = nullptr;
+} // namespace
+
+//----------------------------------------------------------------------------------------------
+/** Start recording an event, if the profiler is enabled.
+ * @param category :: category of the event, e.g. "algorithm"
+ * @param name :: name of the event
+ */
+ExecutionProfilerImpl::Span::Span(const char *category, std::string name)
+    : m_active(ExecutionProfiler::Instance().isEnabled()) {
+  if (!m_active)
+    return;
+  m_event.name = std::move(name);
+  m_event.category = category;
+  m_event.start = ExecutionProfiler::Instance().now();
+}
+
+/// Record the event
+ExecutionProfilerImpl::Span::~Span() {
+  if (!m_active)
+    return;
+  auto &profiler = ExecutionProfiler::Instance();
+  m_event.duration = profiler.now() - m_event.start;
+  profiler.record(std::move(m_event));
+}
+
+/** Add a value shown with the event
+ * @param key :: name of the value
+ * @param value :: the value
+ */
+void ExecutionProfilerImpl::Span::addArg(std::string key, double value) {
+  if (m_active)
+    m_event.args.emplace_back(std::move(key), value);
+}
+
+//----------------------------------------------------------------------------------------------
+ExecutionProfilerImpl::ExecutionProfilerImpl()
+    : m_enabled(false), m_epoch(std::chrono::steady_clock::now()) {}
+
+/** Switch recording on or off. Events recorded before are kept.
+ * @param enabled :: true to record events
+ */
+void ExecutionProfilerImpl::setEnabled(bool enabled) {
+  m_enabled.store(enabled);
+}
+
+/** Add an event to the buffer of the calling thread. The thread of the event
+ * is set to the calling thread.
+ * @param event :: the event
+ */
+void ExecutionProfilerImpl::record(Event event) {
+  auto &buffer = threadBuffer();
+  event.thread = buffer.thread;
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+  buffer.events.push_back(std::move(event));
+}
+
+/// Discard all recorded events
+void ExecutionProfilerImpl::clear() {
+  std::lock_guard<std::mutex> lock(m_buffersMutex);
+  for (auto &buffer : m_buffers) {
+    std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+    buffer->events.clear();
+  }
+}
+
+/// @return the number of microseconds since the profiler was created
+int64_t ExecutionProfilerImpl::now() const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - m_epoch)
+      .count();
+}
+
+/// @return the events of all threads, sorted by start time
+std::vector<ExecutionProfilerImpl::Event>
+ExecutionProfilerImpl::events() const {
+  std::vector<Event> events;
+  {
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    for (const auto &buffer : m_buffers) {
+      std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+      // An event is recorded after the events it encloses, so reversing the
+      // order of each thread keeps it first when times cannot tell them apart
+      events.insert(events.end(), buffer->events.rbegin(),
+                    buffer->events.rend());
+    }
+  }
+  // Enclosing events first, so that viewers nest them correctly
+  std::stable_sort(events.begin(), events.end(),
+                   [](const Event &a, const Event &b) {
+                     return a.start < b.start ||
+                            (a.start == b.start && a.duration > b.duration);
+                   });
+  return events;
+}
+
+/** @return the recorded events in the Chrome trace event format, as complete
+ * ("X") events with times in microseconds
+ */
+::Json::Value ExecutionProfilerImpl::toChromeTrace() const {
+  ::Json::Value traceEvents(::Json::arrayValue);
+  for (const auto &event : events()) {
+    ::Json::Value item;
+    item["name"] = event.name;
+    item["cat"] = event.category;
+    item["ph"] = "X";
+    item["ts"] = static_cast<::Json::Int64>(event.start);
+    item["dur"] = static_cast<::Json::Int64>(event.duration);
+    item["pid"] = 0;
+    item["tid"] = static_cast<::Json::UInt64>(event.thread);
+    if (!event.args.empty()) {
+      ::Json::Value args(::Json::objectValue);
+      for (const auto &arg : event.args)
+        args[arg.first] = arg.second;
+      item["args"] = args;
+    }
+    traceEvents.append(item);
+  }
+  ::Json::Value trace;
+  trace["traceEvents"] = traceEvents;
+  trace["displayTimeUnit"] = "ms";
+  return trace;
+}
+
+/** Write the recorded events to a Chrome trace file
+ * @param filename :: path of the JSON file to write
+ * @throws std::runtime_error if the file cannot be written
+ */
+void ExecutionProfilerImpl::saveChromeTrace(const std::string &filename) const {
+  std::ofstream file(filename);
+  if (!file)
+    throw std::runtime_error("Cannot open trace file " + filename);
+  ::Json::FastWriter writer;
+  file << writer.write(toChromeTrace());
+}
+
+/// @return the CPU time used by the process so far, in seconds
+double ExecutionProfilerImpl::processCPUTime() {
+  return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+/// @return the buffer of the calling thread, creating it on first use
+ExecutionProfilerImpl::ThreadBuffer &ExecutionProfilerImpl::threadBuffer() {
+  if (!t_buffer) {
+    auto buffer = std::make_shared<ThreadBuffer>();
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    buffer->thread = m_buffers.size();
+    m_buffers.push_back(buffer);
+    t_buffer = buffer.get();
+  }
+  return *static_cast<ThreadBuffer *>(t_buffer);
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -0,0 +1,191 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/FFTService.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/make_unique.h"
+
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_real.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// The scratch space of the transforms of the calling thread
+gsl_fft_real_workspace *scratch(const size_t size) {
+  thread_local std::unique_ptr<gsl_fft_real_workspace,
+                               decltype(&gsl_fft_real_workspace_free)>
+      workspace(nullptr, &gsl_fft_real_workspace_free);
+  if (!workspace || workspace->n != size)
+    workspace.reset(gsl_fft_real_workspace_alloc(size));
+  return workspace.get();
+}
+
+/// Calls transform(data + i * size) for count arrays of size values. The
+/// first exception thrown by a transform is rethrown once all have run.
+template <class Transform>
+void transformAll(double *data, const size_t size, const size_t count,
+                  const bool runParallel, const Transform &transform) {
+  const auto n = static_cast<int64_t>(count);
+  std::exception_ptr exception;
+  PARALLEL_FOR_IF(runParallel && n > 1)
+  for (int64_t i = 0; i < n; ++i) {
+    try {
+      transform(data + static_cast<size_t>(i) * size);
+    } catch (...) {
+      PARALLEL_CRITICAL(FFTService_exception) {
+        if (!exception)
+          exception = std::current_exception();
+      }
+    }
+  }
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+/// Applies op(aRe, aIm, bRe, bIm, outRe, outIm) to all frequencies of the
+/// half-complex arrays a and b
+template <class Op>
+void forEachFrequency(const double *a, const double *b, double *out,
+                      const size_t size, const Op &op) {
+  if (size == 0)
+    return;
+  double im(0.);
+  op(a[0], 0., b[0], 0., out[0], im);
+  for (size_t k = 2; k < size; k += 2)
+    op(a[k - 1], a[k], b[k - 1], b[k], out[k - 1], out[k]);
+  if (size % 2 == 0)
+    op(a[size - 1], 0., b[size - 1], 0., out[size - 1], im);
+}
+
+/// Plans are only dropped from the cache if it gets larger than this
+constexpr size_t maxCachedPlans = 64;
+} // namespace
+
+/// The wavetables of the forward and inverse transforms
+struct RealFFTPlan::Wavetables {
+  explicit Wavetables(const size_t size)
+      : real(gsl_fft_real_wavetable_alloc(size)),
+        halfComplex(gsl_fft_halfcomplex_wavetable_alloc(size)) {}
+  ~Wavetables() {
+    gsl_fft_halfcomplex_wavetable_free(halfComplex);
+    gsl_fft_real_wavetable_free(real);
+  }
+  gsl_fft_real_wavetable *real;
+  gsl_fft_halfcomplex_wavetable *halfComplex;
+};
+
+/** Constructor
+ * @param size :: the number of values of the transformed data
+ * @throws std::invalid_argument if size is 0
+ */
+RealFFTPlan::RealFFTPlan(const size_t size) : m_size(size) {
+  if (size == 0)
+    throw std::invalid_argument("RealFFTPlan: the size must be positive");
+  m_wavetables = make_unique<Wavetables>(size);
+}
+
+// Defined here, where Wavetables is a complete type
+RealFFTPlan::~RealFFTPlan() = default;
+
+/// Transforms size() values to half-complex order in place
+void RealFFTPlan::forward(double *data) const {
+  gsl_fft_real_transform(data, 1, m_size, m_wavetables->real, scratch(m_size));
+}
+
+/// Transforms size() values in half-complex order back to real values
+void RealFFTPlan::inverse(double *data) const {
+  gsl_fft_halfcomplex_inverse(data, 1, m_size, m_wavetables->halfComplex,
+                              scratch(m_size));
+}
+
+/** Transforms count arrays, stored one after another, in place
+ * @param data :: count * size() values
+ * @param count :: the number of arrays
+ * @param runParallel :: whether to transform the arrays on several threads
+ */
+void RealFFTPlan::forward(double *data, const size_t count,
+                          const bool runParallel) const {
+  transformAll(data, m_size, count, runParallel,
+               [this](double *values) { forward(values); });
+}
+
+/** Transforms count arrays in half-complex order, stored one after another,
+ * back to real values in place
+ * @param data :: count * size() values
+ * @param count :: the number of arrays
+ * @param runParallel :: whether to transform the arrays on several threads
+ */
+void RealFFTPlan::inverse(double *data, const size_t count,
+                          const bool runParallel) const {
+  transformAll(data, m_size, count, runParallel,
+               [this](double *values) { inverse(values); });
+}
+
+namespace FFTService {
+
+/** The plan for transforms of the given number of values, created on the
+ * first request and shared by all later ones
+ * @param size :: the number of values of the transformed data
+ * @return the plan
+ */
+std::shared_ptr<const RealFFTPlan> plan(const size_t size) {
+  static std::mutex mutex;
+  static std::unordered_map<size_t, std::shared_ptr<const RealFFTPlan>> plans;
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto cached = plans.find(size);
+  if (cached != plans.end())
+    return cached->second;
+  // Plans still in use stay alive through their other owners
+  if (plans.size() >= maxCachedPlans)
+    plans.clear();
+  auto created = std::make_shared<const RealFFTPlan>(size);
+  plans.emplace(size, created);
+  return created;
+}
+
+size_t fastSize(const size_t size) {
+  for (size_t candidate = std::max(size, size_t(1));; ++candidate) {
+    size_t rest = candidate;
+    for (const size_t factor : {2, 3, 5})
+      while (rest % factor == 0)
+        rest /= factor;
+    if (rest == 1)
+      return candidate;
+  }
+}
+
+void multiply(const double *a, const double *b, double *out,
+              const size_t size) {
+  forEachFrequency(a, b, out, size,
+                   [](const double aRe, const double aIm, const double bRe,
+                      const double bIm, double &outRe, double &outIm) {
+                     outRe = aRe * bRe - aIm * bIm;
+                     outIm = aRe * bIm + aIm * bRe;
+                   });
+}
+
+void multiplyConjugate(const double *a, const double *b, double *out,
+                       const size_t size) {
+  forEachFrequency(a, b, out, size,
+                   [](const double aRe, const double aIm, const double bRe,
+                      const double bIm, double &outRe, double &outIm) {
+                     outRe = aRe * bRe + aIm * bIm;
+                     outIm = aRe * bIm - aIm * bRe;
+                   });
+}
+
+} // namespace FFTService
+} // namespace Kernel
+} // namespace Mantid
@@ -12,6 +12,7 @@
 #include "MantidKernel/Property.h"
 #include "MantidKernel/PropertyManager.h"
 #include <algorithm>
+#include <boost/make_shared.hpp>
 #include <json/json.h>
 
 namespace Mantid {
@@ -37,6 +38,15 @@ operator=(const PropertyManagerOwner &po) {
   return *this;
 }
 
+/** Replace the properties by copies of the properties of another owner.
+ * Unlike copyPropertiesFrom, changing the properties of one owner afterwards
+ * does not change those of the other.
+ * @param po :: the owner whose properties are copied
+ */
+void PropertyManagerOwner::clonePropertiesFrom(const PropertyManagerOwner &po) {
+  m_properties = boost::make_shared<PropertyManager>(*po.m_properties);
+}
+
 /** Add a property to the list of managed properties
  *  @param p :: The property object to add
  *  @param doc :: A description of the property that may be displayed to users
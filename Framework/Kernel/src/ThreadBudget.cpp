@@ -0,0 +1,196 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/ThreadBudget.h"
+#include "MantidKernel/ExecutionProfiler.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// Total number of threads; 0 until first used
+std::atomic<size_t> g_capacity{0};
+/// Threads handed out by reservations, excluding the threads making them
+std::atomic<size_t> g_reserved{0};
+/// Limit on the threads of regions opened by this thread; 0 for none
+thread_local size_t g_threadLimit = 0;
+
+/// @return true if OpenMP would run a region opened by the calling thread in
+/// that thread only, because it is nested inside as many active regions as
+/// OpenMP allows
+bool nestingExhausted() {
+#ifdef _OPENMP
+  return omp_get_active_level() >= omp_get_max_active_levels();
+#else
+  return false;
+#endif
+}
+} // namespace
+
+/// @return the number of threads the framework may run at once. Defaults to
+/// the number of OpenMP threads.
+size_t ThreadBudget::capacity() {
+  size_t capacity = g_capacity.load();
+  if (capacity == 0) {
+    const auto numThreads =
+        static_cast<size_t>(std::max(PARALLEL_GET_MAX_THREADS, 1));
+    g_capacity.compare_exchange_strong(capacity, numThreads);
+    capacity = g_capacity.load();
+  }
+  return capacity;
+}
+
+/** Set the number of threads the framework may run at once. Reservations
+ * made before keep their threads.
+ * @param numThreads :: the new capacity; at least 1 is used
+ */
+void ThreadBudget::setCapacity(size_t numThreads) {
+  g_capacity.store(std::max(numThreads, size_t(1)));
+}
+
+/// @return the number of threads that can be reserved in addition to the
+/// calling one
+size_t ThreadBudget::available() {
+  const size_t capacity = ThreadBudget::capacity();
+  const size_t reserved = g_reserved.load();
+  return reserved + 1 >= capacity ? 0 : capacity - 1 - reserved;
+}
+
+/// @return the limit on the threads of regions opened by the calling thread,
+/// or 0 if there is none
+size_t ThreadBudget::threadLimit() { return g_threadLimit; }
+
+//----------------------------------------------------------------------------------------------
+/** Reserve threads for an OpenMP parallel region. Asks for as many threads as
+ * OpenMP would use, since per-thread buffers are often sized with
+ * PARALLEL_GET_MAX_THREADS. Nothing is reserved for a region that OpenMP
+ * would serialise anyway because it is nested inside another active one.
+ * @param parallel :: if false, no threads are reserved and the region runs
+ *        in the calling thread only
+ */
+ThreadBudget::Reservation::Reservation(bool parallel)
+    : Reservation(std::min(capacity(), static_cast<size_t>(std::max(
+                                           PARALLEL_GET_MAX_THREADS, 1))),
+                  parallel && !nestingExhausted()) {}
+
+/** Reserve threads for an OpenMP parallel region, and record the region with
+ * the ExecutionProfiler if it is enabled.
+ * @param parallel :: if false, no threads are reserved
+ * @param file :: source file of the region
+ * @param line :: source line of the region
+ */
+ThreadBudget::Reservation::Reservation(bool parallel, const char *file,
+                                       int line)
+    : Reservation(parallel) {
+  if (ExecutionProfiler::Instance().isEnabled())
+    startProfiling(file, line);
+}
+
+/** Reserve threads, taking as many as possible up to numThreads.
+ * @param numThreads :: the number of threads wanted, including the calling
+ *        thread
+ * @param parallel :: if false, no threads are reserved
+ */
+ThreadBudget::Reservation::Reservation(size_t numThreads, bool parallel)
+    : m_extraThreads(0), m_entered(false) {
+  if (!parallel || numThreads <= 1)
+    return;
+  size_t wanted = numThreads - 1;
+  if (g_threadLimit > 0)
+    wanted = std::min(wanted, g_threadLimit - 1);
+  if (wanted == 0)
+    return;
+
+  const size_t capacity = ThreadBudget::capacity();
+  size_t reserved = g_reserved.load();
+  size_t granted;
+  do {
+    const size_t available =
+        reserved + 1 >= capacity ? 0 : capacity - 1 - reserved;
+    granted = std::min(wanted, available);
+    if (granted == 0)
+      return;
+  } while (!g_reserved.compare_exchange_weak(reserved, reserved + granted));
+  m_extraThreads = granted;
+}
+
+/// Return the reserved threads to the budget
+ThreadBudget::Reservation::~Reservation() {
+  if (m_extraThreads > 0)
+    g_reserved.fetch_sub(m_extraThreads);
+  if (!m_file)
+    return;
+
+  auto &profiler = ExecutionProfiler::Instance();
+  ExecutionProfilerImpl::Event event;
+  event.start = m_start;
+  event.duration = profiler.now() - m_start;
+  const std::string file(m_file);
+  event.name = file.substr(file.find_last_of("/\\") + 1) + ":" +
+               std::to_string(m_line);
+  event.category = "parallel";
+  const double threads = static_cast<double>(numThreads());
+  event.args.emplace_back("threads", threads);
+  if (event.duration > 0) {
+    const double wallSeconds = static_cast<double>(event.duration) * 1e-6;
+    const double cpuSeconds =
+        ExecutionProfilerImpl::processCPUTime() - m_cpuStart;
+    event.args.emplace_back("utilisation", cpuSeconds / (wallSeconds * threads));
+  }
+  profiler.record(std::move(event));
+}
+
+/** Start timing the region. Serial regions inside another parallel region
+ * are part of an enclosing one and are not recorded separately.
+ * @param file :: source file of the region
+ * @param line :: source line of the region
+ */
+void ThreadBudget::Reservation::startProfiling(const char *file, int line) {
+  if (!parallel() && PARALLEL_NUMBER_OF_THREADS > 1)
+    return;
+  m_file = file;
+  m_line = line;
+  m_start = ExecutionProfiler::Instance().now();
+  m_cpuStart = ExecutionProfilerImpl::processCPUTime();
+}
+
+//----------------------------------------------------------------------------------------------
+/** Cap the threads of regions opened by the calling thread.
+ * @param maxThreads :: maximum number of threads including the calling one;
+ *        0 for no limit (beyond any limit already in place)
+ */
+ThreadBudget::Limit::Limit(size_t maxThreads) : m_previous(g_threadLimit) {
+  if (maxThreads > 0 && (g_threadLimit == 0 || maxThreads < g_threadLimit))
+    g_threadLimit = maxThreads;
+}
+
+/// Restore the previous limit
+ThreadBudget::Limit::~Limit() { g_threadLimit = m_previous; }
+
+//----------------------------------------------------------------------------------------------
+/// Record the limit of the calling thread
+ThreadBudget::InheritedLimit::InheritedLimit()
+    : m_limit(g_threadLimit), m_previous(g_threadLimit), m_entered(false) {}
+
+/** Apply the recorded limit in the calling thread, which replaces any limit
+ * left over from earlier work of a pooled thread.
+ * @param other :: the object recording the limit
+ */
+ThreadBudget::InheritedLimit::InheritedLimit(const InheritedLimit &other)
+    : m_limit(other.m_limit), m_previous(g_threadLimit), m_entered(false) {
+  g_threadLimit = m_limit;
+}
+
+/// Restore the limit the calling thread had before
+ThreadBudget::InheritedLimit::~InheritedLimit() { g_threadLimit = m_previous; }
+
+} // namespace Kernel
+} // namespace Mantid
@@ -14,6 +14,7 @@
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
 #include "MantidKernel/ThreadPoolRunnable.h"
+#include "MantidKernel/make_unique.h"
 
 #include <Poco/Thread.h>
 
@@ -109,10 +110,17 @@ void ThreadPool::start(double waitSec) {
   for (auto &runnable : m_runnables)
     delete runnable;
 
+  // Take the threads from the framework-wide budget, so that a pool started
+  // from within a parallel region does not oversubscribe the cores.
+  m_reservation.reset();
+  m_reservation =
+      Kernel::make_unique<ThreadBudget::Reservation>(m_numThreads, true);
+  const auto numThreads = static_cast<size_t>(m_reservation->numThreads());
+
   // Now, launch that many threads and let them wait for new tasks.
   m_threads.clear();
   m_runnables.clear();
-  for (size_t i = 0; i < m_numThreads; i++) {
+  for (size_t i = 0; i < numThreads; i++) {
     // Make a descriptive name
     std::ostringstream name;
     name << "Thread" << i;
@@ -121,7 +129,8 @@ void ThreadPool::start(double waitSec) {
     m_threads.push_back(thread);
 
     // Make the runnable object and run it
-    auto runnable = new ThreadPoolRunnable(i, m_scheduler, m_prog, waitSec);
+    auto runnable = new ThreadPoolRunnable(i, m_scheduler, m_prog, waitSec,
+                                           ThreadBudget::threadLimit());
     m_runnables.push_back(runnable);
 
     thread->start(*runnable);
@@ -195,6 +204,9 @@ void ThreadPool::joinAll() {
     delete runnable;
   m_runnables.clear();
 
+  // Give the threads back to the budget
+  m_reservation.reset();
+
   // This will make threads restart
   m_started = false;
 
@@ -5,8 +5,10 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidKernel/ThreadPoolRunnable.h"
+#include "MantidKernel/ExecutionProfiler.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/ThreadScheduler.h"
 
 #include <Poco/Thread.h>
@@ -24,12 +26,16 @@ namespace Kernel {
  *        automatic progress reporting will be handled by the thread pool.
  * @param waitSec :: how many seconds the thread is allowed to wait with no
  *tasks.
+ * @param threadLimit :: ThreadBudget limit on the threads of parallel regions
+ *        opened by the tasks, usually that of the thread starting the pool;
+ *        0 for none
  */
 ThreadPoolRunnable::ThreadPoolRunnable(size_t threadnum,
                                        ThreadScheduler *scheduler,
-                                       ProgressBase *prog, double waitSec)
+                                       ProgressBase *prog, double waitSec,
+                                       size_t threadLimit)
     : m_threadnum(threadnum), m_scheduler(scheduler), m_prog(prog),
-      m_waitSec(waitSec) {
+      m_waitSec(waitSec), m_threadLimit(threadLimit) {
   if (!m_scheduler)
     throw std::invalid_argument(
         "NULL ThreadScheduler passed to ThreadPoolRunnable::ctor()");
@@ -44,6 +50,7 @@ void ThreadPoolRunnable::clearWait() { m_waitSec = 0.0; }
  * as scheduled to it.
  */
 void ThreadPoolRunnable::run() {
+  ThreadBudget::Limit limit(m_threadLimit);
   Task *task;
 
   // If there are no tasks yet, wait up to m_waitSec for them to come up
@@ -65,6 +72,8 @@ void ThreadPoolRunnable::run() {
 
       try {
         // Run the task (synchronously within this thread)
+        ExecutionProfilerImpl::Span span("task", "Task");
+        span.addArg("cost", task->cost());
         task->run();
       } catch (std::exception &e) {
         // The task threw an exception!
@@ -0,0 +1,241 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/make_unique.h"
+
+#include <algorithm>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// The scheduler whose task the calling thread is running, if any
+thread_local const ThreadSchedulerWorkStealing *currentScheduler = nullptr;
+/// The queue owned by the calling thread in currentScheduler
+thread_local size_t currentQueue = 0;
+
+/// Atomically add value to an atomic double
+void addTo(std::atomic<double> &total, const double value) {
+  double old = total.load(std::memory_order_relaxed);
+  while (!total.compare_exchange_weak(old, old + value,
+                                      std::memory_order_relaxed)) {
+  }
+}
+} // namespace
+
+//-------------------------------------------------------------------------------
+/** Constructor
+ * @param numQueues :: number of per-thread queues; default = 0, meaning one
+ *        per physical core as for ThreadPool. Threads with a number larger
+ *        than this share queues.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numQueues)
+    : ThreadScheduler() {
+  if (numQueues == 0)
+    numQueues = std::max(ThreadPool::getNumPhysicalCores(), size_t(1));
+  m_queues.reserve(numQueues);
+  for (size_t i = 0; i < numQueues; ++i)
+    m_queues.push_back(Kernel::make_unique<WorkQueue>());
+}
+
+/// Destructor. Deletes any tasks left in the queues.
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() { clear(); }
+
+//-------------------------------------------------------------------------------
+/** Add a Task. If called while running a Task popped from this scheduler,
+ * i.e. between pop() and finished(), the new Task goes to the queue of the
+ * calling thread; otherwise the queues are filled in turn.
+ * @param newTask :: Task to add
+ */
+void ThreadSchedulerWorkStealing::push(Task *newTask) {
+  size_t queue;
+  if (currentScheduler == this)
+    queue = currentQueue;
+  else
+    queue = m_nextQueue.fetch_add(1, std::memory_order_relaxed);
+  pushTo(*m_queues[queue % m_queues.size()], newTask);
+}
+
+//-------------------------------------------------------------------------------
+/** Retrieves the next Task to execute: the newest Task in the queue of the
+ * calling thread, or else one stolen from the most loaded other queue.
+ * @param threadnum :: ID of the calling thread.
+ * @return a Task pointer to execute, or nullptr if no Task was found.
+ */
+Task *ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  const size_t own = threadnum % m_queues.size();
+  Task *task = popLocal(*m_queues[own]);
+  if (!task)
+    task = steal(own);
+  // Remember which queue tasks pushed while running this one should go to
+  currentScheduler = task ? this : nullptr;
+  currentQueue = own;
+  return task;
+}
+
+//-------------------------------------------------------------------------------
+/** Signal that a popped task is complete.
+ * @param task :: the Task that was completed.
+ * @param threadnum :: Thread ID that ran the task
+ */
+void ThreadSchedulerWorkStealing::finished(Task *task, size_t threadnum) {
+  addTo(m_queues[threadnum % m_queues.size()]->costExecuted, task->cost());
+  currentScheduler = nullptr;
+  m_numRunning.fetch_sub(1);
+}
+
+//-------------------------------------------------------------------------------
+/// @return the number of tasks waiting in all queues
+size_t ThreadSchedulerWorkStealing::size() { return m_numQueued.load(); }
+
+/// @return true if no task is waiting or still running
+bool ThreadSchedulerWorkStealing::empty() {
+  // A popped task is counted as running before it stops being queued, so
+  // reading the counters in this order never misses it.
+  return m_numQueued.load() == 0 && m_numRunning.load() == 0;
+}
+
+//-------------------------------------------------------------------------------
+/// Empty out all queues, deleting the tasks
+void ThreadSchedulerWorkStealing::clear() {
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    for (auto task : queue->tasks)
+      delete task;
+    m_numQueued.fetch_sub(queue->tasks.size());
+    queue->tasks.clear();
+    queue->size.store(0);
+    queue->cost.store(0.0);
+    queue->costPushed.store(0.0);
+    queue->costExecuted.store(0.0);
+  }
+}
+
+//-------------------------------------------------------------------------------
+/// @return the total cost of all tasks pushed
+double ThreadSchedulerWorkStealing::totalCost() {
+  double total = 0.0;
+  for (const auto &queue : m_queues)
+    total += queue->costPushed.load();
+  return total;
+}
+
+/// @return the total cost of all tasks that have finished
+double ThreadSchedulerWorkStealing::totalCostExecuted() {
+  double total = 0.0;
+  for (const auto &queue : m_queues)
+    total += queue->costExecuted.load();
+  return total;
+}
+
+//-------------------------------------------------------------------------------
+/** @param queue :: index of a queue
+ * @return the number of tasks in that queue
+ */
+size_t ThreadSchedulerWorkStealing::queueSize(size_t queue) const {
+  return m_queues.at(queue)->size.load();
+}
+
+//-------------------------------------------------------------------------------
+/// Append a task to a queue
+void ThreadSchedulerWorkStealing::pushTo(WorkQueue &queue, Task *task) {
+  const double cost = task->cost();
+  std::lock_guard<std::mutex> lock(queue.lock);
+  queue.tasks.push_back(task);
+  queue.size.store(queue.tasks.size());
+  queue.cost.store(queue.cost.load() + cost);
+  queue.costPushed.store(queue.costPushed.load() + cost);
+  m_numQueued.fetch_add(1);
+}
+
+//-------------------------------------------------------------------------------
+/// Take the newest task from a queue, or nullptr if it is empty
+Task *ThreadSchedulerWorkStealing::popLocal(WorkQueue &queue) {
+  std::lock_guard<std::mutex> lock(queue.lock);
+  if (queue.tasks.empty())
+    return nullptr;
+  Task *task = queue.tasks.back();
+  queue.tasks.pop_back();
+  queue.size.store(queue.tasks.size());
+  queue.cost.store(queue.tasks.empty() ? 0.0
+                                       : queue.cost.load() - task->cost());
+  m_numRunning.fetch_add(1);
+  m_numQueued.fetch_sub(1);
+  return task;
+}
+
+//-------------------------------------------------------------------------------
+/** Steal work for the queue of thread thief from the queue holding the
+ * largest cost (or the most tasks, if costs are equal). Up to half of the
+ * victim's cost is taken from the old end of its queue; the first stolen task
+ * is returned and the others go to the thief's queue.
+ * @param thief :: index of the queue of the calling thread
+ * @return a Task to execute, or nullptr if there was nothing to steal.
+ */
+Task *ThreadSchedulerWorkStealing::steal(size_t thief) {
+  std::vector<Task *> stolen;
+  double stolenCost = 0.0;
+  // The loads below are unsynchronised, so the chosen victim may have been
+  // emptied in the meantime; try again as long as there is work anywhere.
+  for (size_t attempt = 0;
+       attempt < m_queues.size() && stolen.empty() && m_numQueued.load() > 0;
+       ++attempt) {
+    size_t victim = thief;
+    double victimCost = 0.0;
+    size_t victimSize = 0;
+    for (size_t i = 0; i < m_queues.size(); ++i) {
+      if (i == thief)
+        continue;
+      const size_t size = m_queues[i]->size.load(std::memory_order_relaxed);
+      if (size == 0)
+        continue;
+      const double cost = m_queues[i]->cost.load(std::memory_order_relaxed);
+      if (victim == thief || cost > victimCost ||
+          (cost == victimCost && size > victimSize)) {
+        victim = i;
+        victimCost = cost;
+        victimSize = size;
+      }
+    }
+    if (victim == thief)
+      return nullptr;
+
+    WorkQueue &queue = *m_queues[victim];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (queue.tasks.empty())
+      continue;
+    const double targetCost = 0.5 * queue.cost.load();
+    const size_t maxTasks = (queue.tasks.size() + 1) / 2;
+    do {
+      Task *task = queue.tasks.front();
+      queue.tasks.pop_front();
+      stolen.push_back(task);
+      stolenCost += task->cost();
+    } while (stolen.size() < maxTasks &&
+             (targetCost <= 0.0 || stolenCost < targetCost));
+    queue.size.store(queue.tasks.size());
+    queue.cost.store(queue.tasks.empty() ? 0.0
+                                         : queue.cost.load() - stolenCost);
+    m_numRunning.fetch_add(1);
+    m_numQueued.fetch_sub(1);
+  }
+  if (stolen.empty())
+    return nullptr;
+
+  if (stolen.size() > 1) {
+    WorkQueue &queue = *m_queues[thief];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    queue.tasks.insert(queue.tasks.end(), stolen.begin() + 1, stolen.end());
+    queue.size.store(queue.tasks.size());
+    queue.cost.store(queue.cost.load() + stolenCost - stolen.front()->cost());
+  }
+  return stolen.front();
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -144,9 +144,7 @@ void Unit::toTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                  const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleToTOF(xdata[i]);
+  this->arrayToTOF(xdata.data(), xdata.data(), xdata.size());
 }
 
 /** Convert a single value to TOF
@@ -175,9 +173,7 @@ void Unit::fromTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                    const double &_efixed, const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleFromTOF(xdata[i]);
+  this->arrayFromTOF(xdata.data(), xdata.data(), xdata.size());
 }
 
 /** Convert a single value from TOF
@@ -204,6 +200,50 @@ std::pair<double, double> Unit::conversionRange() const {
   return std::pair<double, double>(std::min(u1, u2), std::max(u1, u2));
 }
 
+void Unit::arrayToTOF(const double *x, double *tof, const size_t size) const {
+  for (size_t i = 0; i < size; ++i)
+    tof[i] = this->singleToTOF(x[i]);
+}
+
+void Unit::arrayFromTOF(const double *tof, double *x, const size_t size) const {
+  for (size_t i = 0; i < size; ++i)
+    x[i] = this->singleFromTOF(tof[i]);
+}
+
+bool Unit::toTOFPowerLaw(double &, double &) const { return false; }
+
+bool Unit::fromTOFPowerLaw(double &, double &) const { return false; }
+
+namespace {
+/// Convert to TOF with the singleToTOF() of the concrete unit U. Called
+/// non-virtually it is inlined into the loop.
+template <class U>
+void convertToTOF(const U &unit, const double *x, double *tof,
+                  const size_t size) {
+  for (size_t i = 0; i < size; ++i)
+    tof[i] = unit.U::singleToTOF(x[i]);
+}
+
+/// Convert from TOF with the singleFromTOF() of the concrete unit U
+template <class U>
+void convertFromTOF(const U &unit, const double *tof, double *x,
+                    const size_t size) {
+  for (size_t i = 0; i < size; ++i)
+    x[i] = unit.U::singleFromTOF(tof[i]);
+}
+} // namespace
+
+/// Define arrayToTOF() and arrayFromTOF() of a concrete unit
+#define DEFINE_ARRAY_CONVERSIONS(classname)                                    \
+  void classname::arrayToTOF(const double *x, double *tof,                     \
+                             const size_t size) const {                        \
+    convertToTOF(*this, x, tof, size);                                         \
+  }                                                                            \
+  void classname::arrayFromTOF(const double *tof, double *x,                   \
+                               const size_t size) const {                      \
+    convertFromTOF(*this, tof, x, size);                                       \
+  }
+
 namespace Units {
 
 /* =============================================================================
@@ -293,6 +333,18 @@ double TOF::singleFromTOF(const double tof) const {
   return tof;
 }
 
+DEFINE_ARRAY_CONVERSIONS(TOF)
+
+bool TOF::toTOFPowerLaw(double &factor, double &power) const {
+  factor = 1.;
+  power = 1.;
+  return true;
+}
+
+bool TOF::fromTOFPowerLaw(double &factor, double &power) const {
+  return toTOFPowerLaw(factor, power);
+}
+
 Unit *TOF::clone() const { return new TOF(*this); }
 double TOF::conversionTOFMin() const { return -DBL_MAX; }
 ///@return DBL_MAX as ToF convetanble to TOF for in any time range
@@ -421,6 +473,25 @@ double Wavelength::conversionTOFMax() const {
   return max_tof;
 }
 
+DEFINE_ARRAY_CONVERSIONS(Wavelength)
+
+bool Wavelength::toTOFPowerLaw(double &factor, double &power) const {
+  // Not for the offset added in the inelastic modes
+  if (emode == 1 || emode == 2)
+    return false;
+  factor = factorTo;
+  power = 1.;
+  return true;
+}
+
+bool Wavelength::fromTOFPowerLaw(double &factor, double &power) const {
+  if (do_sfpFrom)
+    return false;
+  factor = factorFrom;
+  power = 1.;
+  return true;
+}
+
 Unit *Wavelength::clone() const { return new Wavelength(*this); }
 
 // ============================================================================================
@@ -477,6 +548,20 @@ double Energy::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+DEFINE_ARRAY_CONVERSIONS(Energy)
+
+bool Energy::toTOFPowerLaw(double &factor, double &power) const {
+  factor = factorTo;
+  power = -0.5;
+  return true;
+}
+
+bool Energy::fromTOFPowerLaw(double &factor, double &power) const {
+  factor = factorFrom;
+  power = -2.;
+  return true;
+}
+
 Unit *Energy::clone() const { return new Energy(*this); }
 
 // ============================================================================================
@@ -586,6 +671,20 @@ double dSpacing::singleFromTOF(const double tof) const {
 double dSpacing::conversionTOFMin() const { return 0; }
 double dSpacing::conversionTOFMax() const { return DBL_MAX / factorTo; }
 
+DEFINE_ARRAY_CONVERSIONS(dSpacing)
+
+bool dSpacing::toTOFPowerLaw(double &factor, double &power) const {
+  factor = factorTo;
+  power = 1.;
+  return true;
+}
+
+bool dSpacing::fromTOFPowerLaw(double &factor, double &power) const {
+  factor = 1. / factorFrom;
+  power = 1.;
+  return true;
+}
+
 Unit *dSpacing::clone() const { return new dSpacing(*this); }
 
 // ==================================================================================================
@@ -699,6 +798,20 @@ double MomentumTransfer::conversionTOFMin() const {
 }
 double MomentumTransfer::conversionTOFMax() const { return DBL_MAX; }
 
+DEFINE_ARRAY_CONVERSIONS(MomentumTransfer)
+
+bool MomentumTransfer::toTOFPowerLaw(double &factor, double &power) const {
+  factor = factorTo;
+  power = -1.;
+  return true;
+}
+
+bool MomentumTransfer::fromTOFPowerLaw(double &factor, double &power) const {
+  factor = factorFrom;
+  power = -1.;
+  return true;
+}
+
 Unit *MomentumTransfer::clone() const { return new MomentumTransfer(*this); }
 
 /* ===================================================================================================
@@ -760,6 +873,20 @@ double QSquared::conversionTOFMax() const {
     return factorTo / sqrt(DBL_MAX);
 }
 
+DEFINE_ARRAY_CONVERSIONS(QSquared)
+
+bool QSquared::toTOFPowerLaw(double &factor, double &power) const {
+  factor = factorTo;
+  power = -0.5;
+  return true;
+}
+
+bool QSquared::fromTOFPowerLaw(double &factor, double &power) const {
+  factor = factorFrom;
+  power = -2.;
+  return true;
+}
+
 Unit *QSquared::clone() const { return new QSquared(*this); }
 
 /* ==============================================================================
@@ -1120,6 +1247,27 @@ double SpinEchoLength::singleFromTOF(const double tof) const {
   return x;
 }
 
+DEFINE_ARRAY_CONVERSIONS(SpinEchoLength)
+
+bool SpinEchoLength::toTOFPowerLaw(double &factor, double &power) const {
+  double wavelengthFactor, wavelengthPower;
+  if (efixed <= 0. ||
+      !Wavelength::toTOFPowerLaw(wavelengthFactor, wavelengthPower))
+    return false;
+  factor = wavelengthFactor / sqrt(efixed);
+  power = 0.5;
+  return true;
+}
+
+bool SpinEchoLength::fromTOFPowerLaw(double &factor, double &power) const {
+  double wavelengthFactor, wavelengthPower;
+  if (!Wavelength::fromTOFPowerLaw(wavelengthFactor, wavelengthPower))
+    return false;
+  factor = efixed * wavelengthFactor * wavelengthFactor;
+  power = 2.;
+  return true;
+}
+
 Unit *SpinEchoLength::clone() const { return new SpinEchoLength(*this); }
 
 // ============================================================================================
@@ -1165,6 +1313,27 @@ double SpinEchoTime::singleFromTOF(const double tof) const {
   return x;
 }
 
+DEFINE_ARRAY_CONVERSIONS(SpinEchoTime)
+
+bool SpinEchoTime::toTOFPowerLaw(double &factor, double &power) const {
+  double wavelengthFactor, wavelengthPower;
+  if (efixed <= 0. ||
+      !Wavelength::toTOFPowerLaw(wavelengthFactor, wavelengthPower))
+    return false;
+  factor = wavelengthFactor / std::cbrt(efixed);
+  power = 1. / 3.;
+  return true;
+}
+
+bool SpinEchoTime::fromTOFPowerLaw(double &factor, double &power) const {
+  double wavelengthFactor, wavelengthPower;
+  if (!Wavelength::fromTOFPowerLaw(wavelengthFactor, wavelengthPower))
+    return false;
+  factor = efixed * wavelengthFactor * wavelengthFactor * wavelengthFactor;
+  power = 3.;
+  return true;
+}
+
 Unit *SpinEchoTime::clone() const { return new SpinEchoTime(*this); }
 
 // ================================================================================
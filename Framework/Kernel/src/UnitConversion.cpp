@@ -61,6 +61,73 @@ double UnitConversion::run(Unit &srcUnit, Unit &destUnit, const double srcValue,
   }
 }
 
+namespace {
+/**
+ * Apply dest = factor * op(src) to the positive source values. The others
+ * are converted through TOF, since units guard zero differently and a power
+ * of a negative value may only be defined for the composed power.
+ */
+template <class Operation>
+void convertPositive(const Unit &srcUnit, const Unit &destUnit,
+                     const double *srcValues, double *destValues,
+                     const size_t size, const double factor, Operation op) {
+  for (size_t i = 0; i < size; ++i) {
+    const double value = srcValues[i];
+    if (value > 0.)
+      destValues[i] = factor * op(value);
+    else
+      destValues[i] = destUnit.singleFromTOF(srcUnit.singleToTOF(value));
+  }
+}
+} // namespace
+
+/**
+ * Convert many values between two units, which must be initialized with the
+ * same parameters. If both conversions through TOF are power laws, they are
+ * composed into a single one and no TOF is computed, otherwise the values are
+ * converted through TOF with the array conversions of the units.
+ * @param srcUnit :: The starting unit
+ * @param destUnit :: The destination unit
+ * @param srcValues :: The values to convert
+ * @param destValues :: The array for the converted values, may be the same as
+ * srcValues
+ * @param size :: The number of values
+ */
+void UnitConversion::run(const Unit &srcUnit, const Unit &destUnit,
+                         const double *srcValues, double *destValues,
+                         const size_t size) {
+  double toFactor, toPower, fromFactor, fromPower;
+  if (srcUnit.toTOFPowerLaw(toFactor, toPower) &&
+      destUnit.fromTOFPowerLaw(fromFactor, fromPower) && toFactor != 0.) {
+    // dest = fromFactor * (toFactor * src^toPower)^fromPower
+    const double factor = fromFactor * std::pow(toFactor, fromPower);
+    const double power = toPower * fromPower;
+    if (std::isfinite(factor) && factor != 0.) {
+      auto convert = [&](auto op) {
+        convertPositive(srcUnit, destUnit, srcValues, destValues, size, factor,
+                        op);
+      };
+      if (power == 1.)
+        convert([](const double x) { return x; });
+      else if (power == -1.)
+        convert([](const double x) { return 1. / x; });
+      else if (power == 2.)
+        convert([](const double x) { return x * x; });
+      else if (power == -2.)
+        convert([](const double x) { return 1. / (x * x); });
+      else if (power == 0.5)
+        convert([](const double x) { return std::sqrt(x); });
+      else if (power == -0.5)
+        convert([](const double x) { return 1. / std::sqrt(x); });
+      else
+        convert([power](const double x) { return std::pow(x, power); });
+      return;
+    }
+  }
+  srcUnit.arrayToTOF(srcValues, destValues, size);
+  destUnit.arrayFromTOF(destValues, destValues, size);
+}
+
 //---------------------------------------------------------------------------------------------
 // Private methods
 //---------------------------------------------------------------------------------------------
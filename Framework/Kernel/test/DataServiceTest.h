@@ -13,6 +13,7 @@
 #include <boost/make_shared.hpp>
 #include <cxxtest/TestSuite.h>
 
+#include <algorithm>
 #include <mutex>
 #include <sstream>
 
@@ -31,6 +32,7 @@ private:
   FakeDataService svc;
 
   int notificationFlag; // A flag to help with testing notifications
+  int asyncNotificationFlag; // Counts notifications delivered asynchronously
   std::vector<int> vector;
   std::mutex m_vectorMutex;
 
@@ -41,6 +43,7 @@ public:
   void setUp() override {
     svc.clear();
     notificationFlag = 0;
+    asyncNotificationFlag = 0;
     ConfigService::Instance().setString("MantidOptions.InvisibleWorkspaces",
                                         "0");
   }
@@ -494,6 +497,56 @@ public:
     TS_ASSERT_EQUALS(*svc.retrieve("item2345"), 2345);
   }
 
+  void test_rename_changing_case_only() {
+    auto one = boost::make_shared<int>(1);
+    svc.add("One", one);
+    svc.rename("One", "ONE");
+    TS_ASSERT_EQUALS(svc.size(), 1);
+    TS_ASSERT_EQUALS(svc.getObjectNames(), std::vector<std::string>{"ONE"});
+    TS_ASSERT_EQUALS(svc.retrieve("one"), one);
+  }
+
+  void test_many_objects_are_listed_in_order() {
+    const int num = 1000;
+    for (int i = 0; i < num; ++i)
+      svc.add("item" + std::to_string(i), boost::make_shared<int>(i));
+    TS_ASSERT_EQUALS(svc.size(), num);
+
+    const auto names = svc.getObjectNames();
+    TS_ASSERT_EQUALS(names.size(), num);
+    TS_ASSERT(std::is_sorted(names.cbegin(), names.cend()));
+    const auto objects = svc.getObjects();
+    TS_ASSERT_EQUALS(objects.size(), num);
+    TS_ASSERT_EQUALS(*objects.front(), 0);
+    TS_ASSERT_EQUALS(*objects.back(), 999);
+
+    for (int i = 0; i < num; i += 2)
+      svc.rename("item" + std::to_string(i), "ITEM" + std::to_string(i + 1));
+    TS_ASSERT_EQUALS(svc.size(), num / 2);
+    TS_ASSERT_EQUALS(*svc.retrieve("item1"), 0);
+    TS_ASSERT(!svc.doesExist("item0"));
+  }
+
+  void handleAsyncAddNotification(
+      const Poco::AutoPtr<FakeDataService::AddNotification> &) {
+    ++asyncNotificationFlag;
+  }
+
+  void test_asyncNotificationCenter() {
+    Poco::NObserver<DataServiceTest, FakeDataService::AddNotification> observer(
+        *this, &DataServiceTest::handleAsyncAddNotification);
+    svc.asyncNotificationCenter.addObserver(observer);
+    svc.add("one", boost::make_shared<int>(1));
+    svc.add("two", boost::make_shared<int>(2));
+    svc.asyncNotificationCenter.flush();
+    TS_ASSERT_EQUALS(asyncNotificationFlag, 2);
+    svc.asyncNotificationCenter.removeObserver(observer);
+    TS_ASSERT(!svc.asyncNotificationCenter.hasObservers());
+    svc.add("three", boost::make_shared<int>(3));
+    svc.asyncNotificationCenter.flush();
+    TS_ASSERT_EQUALS(asyncNotificationFlag, 2);
+  }
+
   void test_prefixToHide() {
     TS_ASSERT_EQUALS(FakeDataService::prefixToHide(), "__");
   }
@@ -528,4 +581,57 @@ public:
   }
 };
 
+class DataServiceTestPerformance : public CxxTest::TestSuite {
+public:
+  static DataServiceTestPerformance *createSuite() {
+    return new DataServiceTestPerformance();
+  }
+  static void destroySuite(DataServiceTestPerformance *suite) {
+    delete suite;
+  }
+
+  DataServiceTestPerformance() {
+    for (int i = 0; i < NUM_OBJECTS; ++i)
+      svc.add("object" + std::to_string(i), boost::make_shared<int>(i));
+  }
+
+  void test_concurrent_retrieve() {
+    int64_t total(0);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 1000000; ++i) {
+      const auto name = "object" + std::to_string(i % NUM_OBJECTS);
+      const int value = *svc.retrieve(name);
+      PARALLEL_ATOMIC
+      total += value;
+    }
+    TS_ASSERT_LESS_THAN(0, total);
+  }
+
+  void test_concurrent_retrieve_while_adding() {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 200000; ++i) {
+      if (i % 100 == 0) {
+        const std::string name = "added" + std::to_string(i);
+        svc.addOrReplace(name, boost::make_shared<int>(i));
+        svc.remove(name);
+      } else {
+        TS_ASSERT(svc.doesExist("object" + std::to_string(i % NUM_OBJECTS)));
+      }
+    }
+  }
+
+  void test_bulk_add() {
+    FakeDataService bulk;
+    const int numObjects = 200000;
+    for (int i = 0; i < numObjects; ++i)
+      bulk.add("bulk" + std::to_string(i), boost::make_shared<int>(i));
+    TS_ASSERT_EQUALS(bulk.size(), numObjects);
+    bulk.clear();
+  }
+
+private:
+  static constexpr int NUM_OBJECTS = 10000;
+  FakeDataService svc;
+};
+
 #endif /* MANTID_KERNEL_DATASERVICETEST_H_ */
@@ -0,0 +1,164 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_EXECUTIONPROFILERTEST_H_
+#define MANTID_KERNEL_EXECUTIONPROFILERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/ExecutionProfiler.h"
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/ThreadPool.h"
+
+#include <Poco/File.h>
+#include <Poco/TemporaryFile.h>
+#include <json/reader.h>
+
+#include <fstream>
+
+using Mantid::Kernel::ExecutionProfiler;
+using Mantid::Kernel::ExecutionProfilerImpl;
+
+namespace {
+void doNothing() {}
+} // namespace
+
+class ExecutionProfilerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ExecutionProfilerTest *createSuite() {
+    return new ExecutionProfilerTest();
+  }
+  static void destroySuite(ExecutionProfilerTest *suite) { delete suite; }
+
+  void setUp() override { ExecutionProfiler::Instance().clear(); }
+
+  void tearDown() override {
+    ExecutionProfiler::Instance().setEnabled(false);
+    ExecutionProfiler::Instance().clear();
+  }
+
+  void test_nothing_is_recorded_when_disabled() {
+    TS_ASSERT(!ExecutionProfiler::Instance().isEnabled());
+    {
+      ExecutionProfilerImpl::Span span("test", "span");
+      TS_ASSERT(!span.active());
+      span.addArg("value", 1.);
+    }
+    TS_ASSERT(ExecutionProfiler::Instance().events().empty());
+  }
+
+  void test_span_records_event_with_args() {
+    ExecutionProfiler::Instance().setEnabled(true);
+    {
+      ExecutionProfilerImpl::Span span("test", "span");
+      TS_ASSERT(span.active());
+      span.addArg("value", 2.5);
+    }
+    const auto events = ExecutionProfiler::Instance().events();
+    TS_ASSERT_EQUALS(events.size(), 1);
+    const auto &event = events.front();
+    TS_ASSERT_EQUALS(event.name, "span");
+    TS_ASSERT_EQUALS(event.category, "test");
+    TS_ASSERT_LESS_THAN_EQUALS(0, event.start);
+    TS_ASSERT_LESS_THAN_EQUALS(0, event.duration);
+    TS_ASSERT_EQUALS(event.args.size(), 1);
+    TS_ASSERT_EQUALS(event.args.front().first, "value");
+    TS_ASSERT_EQUALS(event.args.front().second, 2.5);
+  }
+
+  void test_nested_spans_are_ordered_outer_first() {
+    ExecutionProfiler::Instance().setEnabled(true);
+    {
+      ExecutionProfilerImpl::Span outer("test", "outer");
+      ExecutionProfilerImpl::Span inner("test", "inner");
+    }
+    const auto events = ExecutionProfiler::Instance().events();
+    TS_ASSERT_EQUALS(events.size(), 2);
+    TS_ASSERT_EQUALS(events[0].name, "outer");
+    TS_ASSERT_EQUALS(events[1].name, "inner");
+    TS_ASSERT_LESS_THAN_EQUALS(events[0].start, events[1].start);
+    TS_ASSERT_LESS_THAN_EQUALS(events[1].start + events[1].duration,
+                               events[0].start + events[0].duration);
+  }
+
+  void test_parallel_loop_is_recorded() {
+    ExecutionProfiler::Instance().setEnabled(true);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 16; ++i) {
+      PARALLEL_FOR_IF(true)
+      for (int j = 0; j < 4; ++j) {
+      }
+    }
+    const auto events = ExecutionProfiler::Instance().events();
+    TS_ASSERT_LESS_THAN_EQUALS(1, events.size());
+    const auto &outer = events.front();
+    TS_ASSERT_EQUALS(outer.category, "parallel");
+    TS_ASSERT_EQUALS(outer.name.find("ExecutionProfilerTest.h:"), 0);
+    TS_ASSERT_LESS_THAN_EQUALS(1, outer.args.size());
+    TS_ASSERT_EQUALS(outer.args.front().first, "threads");
+    TS_ASSERT_LESS_THAN_EQUALS(1., outer.args.front().second);
+  }
+
+  void test_thread_pool_tasks_are_recorded() {
+    ExecutionProfiler::Instance().setEnabled(true);
+    Mantid::Kernel::ThreadPool pool;
+    for (int i = 0; i < 10; ++i)
+      pool.schedule(new Mantid::Kernel::FunctionTask(doNothing, 2.0));
+    pool.joinAll();
+    const auto events = ExecutionProfiler::Instance().events();
+    TS_ASSERT_EQUALS(events.size(), 10);
+    for (const auto &event : events) {
+      TS_ASSERT_EQUALS(event.category, "task");
+      TS_ASSERT_EQUALS(event.args.size(), 1);
+      TS_ASSERT_EQUALS(event.args.front().second, 2.0);
+    }
+  }
+
+  void test_toChromeTrace() {
+    ExecutionProfiler::Instance().setEnabled(true);
+    {
+      ExecutionProfilerImpl::Span span("algorithm", "Rebin v1");
+      span.addArg("cpu_seconds", 0.5);
+    }
+    const auto trace = ExecutionProfiler::Instance().toChromeTrace();
+    TS_ASSERT_EQUALS(trace["displayTimeUnit"].asString(), "ms");
+    const auto &traceEvents = trace["traceEvents"];
+    TS_ASSERT(traceEvents.isArray());
+    TS_ASSERT_EQUALS(traceEvents.size(), 1);
+    const auto &event = traceEvents[0];
+    TS_ASSERT_EQUALS(event["name"].asString(), "Rebin v1");
+    TS_ASSERT_EQUALS(event["cat"].asString(), "algorithm");
+    TS_ASSERT_EQUALS(event["ph"].asString(), "X");
+    TS_ASSERT(event["ts"].isIntegral());
+    TS_ASSERT(event["dur"].isIntegral());
+    TS_ASSERT_EQUALS(event["pid"].asInt(), 0);
+    TS_ASSERT(event["tid"].isIntegral());
+    TS_ASSERT_EQUALS(event["args"]["cpu_seconds"].asDouble(), 0.5);
+  }
+
+  void test_saveChromeTrace() {
+    ExecutionProfiler::Instance().setEnabled(true);
+    { ExecutionProfilerImpl::Span span("test", "saved"); }
+    Poco::TemporaryFile file;
+    ExecutionProfiler::Instance().saveChromeTrace(file.path());
+    std::ifstream in(file.path());
+    ::Json::Value trace;
+    ::Json::Reader reader;
+    TS_ASSERT(reader.parse(in, trace));
+    TS_ASSERT_EQUALS(trace["traceEvents"][0]["name"].asString(), "saved");
+  }
+
+  void test_saveChromeTrace_throws_if_file_cannot_be_written() {
+    TS_ASSERT_THROWS(ExecutionProfiler::Instance().saveChromeTrace(
+                         "/nonexistent/directory/trace.json"),
+                     const std::runtime_error &);
+  }
+};
+
+#endif /* MANTID_KERNEL_EXECUTIONPROFILERTEST_H_ */
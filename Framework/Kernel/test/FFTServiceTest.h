@@ -0,0 +1,134 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_FFTSERVICETEST_H_
+#define MANTID_KERNEL_FFTSERVICETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/FFTService.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using Mantid::Kernel::RealFFTPlan;
+namespace FFTService = Mantid::Kernel::FFTService;
+
+class FFTServiceTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FFTServiceTest *createSuite() { return new FFTServiceTest(); }
+  static void destroySuite(FFTServiceTest *suite) { delete suite; }
+
+  void test_zero_size_throws() {
+    TS_ASSERT_THROWS(RealFFTPlan(0), std::invalid_argument);
+  }
+
+  void test_forward_gives_half_complex_order() {
+    const size_t size = 8;
+    // 2 + 3 cos(2 pi x / 8) - sin(4 pi x / 8)
+    std::vector<double> data(size);
+    for (size_t i = 0; i < size; ++i) {
+      const double x = 2. * M_PI * static_cast<double>(i) / size;
+      data[i] = 2. + 3. * std::cos(x) - std::sin(2. * x);
+    }
+    FFTService::plan(size)->forward(data.data());
+    const std::vector<double> expected{16., 12., 0., 0., 4., 0., 0., 0.};
+    for (size_t i = 0; i < size; ++i)
+      TS_ASSERT_DELTA(data[i], expected[i], 1e-12);
+  }
+
+  void test_inverse_restores_the_data() {
+    for (const size_t size : {1, 2, 7, 12, 30}) {
+      std::vector<double> data(size);
+      for (size_t i = 0; i < size; ++i)
+        data[i] = std::sin(0.3 * static_cast<double>(i * i)) + 0.5;
+      const auto original = data;
+      const auto plan = FFTService::plan(size);
+      plan->forward(data.data());
+      plan->inverse(data.data());
+      for (size_t i = 0; i < size; ++i)
+        TS_ASSERT_DELTA(data[i], original[i], 1e-12);
+    }
+  }
+
+  void test_batch_transforms_every_array() {
+    const size_t size = 10;
+    const size_t count = 25;
+    std::vector<double> data(size * count);
+    for (size_t i = 0; i < data.size(); ++i)
+      data[i] = std::cos(0.1 * static_cast<double>(i));
+    const auto plan = FFTService::plan(size);
+    auto single = data;
+    for (size_t i = 0; i < count; ++i)
+      plan->forward(single.data() + i * size);
+    auto batch = data;
+    plan->forward(batch.data(), count);
+    TS_ASSERT_EQUALS(batch, single);
+    plan->inverse(batch.data(), count);
+    for (size_t i = 0; i < data.size(); ++i)
+      TS_ASSERT_DELTA(batch[i], data[i], 1e-12);
+  }
+
+  void test_plans_are_cached() {
+    const auto plan = FFTService::plan(17);
+    TS_ASSERT_EQUALS(plan->size(), 17);
+    TS_ASSERT_EQUALS(FFTService::plan(17), plan);
+    TS_ASSERT_DIFFERS(FFTService::plan(18), plan);
+  }
+
+  void test_fastSize() {
+    TS_ASSERT_EQUALS(FFTService::fastSize(0), 1);
+    TS_ASSERT_EQUALS(FFTService::fastSize(1), 1);
+    TS_ASSERT_EQUALS(FFTService::fastSize(7), 8);
+    TS_ASSERT_EQUALS(FFTService::fastSize(11), 12);
+    TS_ASSERT_EQUALS(FFTService::fastSize(97), 100);
+    TS_ASSERT_EQUALS(FFTService::fastSize(1025), 1080);
+  }
+
+  void test_multiply_gives_the_circular_convolution() {
+    checkProduct(false);
+  }
+
+  void test_multiplyConjugate_gives_the_circular_correlation() {
+    checkProduct(true);
+  }
+
+private:
+  void checkProduct(const bool conjugate) {
+    for (const size_t size : {5, 6}) {
+      std::vector<double> a(size), b(size);
+      for (size_t i = 0; i < size; ++i) {
+        a[i] = static_cast<double>(i) + 1.;
+        b[i] = std::cos(static_cast<double>(i));
+      }
+      std::vector<double> expected(size, 0.);
+      for (size_t k = 0; k < size; ++k) {
+        for (size_t j = 0; j < size; ++j) {
+          // correlation: sum_j a[j] b[j + k], convolution: sum_j a[j] b[k - j]
+          const size_t other =
+              conjugate ? (j + k) % size : (k + size - j) % size;
+          expected[k] += a[j] * b[other];
+        }
+      }
+      const auto plan = FFTService::plan(size);
+      plan->forward(a.data());
+      plan->forward(b.data());
+      std::vector<double> result(size);
+      if (conjugate)
+        FFTService::multiplyConjugate(a.data(), b.data(), result.data(), size);
+      else
+        FFTService::multiply(a.data(), b.data(), result.data(), size);
+      plan->inverse(result.data());
+      for (size_t k = 0; k < size; ++k)
+        TS_ASSERT_DELTA(result[k], expected[k], 1e-12);
+    }
+  }
+};
+
+#endif /* MANTID_KERNEL_FFTSERVICETEST_H_ */
@@ -0,0 +1,104 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_PARALLELREDUCETEST_H_
+#define MANTID_KERNEL_PARALLELREDUCETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/ParallelReduce.h"
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using Mantid::Kernel::CompensatedSum;
+using Mantid::Kernel::parallelReduce;
+
+class ParallelReduceTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ParallelReduceTest *createSuite() { return new ParallelReduceTest(); }
+  static void destroySuite(ParallelReduceTest *suite) { delete suite; }
+
+  void test_CompensatedSum_keeps_small_values() {
+    CompensatedSum sum(1.0);
+    for (int i = 0; i < 10000; ++i)
+      sum += 1e-16;
+    sum += -1.0;
+    TS_ASSERT_DELTA(sum.value(), 1e-12, 1e-24);
+  }
+
+  void test_CompensatedSum_merge() {
+    CompensatedSum a(1e16);
+    a += 1.0;
+    CompensatedSum b(-1e16);
+    b += 1.0;
+    a += b;
+    TS_ASSERT_EQUALS(a.value(), 2.0);
+  }
+
+  void test_sum() {
+    for (const size_t size : {0, 1, 7, 64, 65, 1000}) {
+      const auto result = parallelReduce(
+          size, size_t(0),
+          [](size_t &partial, const size_t item) { partial += item; },
+          [](size_t &partial, size_t &other) { partial += other; });
+      TS_ASSERT_EQUALS(result, size * (size - (size > 0 ? 1 : 0)) / 2);
+    }
+  }
+
+  void test_every_item_is_accumulated_once_in_order() {
+    const size_t size = 1000;
+    const auto result = parallelReduce(
+        size, std::vector<size_t>(),
+        [](std::vector<size_t> &partial, const size_t item) {
+          partial.push_back(item);
+        },
+        [](std::vector<size_t> &partial, std::vector<size_t> &other) {
+          partial.insert(partial.end(), other.begin(), other.end());
+        },
+        10);
+    std::vector<size_t> expected(size);
+    std::iota(expected.begin(), expected.end(), size_t(0));
+    TS_ASSERT_EQUALS(result, expected);
+  }
+
+  void test_serial_gives_same_result() {
+    auto accumulate = [](CompensatedSum &partial, const size_t item) {
+      partial += 1.0 / static_cast<double>(item + 1);
+    };
+    auto merge = [](CompensatedSum &partial, CompensatedSum &other) {
+      partial += other;
+    };
+    const auto parallel =
+        parallelReduce(100000, CompensatedSum(), accumulate, merge);
+    const auto serial =
+        parallelReduce(100000, CompensatedSum(), accumulate, merge, 1, false);
+    TS_ASSERT_EQUALS(parallel.value(), serial.value());
+  }
+
+  void test_exception_is_rethrown() {
+    TS_ASSERT_THROWS(parallelReduce(100, 0,
+                                    [](int &, const size_t item) {
+                                      if (item == 50)
+                                        throw std::runtime_error("item");
+                                    },
+                                    [](int &, int &) {}),
+                     std::runtime_error);
+  }
+
+  void test_exception_in_merge_is_rethrown() {
+    TS_ASSERT_THROWS(parallelReduce(100, 0, [](int &, const size_t) {},
+                                    [](int &, int &) {
+                                      throw std::runtime_error("merge");
+                                    }),
+                     std::runtime_error);
+  }
+};
+
+#endif /* MANTID_KERNEL_PARALLELREDUCETEST_H_ */
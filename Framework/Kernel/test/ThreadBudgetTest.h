@@ -0,0 +1,145 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_THREADBUDGETTEST_H_
+#define MANTID_KERNEL_THREADBUDGETTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/ThreadBudget.h"
+
+#include <atomic>
+#include <vector>
+
+using Mantid::Kernel::ThreadBudget;
+
+class ThreadBudgetTest : public CxxTest::TestSuite {
+public:
+  void setUp() override { m_capacity = ThreadBudget::capacity(); }
+  void tearDown() override { ThreadBudget::setCapacity(m_capacity); }
+
+  void test_capacity_is_at_least_one() {
+    TS_ASSERT_LESS_THAN_EQUALS(1, ThreadBudget::capacity());
+    ThreadBudget::setCapacity(0);
+    TS_ASSERT_EQUALS(ThreadBudget::capacity(), 1);
+  }
+
+  void test_reservations_share_the_capacity() {
+    ThreadBudget::setCapacity(8);
+    TS_ASSERT_EQUALS(ThreadBudget::available(), 7);
+    {
+      ThreadBudget::Reservation outer(3, true);
+      TS_ASSERT_EQUALS(outer.numThreads(), 3);
+      TS_ASSERT(outer.parallel());
+      TS_ASSERT_EQUALS(ThreadBudget::available(), 5);
+      ThreadBudget::Reservation inner(8, true);
+      TS_ASSERT_EQUALS(inner.numThreads(), 6);
+      TS_ASSERT_EQUALS(ThreadBudget::available(), 0);
+      // Nothing left: runs in the calling thread only
+      ThreadBudget::Reservation nested(8, true);
+      TS_ASSERT_EQUALS(nested.numThreads(), 1);
+      TS_ASSERT(!nested.parallel());
+    }
+    TS_ASSERT_EQUALS(ThreadBudget::available(), 7);
+  }
+
+  void test_serial_reservation_takes_nothing() {
+    ThreadBudget::setCapacity(4);
+    ThreadBudget::Reservation reservation(4, false);
+    TS_ASSERT_EQUALS(reservation.numThreads(), 1);
+    TS_ASSERT_EQUALS(ThreadBudget::available(), 3);
+  }
+
+  void test_enterOnce() {
+    ThreadBudget::Reservation reservation(1, true);
+    TS_ASSERT(reservation.enterOnce());
+    TS_ASSERT(!reservation.enterOnce());
+  }
+
+  void test_limits_nest() {
+    ThreadBudget::setCapacity(8);
+    TS_ASSERT_EQUALS(ThreadBudget::threadLimit(), 0);
+    {
+      ThreadBudget::Limit limit(4);
+      TS_ASSERT_EQUALS(ThreadBudget::threadLimit(), 4);
+      {
+        ThreadBudget::Limit looser(6);
+        TS_ASSERT_EQUALS(ThreadBudget::threadLimit(), 4);
+        ThreadBudget::Limit tighter(2);
+        TS_ASSERT_EQUALS(ThreadBudget::threadLimit(), 2);
+        ThreadBudget::Reservation reservation(8, true);
+        TS_ASSERT_EQUALS(reservation.numThreads(), 2);
+      }
+      TS_ASSERT_EQUALS(ThreadBudget::threadLimit(), 4);
+      ThreadBudget::Limit none(0);
+      TS_ASSERT_EQUALS(ThreadBudget::threadLimit(), 4);
+    }
+    TS_ASSERT_EQUALS(ThreadBudget::threadLimit(), 0);
+  }
+
+  void test_nested_parallel_loops_do_not_oversubscribe() {
+    ThreadBudget::setCapacity(4);
+    std::atomic<int> running{0};
+    std::atomic<int> peak{0};
+    std::atomic<int> count{0};
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 8; ++i) {
+      PARALLEL_FOR_IF(true)
+      for (int j = 0; j < 8; ++j) {
+        const int now = ++running;
+        int previous = peak.load();
+        while (now > previous && !peak.compare_exchange_weak(previous, now)) {
+        }
+        ++count;
+        --running;
+      }
+    }
+    TS_ASSERT_EQUALS(count.load(), 64);
+    TS_ASSERT_LESS_THAN_EQUALS(peak.load(), 4);
+    TS_ASSERT_EQUALS(ThreadBudget::available(), 3);
+  }
+
+  void test_region_nested_in_an_active_region_reserves_nothing() {
+    ThreadBudget::setCapacity(8);
+    std::vector<int> nestedThreads(8, 0);
+    std::vector<int> outerThreads(8, 0);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 8; ++i) {
+      ThreadBudget::Reservation nested(true);
+      nestedThreads[i] = nested.numThreads();
+      outerThreads[i] = PARALLEL_NUMBER_OF_THREADS;
+    }
+    for (size_t i = 0; i < nestedThreads.size(); ++i) {
+      if (outerThreads[i] > 1)
+        TS_ASSERT_EQUALS(nestedThreads[i], 1);
+    }
+  }
+
+  void test_limit_is_inherited_by_the_threads_of_a_region() {
+    ThreadBudget::setCapacity(8);
+    std::vector<size_t> limits(16, 0);
+    {
+      ThreadBudget::Limit limit(3);
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int i = 0; i < 16; ++i)
+        limits[i] = ThreadBudget::threadLimit();
+    }
+    for (const auto inherited : limits)
+      TS_ASSERT_EQUALS(inherited, 3);
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 16; ++i)
+      limits[i] = ThreadBudget::threadLimit();
+    for (const auto inherited : limits)
+      TS_ASSERT_EQUALS(inherited, 0);
+  }
+
+private:
+  size_t m_capacity{1};
+};
+
+#endif /* MANTID_KERNEL_THREADBUDGETTEST_H_ */
@@ -11,6 +11,7 @@
 
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include <MantidKernel/FunctionTask.h>
 #include <MantidKernel/ProgressText.h>
 #include <MantidKernel/ThreadPool.h>
@@ -20,6 +21,7 @@
 
 #include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
+#include <atomic>
 #include <cstdlib>
 
 using namespace Mantid::Kernel;
@@ -153,6 +155,18 @@ public:
     TS_ASSERT_EQUALS(threadpooltest_check, 12);
   }
 
+  void test_tasks_inherit_the_thread_limit_of_the_starting_thread() {
+    std::atomic<size_t> limit{0};
+    {
+      ThreadBudget::Limit threadLimit(2);
+      ThreadPool p;
+      p.schedule(new FunctionTask(
+          [&limit]() { limit = ThreadBudget::threadLimit(); }));
+      TS_ASSERT_THROWS_NOTHING(p.joinAll());
+    }
+    TS_ASSERT_EQUALS(limit.load(), 2);
+  }
+
   //=======================================================================================
   //=======================================================================================
   /** Class for debugging progress reporting */
@@ -376,6 +390,10 @@ public:
     do_StressTest_scheduler(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_ThreadSchedulerWorkStealing() {
+    do_StressTest_scheduler(new ThreadSchedulerWorkStealing());
+  }
+
   //--------------------------------------------------------------------
   /** Perform a stress test on the given scheduler.
    * This one creates tasks that create new tasks; e.g. 10 tasks each add
@@ -414,6 +432,10 @@ public:
     do_StressTest_TasksThatCreateTasks(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_TasksThatCreateTasks_ThreadSchedulerWorkStealing() {
+    do_StressTest_TasksThatCreateTasks(new ThreadSchedulerWorkStealing());
+  }
+
   //=======================================================================================
   /** Task that throws an exception */
   class TaskThatThrows : public Task {
@@ -0,0 +1,243 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadScheduler.h"
+#include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+
+#include <atomic>
+
+using namespace Mantid::Kernel;
+
+namespace {
+int ThreadSchedulerWorkStealingTest_numDestructed;
+
+class WorkStealingTask : public Task {
+public:
+  explicit WorkStealingTask(double cost = 1.0) : Task() { m_cost = cost; }
+  ~WorkStealingTask() override {
+    ThreadSchedulerWorkStealingTest_numDestructed++;
+  }
+  void run() override {}
+};
+
+class WorkStealingTaskThatThrows : public Task {
+  void run() override { throw std::runtime_error("Test exception"); }
+};
+
+/// Task that recursively pushes tasks, as MDGridBox splitting does
+class SpawningTask : public Task {
+public:
+  SpawningTask(ThreadScheduler *scheduler, std::atomic<size_t> &counter,
+               size_t depth)
+      : Task(), m_scheduler(scheduler), m_counter(counter), m_depth(depth) {
+    m_cost = static_cast<double>(10 - depth);
+  }
+  void run() override {
+    if (m_depth < 4) {
+      for (size_t i = 0; i < 10; ++i)
+        m_scheduler->push(new SpawningTask(m_scheduler, m_counter, m_depth + 1));
+    } else {
+      ++m_counter;
+    }
+  }
+
+private:
+  ThreadScheduler *m_scheduler;
+  std::atomic<size_t> &m_counter;
+  size_t m_depth;
+};
+} // namespace
+
+class ThreadSchedulerWorkStealingTest : public CxxTest::TestSuite {
+public:
+  void test_push_and_clear() {
+    ThreadSchedulerWorkStealingTest_numDestructed = 0;
+    ThreadSchedulerWorkStealing sc(3);
+    TS_ASSERT_EQUALS(sc.numQueues(), 3);
+    TS_ASSERT(sc.empty());
+    for (size_t i = 0; i < 7; ++i)
+      sc.push(new WorkStealingTask(2.0));
+    TS_ASSERT_EQUALS(sc.size(), 7);
+    TS_ASSERT(!sc.empty());
+    TS_ASSERT_DELTA(sc.totalCost(), 14.0, 1e-12);
+    // Tasks pushed from outside a worker are dealt out in turn
+    TS_ASSERT_EQUALS(sc.queueSize(0), 3);
+    TS_ASSERT_EQUALS(sc.queueSize(1), 2);
+    TS_ASSERT_EQUALS(sc.queueSize(2), 2);
+
+    sc.clear();
+    TS_ASSERT_EQUALS(sc.size(), 0);
+    TS_ASSERT(sc.empty());
+    TS_ASSERT_EQUALS(ThreadSchedulerWorkStealingTest_numDestructed, 7);
+  }
+
+  void test_pop_takes_newest_task_of_own_queue() {
+    ThreadSchedulerWorkStealing sc(2);
+    WorkStealingTask *tasks[4];
+    for (auto &task : tasks) {
+      task = new WorkStealingTask();
+      sc.push(task);
+    }
+    // Queue 0 holds tasks 0 and 2, queue 1 holds tasks 1 and 3
+    Task *popped = sc.pop(0);
+    TS_ASSERT_EQUALS(popped, tasks[2]);
+    sc.finished(popped, 0);
+    delete popped;
+    popped = sc.pop(1);
+    TS_ASSERT_EQUALS(popped, tasks[3]);
+    sc.finished(popped, 1);
+    delete popped;
+    TS_ASSERT_DELTA(sc.totalCostExecuted(), 2.0, 1e-12);
+  }
+
+  void test_steals_oldest_tasks_from_most_costly_queue() {
+    ThreadSchedulerWorkStealing sc(3);
+    // Queue 1 gets the expensive tasks
+    std::vector<Task *> tasks;
+    for (size_t i = 0; i < 8; ++i) {
+      tasks.push_back(new WorkStealingTask(i % 3 == 1 ? 10.0 : 1.0));
+      sc.push(tasks.back());
+    }
+    TS_ASSERT_EQUALS(sc.queueSize(0), 3);
+    TS_ASSERT_EQUALS(sc.queueSize(1), 3);
+    TS_ASSERT_EQUALS(sc.queueSize(2), 2);
+
+    // Thread 2 empties its own queue first
+    for (size_t i = 0; i < 2; ++i) {
+      Task *task = sc.pop(2);
+      sc.finished(task, 2);
+      delete task;
+    }
+    // Then steals the oldest task of queue 1 (cost 30) and half its cost
+    Task *stolen = sc.pop(2);
+    TS_ASSERT_EQUALS(stolen, tasks[1]);
+    TS_ASSERT_EQUALS(sc.queueSize(1), 1);
+    TS_ASSERT_EQUALS(sc.queueSize(2), 1);
+    TS_ASSERT_EQUALS(sc.size(), 5);
+    TS_ASSERT(!sc.empty());
+    sc.finished(stolen, 2);
+    delete stolen;
+
+    // The other stolen task is now local to thread 2
+    Task *local = sc.pop(2);
+    TS_ASSERT_EQUALS(local, tasks[4]);
+    sc.finished(local, 2);
+    delete local;
+  }
+
+  void test_empty_waits_for_running_tasks() {
+    ThreadSchedulerWorkStealing sc(2);
+    sc.push(new WorkStealingTask());
+    Task *task = sc.pop(1);
+    TS_ASSERT(task);
+    TS_ASSERT_EQUALS(sc.size(), 0);
+    // The running task could still push more work
+    TS_ASSERT(!sc.empty());
+    sc.finished(task, 1);
+    TS_ASSERT(sc.empty());
+    TS_ASSERT(!sc.pop(0));
+    delete task;
+  }
+
+  void test_tasks_pushed_by_running_task_stay_local() {
+    std::atomic<size_t> counter{0};
+    ThreadSchedulerWorkStealing sc(4);
+    sc.push(new SpawningTask(&sc, counter, 3));
+    sc.push(new WorkStealingTask());
+    // Queue 0 got the spawning task; run it as thread 2
+    Task *task = sc.pop(2);
+    TS_ASSERT(dynamic_cast<SpawningTask *>(task));
+    task->run();
+    sc.finished(task, 2);
+    delete task;
+    TS_ASSERT_EQUALS(sc.queueSize(0), 0);
+    TS_ASSERT_EQUALS(sc.queueSize(1), 1);
+    TS_ASSERT_EQUALS(sc.queueSize(2), 10);
+    sc.clear();
+  }
+
+  void test_ThreadPool_with_tasks_that_create_tasks() {
+    auto sc = new ThreadSchedulerWorkStealing(4);
+    ThreadPool pool(sc, 4);
+    std::atomic<size_t> counter{0};
+    pool.schedule(new SpawningTask(sc, counter, 0));
+    TS_ASSERT_THROWS_NOTHING(pool.joinAll());
+    TS_ASSERT_EQUALS(counter.load(), 10000);
+    TS_ASSERT(sc->empty());
+    TS_ASSERT_DELTA(sc->totalCostExecuted(), sc->totalCost(), 1e-6);
+  }
+
+  void test_ThreadPool_rethrows_exception() {
+    ThreadPool pool(new ThreadSchedulerWorkStealing(2), 2);
+    std::atomic<size_t> counter{0};
+    for (size_t i = 0; i < 100; ++i)
+      pool.schedule(new FunctionTask([&counter]() { ++counter; }));
+    pool.schedule(new WorkStealingTaskThatThrows());
+    TS_ASSERT_THROWS(pool.joinAll(), std::runtime_error);
+  }
+};
+
+//=====================================================================================
+// Performance tests
+//=====================================================================================
+class ThreadSchedulerWorkStealingTestPerformance : public CxxTest::TestSuite {
+public:
+  /// Many tiny tasks pushed up front, as in LoadEventNexus
+  void run_tiny_tasks(ThreadScheduler *sc) {
+    ThreadPool pool(sc, 0);
+    std::atomic<size_t> counter{0};
+    for (size_t i = 0; i < 200000; ++i)
+      pool.schedule(new FunctionTask([&counter]() { ++counter; }, 1.0));
+    TS_ASSERT_THROWS_NOTHING(pool.joinAll());
+    TS_ASSERT_EQUALS(counter.load(), 200000);
+  }
+
+  /// Tasks pushed from within tasks, as in MDGridBox::splitAllIfNeeded
+  void run_spawning_tasks(ThreadScheduler *sc) {
+    ThreadPool pool(sc, 0);
+    std::atomic<size_t> counter{0};
+    for (size_t i = 0; i < 20; ++i)
+      pool.schedule(new SpawningTask(sc, counter, 0));
+    TS_ASSERT_THROWS_NOTHING(pool.joinAll());
+    TS_ASSERT_EQUALS(counter.load(), 200000);
+  }
+
+  void test_tiny_tasks_FIFO() { run_tiny_tasks(new ThreadSchedulerFIFO()); }
+
+  void test_tiny_tasks_LargestCost() {
+    run_tiny_tasks(new ThreadSchedulerLargestCost());
+  }
+
+  void test_tiny_tasks_Mutexes() {
+    run_tiny_tasks(new ThreadSchedulerMutexes());
+  }
+
+  void test_tiny_tasks_WorkStealing() {
+    run_tiny_tasks(new ThreadSchedulerWorkStealing());
+  }
+
+  void test_spawning_tasks_FIFO() {
+    run_spawning_tasks(new ThreadSchedulerFIFO());
+  }
+
+  void test_spawning_tasks_LargestCost() {
+    run_spawning_tasks(new ThreadSchedulerLargestCost());
+  }
+
+  void test_spawning_tasks_WorkStealing() {
+    run_spawning_tasks(new ThreadSchedulerWorkStealing());
+  }
+};
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_ */
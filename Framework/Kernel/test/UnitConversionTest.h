@@ -9,9 +9,14 @@
 
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/PhysicalConstants.h"
+#include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitConversion.h"
+#include "MantidKernel/UnitFactory.h"
 #include <cxxtest/TestSuite.h>
 
+#include <cmath>
+#include <vector>
+
 using Mantid::Kernel::UnitConversion;
 
 class UnitConversionTest : public CxxTest::TestSuite {
@@ -73,6 +78,37 @@ public:
                                      emode, efixed));
     TS_ASSERT_DELTA(result, expected, 1e-12);
   }
+
+  void test_Run_On_Arrays_Matches_The_Conversion_Via_TOF() {
+    using namespace Mantid::Kernel;
+    const std::vector<std::string> unitIDs{"TOF", "Wavelength", "Energy",
+                                           "dSpacing", "MomentumTransfer",
+                                           "QSquared", "DeltaE"};
+    // Includes values the units do not convert through their power laws
+    const std::vector<double> values{-1.0, 0.0, 0.3, 1.5, 40.0, 2000.0};
+    for (const auto &srcID : unitIDs) {
+      for (const auto &destID : unitIDs) {
+        // Energy transfer is not defined for elastic scattering
+        const int emode = (srcID == "DeltaE" || destID == "DeltaE") ? 2 : 0;
+        auto srcUnit = UnitFactory::Instance().create(srcID);
+        auto destUnit = UnitFactory::Instance().create(destID);
+        srcUnit->initialize(10.0, 1.1, 0.5, emode, 3.0, 0.0);
+        destUnit->initialize(10.0, 1.1, 0.5, emode, 3.0, 0.0);
+        std::vector<double> result(values);
+        UnitConversion::run(*srcUnit, *destUnit, result.data(), result.data(),
+                            result.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+          const double expected =
+              destUnit->singleFromTOF(srcUnit->singleToTOF(values[i]));
+          if (std::isfinite(expected)) {
+            TS_ASSERT_DELTA(result[i], expected, 1e-12 * std::abs(expected));
+          } else {
+            TS_ASSERT(!std::isfinite(result[i]));
+          }
+        }
+      }
+    }
+  }
 };
 
 #endif /* MANTID_KERNEL_UNITCONVERTERTEST_H_ */
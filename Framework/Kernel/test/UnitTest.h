@@ -1396,6 +1396,43 @@ public:
     TS_ASSERT_EQUALS(degrees.unitID(), "Degrees");
   }
 
+  void test_arrayToTOF_and_arrayFromTOF_match_the_single_conversions() {
+    std::vector<Unit *> units{&tof, &lambda, &energy, &energyk, &d,    &q,
+                              &q2,  &dE,     &k_i,    &delta,   &tau};
+    const std::vector<double> values{0.5, 1.0, 2.5, 100.0, 12000.0};
+    for (auto unit : units) {
+      // Energy transfer is not defined for elastic scattering
+      const int emode = unit == &dE ? 2 : 0;
+      unit->initialize(10.0, 1.1, 0.5, emode, 3.0, 0.0);
+      std::vector<double> result(values.size());
+      unit->arrayToTOF(values.data(), result.data(), values.size());
+      for (size_t i = 0; i < values.size(); ++i)
+        TS_ASSERT_EQUALS(result[i], unit->singleToTOF(values[i]));
+      unit->arrayFromTOF(values.data(), result.data(), values.size());
+      for (size_t i = 0; i < values.size(); ++i)
+        TS_ASSERT_EQUALS(result[i], unit->singleFromTOF(values[i]));
+    }
+  }
+
+  void test_power_laws_match_the_single_conversions() {
+    std::vector<Unit *> units{&tof, &lambda, &energy, &d, &q, &q2};
+    for (auto unit : units) {
+      unit->initialize(10.0, 1.1, 0.5, 0, 0.0, 0.0);
+      double factor, power;
+      TS_ASSERT(unit->toTOFPowerLaw(factor, power));
+      TS_ASSERT_DELTA(factor * std::pow(2.5, power), unit->singleToTOF(2.5),
+                      1e-12 * unit->singleToTOF(2.5));
+      TS_ASSERT(unit->fromTOFPowerLaw(factor, power));
+      TS_ASSERT_DELTA(factor * std::pow(2500.0, power),
+                      unit->singleFromTOF(2500.0),
+                      1e-12 * unit->singleFromTOF(2500.0));
+    }
+    double factor, power;
+    dE.initialize(10.0, 1.1, 0.5, 1, 3.0, 0.0);
+    TS_ASSERT(!dE.toTOFPowerLaw(factor, power));
+    TS_ASSERT(!dE.fromTOFPowerLaw(factor, power));
+  }
+
 private:
   Units::Label label;
   Units::TOF tof;
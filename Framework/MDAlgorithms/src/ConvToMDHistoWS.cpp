@@ -103,17 +103,14 @@ size_t ConvToMDHistoWS::conversionChunk(size_t startSpectra) {
     std::vector<double> XtargetUnits;
     XtargetUnits.resize(X.size());
 
+    localUnitConv.convertUnits(X.rawData().data(), XtargetUnits.data(),
+                               X.size());
     if (histogram) {
-      double xm1 = localUnitConv.convertUnits(X[0]);
-      for (size_t j = 1; j < XtargetUnits.size(); j++) {
-        double xm = localUnitConv.convertUnits(X[j]);
-        XtargetUnits[j - 1] = 0.5 * (xm + xm1);
-        xm1 = xm;
-      }
-      XtargetUnits.back() = xm1; // just in case, should not be used
-    } else
-      for (size_t j = 0; j < XtargetUnits.size(); j++)
-        XtargetUnits[j] = localUnitConv.convertUnits(X[j]);
+      // the bin centres in the target units; the last value is left as the
+      // converted bin edge just in case, it should not be used
+      for (size_t j = 1; j < XtargetUnits.size(); j++)
+        XtargetUnits[j - 1] = 0.5 * (XtargetUnits[j] + XtargetUnits[j - 1]);
+    }
 
     //=> START INTERNAL LOOP OVER THE "TIME"
     for (size_t j = 0; j < specSize; ++j) {
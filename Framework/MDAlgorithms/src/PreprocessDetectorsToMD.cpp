@@ -15,6 +15,8 @@
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/PropertyWithValue.h"
 
+#include <cmath>
+
 using namespace Mantid;
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
@@ -240,6 +242,9 @@ void PreprocessDetectorsToMD::processDetectorsPositions(
   //// Loop over the spectra
   uint32_t liveDetectorsCount(0);
   const auto &spectrumInfo = inputWS->spectrumInfo();
+  const auto &l2s = spectrumInfo.l2s();
+  const auto &twoThetas = spectrumInfo.twoThetas();
+  const auto &azimuthals = spectrumInfo.azimuthals();
   for (size_t i = 0; i < nHist; i++) {
     sp2detMap[i] = std::numeric_limits<uint64_t>::quiet_NaN();
     detId[i] = std::numeric_limits<int32_t>::quiet_NaN();
@@ -265,10 +270,14 @@ void PreprocessDetectorsToMD::processDetectorsPositions(
     sp2detMap[i] = liveDetectorsCount;
     detId[liveDetectorsCount] = int32_t(spDet.getID());
     detIDMap[liveDetectorsCount] = i;
-    L2[liveDetectorsCount] = spectrumInfo.l2(i);
-
-    double polar = spectrumInfo.twoTheta(i);
-    double azim = spDet.getPhi();
+    L2[liveDetectorsCount] = l2s[i];
+
+    double polar = twoThetas[i];
+    double azim = azimuthals[i];
+    // Groups containing monitors have no well-defined scattering angle
+    if (std::isnan(polar))
+      throw std::logic_error(
+          "Two theta (scattering angle) is not defined for monitors.");
     TwoTheta[liveDetectorsCount] = polar;
     Azimuthal[liveDetectorsCount] = azim;
 
@@ -7,7 +7,9 @@
 #include "MantidMDAlgorithms/UnitsConversionHelper.h"
 #include "MantidAPI/NumericAxis.h"
 #include "MantidKernel/Strings.h"
+#include "MantidKernel/UnitConversion.h"
 #include "MantidKernel/UnitFactory.h"
+#include <algorithm>
 #include <cmath>
 
 namespace Mantid {
@@ -338,6 +340,37 @@ double UnitsConversionHelper::convertUnits(double val) const {
         "updateConversion: unknown type of conversion requested");
   }
 }
+/** do actual unit conversion of an array of values
+@param   in   -- the input values which have to be converted
+@param   out  -- the converted values, may be the same array as in
+@param   size -- the number of values
+*/
+void UnitsConversionHelper::convertUnits(const double *in, double *out,
+                                         const size_t size) const {
+  switch (m_UnitCnvrsn) {
+  case (CnvrtToMD::ConvertNo): {
+    if (out != in)
+      std::copy(in, in + size, out);
+    return;
+  }
+  case (CnvrtToMD::ConvertFast): {
+    for (size_t i = 0; i < size; ++i)
+      out[i] = m_Factor * std::pow(in[i], m_Power);
+    return;
+  }
+  case (CnvrtToMD::ConvertFromTOF): {
+    m_TargetUnit->arrayFromTOF(in, out, size);
+    return;
+  }
+  case (CnvrtToMD::ConvertByTOF): {
+    Kernel::UnitConversion::run(*m_SourceWSUnit, *m_TargetUnit, in, out, size);
+    return;
+  }
+  default:
+    throw std::runtime_error(
+        "updateConversion: unknown type of conversion requested");
+  }
+}
 // copy constructor;
 UnitsConversionHelper::UnitsConversionHelper(
     const UnitsConversionHelper &another) {
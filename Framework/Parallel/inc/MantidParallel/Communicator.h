@@ -22,10 +22,6 @@ class environment;
 }
 } // namespace boost
 
-namespace ParallelTestHelpers {
-class ParallelRunner;
-}
-
 namespace Mantid {
 namespace Parallel {
 #ifdef MPI_EXPERIMENTAL
@@ -44,6 +40,8 @@ public:
 #ifdef MPI_EXPERIMENTAL
   explicit Communicator(const boost::mpi::communicator &comm);
 #endif
+  Communicator(boost::shared_ptr<detail::ThreadingBackend> backend,
+               const int rank);
 
   int rank() const;
   int size() const;
@@ -60,17 +58,11 @@ public:
   detail::ThreadingBackend &backend() const;
 
 private:
-  Communicator(boost::shared_ptr<detail::ThreadingBackend> backend,
-               const int rank);
-
 #ifdef MPI_EXPERIMENTAL
   boost::mpi::communicator m_communicator;
 #endif
   boost::shared_ptr<detail::ThreadingBackend> m_backend;
   int m_rank{0};
-
-  // For accessing constructor with threading backend.
-  friend class ParallelTestHelpers::ParallelRunner;
 };
 
 template <typename... T> void Communicator::send(T &&... args) const {
@@ -15,7 +15,7 @@
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
 
-#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <istream>
 #include <map>
@@ -31,7 +31,9 @@ namespace detail {
 
 /** ThreadingBackend provides a backend for data exchange between Communicators
   in the case of non-MPI builds when communication between threads is used to
-  mimic MPI calls. This is FOR UNIT TESTING ONLY and is NOT FOR PRODUCTION CODE.
+  mimic MPI calls. Each thread acts as one rank and messages are passed through
+  shared memory. Besides unit testing this is used to run distributed
+  algorithms on a single machine, see the RunDistributed algorithm.
 
   @author Simon Heybrock
   @date 2017
@@ -65,6 +67,8 @@ private:
            std::vector<std::unique_ptr<std::stringbuf>>>
       m_buffer;
   std::mutex m_mutex;
+  /// Signalled whenever a message is added to m_buffer
+  std::condition_variable m_sent;
 };
 
 namespace detail {
@@ -124,28 +128,24 @@ void ThreadingBackend::send(int source, int dest, int tag, T &&... args) {
     boost::archive::binary_oarchive oa(os);
     detail::saveToStream(oa, std::forward<T>(args)...);
   }
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_buffer[std::make_tuple(source, dest, tag)].push_back(std::move(buf));
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffer[std::make_tuple(source, dest, tag)].push_back(std::move(buf));
+  }
+  m_sent.notify_all();
 }
 
 template <typename... T>
 Status ThreadingBackend::recv(int dest, int source, int tag, T &&... args) {
   const auto key = std::make_tuple(source, dest, tag);
   std::unique_ptr<std::stringbuf> buf;
-  while (true) {
-    // Sleep to reduce lock contention. Without this execution times can grow
-    // enormously on Windows.
-    std::this_thread::sleep_for(std::chrono::microseconds(10));
-    std::lock_guard<std::mutex> lock(m_mutex);
-    auto it = m_buffer.find(key);
-    if (it == m_buffer.end())
-      continue;
-    auto &queue = it->second;
-    if (queue.empty())
-      continue;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto &queue = m_buffer[key];
+    // References to map elements stay valid while other keys are inserted.
+    m_sent.wait(lock, [&queue] { return !queue.empty(); });
     buf = std::move(queue.front());
     queue.erase(queue.begin());
-    break;
   }
   std::istream is(buf.get());
   boost::archive::binary_iarchive ia(is);
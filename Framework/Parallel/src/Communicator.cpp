@@ -22,6 +22,10 @@ Communicator::Communicator(const boost::mpi::communicator &comm)
     : m_communicator(comm) {}
 #endif
 
+/** Constructs the communicator of one rank of a group of threads exchanging
+ * messages via `backend`. The number of ranks is given by the size of the
+ * backend.
+ */
 Communicator::Communicator(boost::shared_ptr<detail::ThreadingBackend> backend,
                            const int rank)
     : m_backend(backend), m_rank(rank) {}
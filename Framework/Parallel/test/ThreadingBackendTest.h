@@ -11,6 +11,8 @@
 
 #include "MantidParallel/ThreadingBackend.h"
 
+#include <thread>
+
 using Mantid::Parallel::detail::ThreadingBackend;
 
 class ThreadingBackendTest : public CxxTest::TestSuite {
@@ -31,6 +33,34 @@ public:
     ThreadingBackend backend{2};
     TS_ASSERT_EQUALS(backend.size(), 2);
   }
+
+  void test_recv_waits_for_send() {
+    ThreadingBackend backend{2};
+    std::vector<int> received(3);
+    std::thread receiver([&backend, &received] {
+      for (int tag = 0; tag < 3; ++tag)
+        backend.recv(1, 0, tag, received[tag]);
+    });
+    // Send in reverse order, recv must pick the message by tag
+    for (int tag = 2; tag >= 0; --tag)
+      backend.send(0, 1, tag, 10 * tag);
+    receiver.join();
+    TS_ASSERT_EQUALS(received, (std::vector<int>{0, 10, 20}));
+  }
+
+  void test_messages_with_same_tag_arrive_in_order() {
+    ThreadingBackend backend{2};
+    std::thread sender([&backend] {
+      for (int i = 0; i < 100; ++i)
+        backend.send(0, 1, 7, i);
+    });
+    std::vector<int> received(100);
+    for (auto &value : received)
+      backend.recv(1, 0, 7, value);
+    sender.join();
+    for (int i = 0; i < 100; ++i)
+      TS_ASSERT_EQUALS(received[i], i);
+  }
 };
 
 #endif /* MANTID_PARALLEL_THREADINGBACKENDTEST_H_ */
@@ -81,6 +81,9 @@ def _do_binary_operation(op, self, rhs, lhs_vars, inplace, reverse):
 
     """
     global _workspace_op_tmps
+    # Let a lazy expression build the operation instead, e.g. ws * expr
+    if isinstance(rhs, _api.WorkspaceExpression):
+        return NotImplemented
     #
     if lhs_vars[0] > 0:
         # Assume the first and clear the temporaries as this
@@ -0,0 +1,83 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/WorkspaceExpression.h"
+#include "MantidAPI/MatrixWorkspace.h"
+
+#include <boost/python/class.hpp>
+#include <boost/python/implicit.hpp>
+
+using Mantid::API::MatrixWorkspace_sptr;
+using Mantid::API::Workspace_sptr;
+using Mantid::API::WorkspaceExpression;
+using namespace boost::python;
+
+namespace {
+// The operands are converted implicitly, so every combination of expression,
+// workspace and float is accepted as long as one side is an expression.
+WorkspaceExpression add(const WorkspaceExpression &lhs,
+                        const WorkspaceExpression &rhs) {
+  return lhs + rhs;
+}
+WorkspaceExpression radd(const WorkspaceExpression &rhs,
+                         const WorkspaceExpression &lhs) {
+  return lhs + rhs;
+}
+WorkspaceExpression subtract(const WorkspaceExpression &lhs,
+                             const WorkspaceExpression &rhs) {
+  return lhs - rhs;
+}
+WorkspaceExpression rsubtract(const WorkspaceExpression &rhs,
+                              const WorkspaceExpression &lhs) {
+  return lhs - rhs;
+}
+WorkspaceExpression multiply(const WorkspaceExpression &lhs,
+                             const WorkspaceExpression &rhs) {
+  return lhs * rhs;
+}
+WorkspaceExpression rmultiply(const WorkspaceExpression &rhs,
+                              const WorkspaceExpression &lhs) {
+  return lhs * rhs;
+}
+WorkspaceExpression divide(const WorkspaceExpression &lhs,
+                           const WorkspaceExpression &rhs) {
+  return lhs / rhs;
+}
+WorkspaceExpression rdivide(const WorkspaceExpression &rhs,
+                            const WorkspaceExpression &lhs) {
+  return lhs / rhs;
+}
+
+/// Return the result as a Workspace_sptr so that it is converted to the most
+/// derived Python type.
+Workspace_sptr evaluate(const WorkspaceExpression &self) {
+  return self.evaluate();
+}
+} // namespace
+
+void export_WorkspaceExpression() {
+  class_<WorkspaceExpression>(
+      "WorkspaceExpression",
+      "Lazy arithmetic on MatrixWorkspaces, computed in a single pass by "
+      "evaluate().",
+      init<MatrixWorkspace_sptr>((arg("self"), arg("workspace"))))
+      .def(init<double>((arg("self"), arg("value"))))
+      .def("evaluate", &evaluate, arg("self"),
+           "Compute the expression and return the result as a new workspace.")
+      .def("__add__", &add)
+      .def("__radd__", &radd)
+      .def("__sub__", &subtract)
+      .def("__rsub__", &rsubtract)
+      .def("__mul__", &multiply)
+      .def("__rmul__", &rmultiply)
+      .def("__div__", &divide)
+      .def("__truediv__", &divide)
+      .def("__rdiv__", &rdivide)
+      .def("__rtruediv__", &rdivide);
+
+  implicitly_convertible<MatrixWorkspace_sptr, WorkspaceExpression>();
+  implicitly_convertible<double, WorkspaceExpression>();
+}
@@ -0,0 +1,41 @@
+# Mantid Repository : https://github.com/mantidproject/mantid
+#
+# Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+#     NScD Oak Ridge National Laboratory, European Spallation Source
+#     & Institut Laue - Langevin
+# SPDX - License - Identifier: GPL - 3.0 +
+from __future__ import (absolute_import, division, print_function)
+
+from mantid.api import mtd, WorkspaceExpression
+from mantid.simpleapi import CreateWorkspace
+import math
+import unittest
+
+
+class WorkspaceExpressionTest(unittest.TestCase):
+    def setUp(self):
+        self.sample = CreateWorkspace(DataX=[0., 1., 2.], DataY=[10., 20.],
+                                      DataE=[2., 2.], StoreInADS=False)
+        self.can = CreateWorkspace(DataX=[0., 1., 2.], DataY=[4., 4.],
+                                   DataE=[1., 1.], StoreInADS=False)
+
+    def tearDown(self):
+        mtd.clear()
+
+    def test_expression_is_evaluated_without_temporary_workspaces(self):
+        result = ((WorkspaceExpression(self.sample) - 0.5 * self.can) / 2.).evaluate()
+        self.assertAlmostEqual(result.readY(0)[1], 9.)
+        self.assertAlmostEqual(result.readE(0)[1], math.sqrt(4. + 0.25) / 2.)
+        self.assertEqual(mtd.size(), 0)
+
+    def test_workspace_on_the_left_of_an_expression(self):
+        result = (self.sample * WorkspaceExpression(self.can)).evaluate()
+        self.assertAlmostEqual(result.readY(0)[0], 40.)
+
+    def test_number_on_the_left_of_an_expression(self):
+        result = (1. - WorkspaceExpression(self.can)).evaluate()
+        self.assertAlmostEqual(result.readY(0)[0], -3.)
+
+
+if __name__ == '__main__':
+    unittest.main()